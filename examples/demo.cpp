@@ -444,19 +444,24 @@ namespace {
         const iu::window w{"Example: Settings Panel", &s.show_example_settings};
         if (!w) return;
 
-        ImGui::TextWrapped("Tree-navigated settings panel with left-side navigation and right-side content.");
+        ImGui::TextWrapped("Tree-navigated settings panel with searchable navigation and right-side content.");
         ImGui::Spacing();
 
         s.settings
             .section("General",
                      [&] {
             ImGui::SliderFloat("Font Size", &s.settings_font_size, 8.0f, 24.0f);
+            s.settings.anchor("Font Size");
             ImGui::Checkbox("VSync", &s.settings_vsync);
+            s.settings.anchor("VSync");
         })
+            .setting("Font Size")
+            .setting("VSync")
             .section("Appearance", [&] {
             constexpr std::array<const char *, 3> themes = {"Dark", "Light", "System"};
             ImGui::Combo("Theme", &s.settings_theme_idx, themes.data(), static_cast<int>(themes.size()));
-        }).section("Keybinds", "General", [&] {
+            s.settings.anchor("Theme");
+        }).setting("Theme").section("Keybinds", "General", [&] {
             ImGui::TextUnformatted("Configure key bindings here...");
         }).render("##settings_demo");
     }
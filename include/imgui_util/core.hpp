@@ -1,4 +1,4 @@
-// core.hpp - umbrella header for core utilities (raii scopes, formatting, parsing, error handling)
+// core.hpp - umbrella header for core utilities (raii scopes, formatting, parsing, error handling, label ids)
 //
 // Usage:
 //   #include <imgui_util/core.hpp>
@@ -9,6 +9,7 @@
 #pragma once
 #include "imgui_util/core/error.hpp"
 #include "imgui_util/core/fmt_buf.hpp"
+#include "imgui_util/core/label_id.hpp"
 #include "imgui_util/core/parse.hpp"
 #include "imgui_util/core/raii.hpp"
 // NOLINTEND(misc-include-cleaner)
@@ -0,0 +1,86 @@
+/// @file context_state.hpp
+/// @brief Library state owned by an ImGui context (internal; depends on imgui_internal.h).
+///
+/// context_state<State> creates one State per ImGuiContext on first use, optionally calls a
+/// per-frame hook with it, and destroys it from the context's Shutdown hook. Caches and
+/// registries that must not be shared between contexts, or outlive them, keep their data here.
+///
+/// Usage:
+/// @code
+///   void sweep(ImGuiContext &ctx, my_registry &r) { ... }
+///   detail::context_state<my_registry> &registries() {
+///       static detail::context_state<my_registry> s{&sweep, ImGuiContextHookType_NewFramePost};
+///       return s;
+///   }
+///   my_registry &r = registries().get(*ImGui::GetCurrentContext());
+/// @endcode
+#pragma once
+
+#include <imgui_internal.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace imgui_util::detail {
+
+    /**
+     * @brief One default-constructed State per ImGui context, freed when the context shuts down.
+     *
+     * The context_state object itself must outlive every context that used it (a function-local
+     * static is the intended home). UI thread only.
+     */
+    template<typename State>
+    class context_state {
+    public:
+        using frame_fn = void (*)(ImGuiContext &ctx, State &state);
+
+        /// @param frame_hook  Called with each context's state at @p frame_type, or nullptr for none.
+        explicit context_state(const frame_fn             frame_hook = nullptr,
+                               const ImGuiContextHookType frame_type = ImGuiContextHookType_NewFramePre) noexcept
+            : frame_hook_(frame_hook), frame_type_(frame_type) {}
+
+        context_state(const context_state &)            = delete;
+        context_state &operator=(const context_state &) = delete;
+
+        /// @brief State of @p ctx, created (and the context's hooks installed) on first use.
+        [[nodiscard]] State &get(ImGuiContext &ctx) {
+            if (State *s = find(ctx)) return *s;
+            State &state = *entries_.emplace_back(&ctx, std::make_unique<State>()).second;
+
+            ImGuiContextHook hook;
+            hook.UserData = this;
+            if (frame_hook_ != nullptr) {
+                hook.Type     = frame_type_;
+                hook.Callback = &on_frame;
+                ImGui::AddContextHook(&ctx, &hook);
+            }
+            hook.Type     = ImGuiContextHookType_Shutdown;
+            hook.Callback = &on_shutdown;
+            ImGui::AddContextHook(&ctx, &hook);
+            return state;
+        }
+
+        /// @brief State of @p ctx, or nullptr if it never asked for one.
+        [[nodiscard]] State *find(const ImGuiContext &ctx) const noexcept {
+            for (const auto &[owner, state]: entries_)
+                if (owner == &ctx) return state.get();
+            return nullptr;
+        }
+
+    private:
+        static void on_frame(ImGuiContext *ctx, ImGuiContextHook *hook) {
+            const auto *self = static_cast<const context_state *>(hook->UserData);
+            if (State *s = self->find(*ctx)) self->frame_hook_(*ctx, *s);
+        }
+
+        static void on_shutdown(ImGuiContext *ctx, ImGuiContextHook *hook) {
+            std::erase_if(static_cast<context_state *>(hook->UserData)->entries_,
+                          [&](const auto &e) { return e.first == ctx; });
+        }
+
+        frame_fn                                                        frame_hook_;
+        ImGuiContextHookType                                            frame_type_;
+        std::vector<std::pair<ImGuiContext *, std::unique_ptr<State>>> entries_; // stable State addresses
+    };
+
+} // namespace imgui_util::detail
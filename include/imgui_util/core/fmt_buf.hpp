@@ -10,16 +10,377 @@
 ///
 ///   imgui_util::fmt_buf<128> big{"long text: {}", data};  // larger buffer
 /// @endcode
+///
+/// Format strings are analyzed at compile time. Patterns made only of literal text and
+/// simple fields ("{}", "{:08X}", "{:>6}", "{:.2f}", ...) over integers, floats and strings
+/// are written by digit-pair / std::to_chars primitives instead of std::format_to_n, with
+/// identical output; anything else (named or positional arguments, fill characters, custom
+/// formatters, ...) goes through std::format as before.
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <charconv>
+#include <concepts>
 #include <cstdint>
 #include <format>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace imgui_util {
 
+    namespace detail::fmt {
+
+        // ========================================================================
+        // Append primitives (truncating sink, digit-pair decimal, hex, to_chars floats)
+        // ========================================================================
+
+        inline constexpr std::string_view digit_pairs = "00010203040506070809101112131415161718192021222324"
+                                                        "25262728293031323334353637383940414243444546474849"
+                                                        "50515253545556575859606162636465666768697071727374"
+                                                        "75767778798081828384858687888990919293949596979899";
+
+        /// @brief Write @p v in decimal ending at @p end, two digits per step; returns the first char.
+        [[nodiscard]] constexpr char *put_decimal(char *end, std::uint64_t v) noexcept {
+            while (v >= 100) {
+                const auto i = static_cast<std::size_t>(v % 100) * 2;
+                v /= 100;
+                *--end = digit_pairs[i + 1];
+                *--end = digit_pairs[i];
+            }
+            if (v >= 10) {
+                const auto i = static_cast<std::size_t>(v) * 2;
+                *--end       = digit_pairs[i + 1];
+                *--end       = digit_pairs[i];
+            } else {
+                *--end = static_cast<char>('0' + v);
+            }
+            return end;
+        }
+
+        /// @brief Write @p v in hex ending at @p end; returns the first char.
+        [[nodiscard]] constexpr char *put_hex(char *end, std::uint64_t v, const bool upper) noexcept {
+            const std::string_view digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+            do {
+                *--end = digits[v & 0xF];
+                v >>= 4;
+            } while (v != 0);
+            return end;
+        }
+
+        /// @brief Output window that silently drops what does not fit (format_to_n semantics).
+        struct sink {
+            char *out;
+            char *last;
+
+            constexpr void put(const std::string_view s) noexcept {
+                const std::size_t n = std::min(s.size(), static_cast<std::size_t>(last - out));
+                std::copy_n(s.data(), n, out);
+                out += n;
+            }
+            constexpr void pad(const char c, std::size_t n) noexcept {
+                n = std::min(n, static_cast<std::size_t>(last - out));
+                std::fill_n(out, n, c);
+                out += n;
+            }
+        };
+
+        /// @brief Width and alignment of one field (ASCII output only, so width == chars).
+        struct field_layout {
+            unsigned width    = 0;
+            bool     left     = false; ///< '<' alignment; numbers default to right.
+            bool     zero_pad = false; ///< '0' flag: zeros between sign and digits.
+        };
+
+        constexpr void put_padded(sink &s, const std::string_view sign, const std::string_view body,
+                                  const field_layout &f) noexcept {
+            const std::size_t n   = sign.size() + body.size();
+            const std::size_t gap = f.width > n ? f.width - n : 0;
+            if (f.zero_pad) {
+                s.put(sign);
+                s.pad('0', gap);
+                s.put(body);
+            } else if (f.left) {
+                s.put(sign);
+                s.put(body);
+                s.pad(' ', gap);
+            } else {
+                s.pad(' ', gap);
+                s.put(sign);
+                s.put(body);
+            }
+        }
+
+        template<std::integral T>
+        constexpr void put_integer(sink &s, const T v, const field_layout &f, const int base,
+                                   const bool upper) noexcept {
+            bool negative = false;
+            if constexpr (std::is_signed_v<T>) negative = v < 0;
+            const std::uint64_t  mag = negative ? 0 - static_cast<std::uint64_t>(v) : static_cast<std::uint64_t>(v);
+            std::array<char, 24> tmp{};
+            char *const          end   = tmp.data() + tmp.size();
+            const char *const    first = base == 16 ? put_hex(end, mag, upper) : put_decimal(end, mag);
+            put_padded(s, negative ? "-" : "", {first, end}, f);
+        }
+
+        /// @brief std::to_chars fixed (precision >= 0) or shortest (precision < 0) round-trip form.
+        template<std::floating_point T>
+        void put_float(sink &s, const T v, const int precision, const field_layout &f) noexcept {
+            // Fixed double needs at most 1 + 309 + 1 + 64 chars.
+            std::array<char, 400> tmp; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            char *const           end = tmp.data() + tmp.size();
+            const auto            r   = precision >= 0
+                                            ? std::to_chars(tmp.data(), end, v, std::chars_format::fixed, precision)
+                                            : std::to_chars(tmp.data(), end, v);
+            put_padded(s, {}, {tmp.data(), r.ptr}, f);
+        }
+
+        // ========================================================================
+        // Compile-time format-string analysis
+        // ========================================================================
+
+        /// @brief One step of a fast-path plan: literal text or one argument.
+        struct segment {
+            enum class op : std::uint8_t { text, decimal, hex, hex_upper, fixed, shortest, string };
+
+            op            kind      = op::text;
+            std::uint8_t  arg       = 0;
+            std::int8_t   precision = -1;
+            field_layout  layout;
+            std::uint16_t begin = 0; ///< Text: offset into the format string.
+            std::uint16_t size  = 0;
+        };
+
+        /// @brief Result of analyze(): segments to run, or fast == false to use std::format.
+        struct plan {
+            static constexpr std::size_t max_segments = 12;
+
+            std::array<segment, max_segments> segments{};
+            std::uint8_t                      count = 0;
+            bool                              fast  = false;
+        };
+
+        enum class arg_class : std::uint8_t { other, integer, floating, string };
+
+        template<typename T>
+        consteval arg_class classify() {
+            using D = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<D, bool> || std::is_same_v<D, char> || std::is_same_v<D, wchar_t>
+                          || std::is_same_v<D, char8_t> || std::is_same_v<D, char16_t> || std::is_same_v<D, char32_t>)
+                return arg_class::other;
+            else if constexpr (std::is_integral_v<D> && sizeof(D) <= 8)
+                return arg_class::integer;
+            else if constexpr (std::is_same_v<D, float> || std::is_same_v<D, double>)
+                return arg_class::floating;
+            else if constexpr (std::is_same_v<D, std::string_view> || std::is_same_v<D, std::string>
+                               || std::is_same_v<std::decay_t<D>, const char *>
+                               || std::is_same_v<std::decay_t<D>, char *>)
+                return arg_class::string;
+            else
+                return arg_class::other;
+        }
+
+        // [[fill]align]['0'][width]['.' precision][type], restricted to what the primitives reproduce exactly.
+        consteval bool parse_spec(const std::string_view spec, const arg_class cls, segment &seg) {
+            std::size_t j     = 0;
+            char        align = 0;
+            if (spec.size() >= 2 && (spec[1] == '<' || spec[1] == '>' || spec[1] == '^')) {
+                if (spec[0] != ' ') return false; // only the default fill
+                align = spec[1];
+                j     = 2;
+            } else if (!spec.empty() && (spec[0] == '<' || spec[0] == '>' || spec[0] == '^')) {
+                align = spec[0];
+                j     = 1;
+            }
+            if (align == '^') return false;
+
+            bool zero = false;
+            if (j < spec.size() && spec[j] == '0') {
+                zero = true;
+                ++j;
+            }
+            unsigned width = 0;
+            for (; j < spec.size() && spec[j] >= '0' && spec[j] <= '9'; ++j) width = width * 10 + (spec[j] - '0');
+            int precision = -1;
+            if (j < spec.size() && spec[j] == '.') {
+                precision = 0;
+                for (++j; j < spec.size() && spec[j] >= '0' && spec[j] <= '9'; ++j)
+                    precision = precision * 10 + (spec[j] - '0');
+            }
+            if (width > 64 || precision > 64 || spec.size() - j > 1) return false; // sign, '#', 'L', ...
+            const char type = j < spec.size() ? spec[j] : '\0';
+
+            seg.layout = {.width = width, .left = align == '<', .zero_pad = zero && align == 0};
+            switch (cls) {
+                case arg_class::integer:
+                    if (precision >= 0) return false;
+                    if (type == '\0' || type == 'd') seg.kind = segment::op::decimal;
+                    else if (type == 'x') seg.kind = segment::op::hex;
+                    else if (type == 'X') seg.kind = segment::op::hex_upper;
+                    else return false;
+                    return true;
+                case arg_class::floating:
+                    if (zero) return false; // zero padding of inf/nan differs
+                    if (type == 'f') {
+                        seg.kind      = segment::op::fixed;
+                        seg.precision = static_cast<std::int8_t>(precision < 0 ? 6 : precision);
+                        return true;
+                    }
+                    seg.kind = segment::op::shortest;
+                    return type == '\0' && precision < 0;
+                case arg_class::string:
+                    // Strings pad by estimated display width, which is not the byte count for UTF-8.
+                    seg.kind = segment::op::string;
+                    return (type == '\0' || type == 's') && precision < 0 && width == 0 && !zero;
+                case arg_class::other:
+                    break;
+            }
+            return false;
+        }
+
+        /// @brief Split @p f into literal text and fast fields, or return a plan with fast == false.
+        template<typename... Args>
+        consteval plan analyze(const std::string_view f) {
+            constexpr std::array<arg_class, sizeof...(Args)> classes{classify<Args>()...};
+            plan p;
+            if (f.size() > 0xFFFF) return {};
+            auto push = [&](const segment &s) {
+                if (p.count == plan::max_segments) return false;
+                p.segments[p.count++] = s;
+                return true;
+            };
+            auto text = [&](const std::size_t b, const std::size_t e) {
+                segment s;
+                s.begin = static_cast<std::uint16_t>(b);
+                s.size  = static_cast<std::uint16_t>(e - b);
+                return e == b || push(s);
+            };
+
+            std::size_t lit      = 0; // start of pending literal text
+            std::size_t next_arg = 0;
+            for (std::size_t i = 0; i < f.size();) {
+                if (f[i] == '}' || (f[i] == '{' && i + 1 < f.size() && f[i + 1] == '{')) { // "}}" or "{{"
+                    if (!text(lit, i + 1)) return {};
+                    i += 2;
+                    lit = i;
+                    continue;
+                }
+                if (f[i] != '{') {
+                    ++i;
+                    continue;
+                }
+                if (!text(lit, i)) return {};
+                ++i;
+                if (f[i] != '}' && f[i] != ':') return {}; // explicit argument index
+                const std::size_t      close = f.find('}', i);
+                const std::string_view spec  = f[i] == ':' ? f.substr(i + 1, close - i - 1) : std::string_view{};
+                if (spec.find('{') != std::string_view::npos || next_arg >= sizeof...(Args)) return {}; // nested width
+                segment s;
+                s.arg = static_cast<std::uint8_t>(next_arg);
+                if (!parse_spec(spec, classes[next_arg], s) || !push(s)) return {};
+                ++next_arg;
+                i   = close + 1;
+                lit = i;
+            }
+            if (!text(lit, f.size())) return {};
+            p.fast = true;
+            return p;
+        }
+
+        template<typename T>
+        void put_arg(sink &s, const segment &seg, const T &v) noexcept {
+            constexpr arg_class cls = classify<T>();
+            if constexpr (cls == arg_class::integer) {
+                const bool hex = seg.kind != segment::op::decimal;
+                put_integer(s, v, seg.layout, hex ? 16 : 10, seg.kind == segment::op::hex_upper);
+            } else if constexpr (cls == arg_class::floating) {
+                put_float(s, v, seg.kind == segment::op::fixed ? seg.precision : -1, seg.layout);
+            } else if constexpr (cls == arg_class::string) {
+                if constexpr (std::is_pointer_v<T>) s.put(v != nullptr ? std::string_view{v} : "");
+                else s.put(std::string_view{v});
+            }
+        }
+
+        /// @brief Execute a fast plan into [out, out + n); returns the number of chars written.
+        template<typename... Args>
+        std::size_t run(const plan &p, const std::string_view f, char *out, const std::size_t n,
+                        const Args &...args) noexcept {
+            sink                           s{out, out + n};
+            const std::tuple<const Args &...> refs{args...};
+            for (std::size_t k = 0; k < p.count; ++k) {
+                const segment &seg = p.segments[k];
+                if (seg.kind == segment::op::text) {
+                    s.put(f.substr(seg.begin, seg.size));
+                    continue;
+                }
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    ((seg.arg == I ? put_arg(s, seg, std::get<I>(refs)) : void()), ...);
+                }(std::index_sequence_for<Args...>{});
+            }
+            return static_cast<std::size_t>(s.out - out);
+        }
+
+    } // namespace detail::fmt
+
+    /// @brief Format string for runtime_fmt(): checked when formatted, never fast-pathed.
+    struct runtime_fmt_string {
+        std::string_view str;
+    };
+
+    /// @brief Mark a runtime format string for fmt_buf (same as passing std::runtime_format(s)).
+    [[nodiscard]] constexpr runtime_fmt_string runtime_fmt(const std::string_view s) noexcept { return {s}; }
+
+    /// @brief Type returned by std::runtime_format(std::string_view) (unnamed in the standard).
+    using std_runtime_format_string = decltype(std::runtime_format(std::string_view{}));
+
+    /**
+     * @brief std::format_string plus its compile-time fast-path plan.
+     *
+     * Implicitly constructed from string literals (checked like std::format_string), from an
+     * existing std::format_string (forwarded by wrappers; std::format path), or from
+     * std::runtime_format() / runtime_fmt() (std::format path).
+     */
+    template<typename... Args>
+    class basic_fmt_string {
+    public:
+        template<typename S>
+            requires std::convertible_to<const S &, std::string_view>
+        consteval basic_fmt_string(const S &s) // NOLINT(google-explicit-constructor)
+            : fmt_(s), plan_(detail::fmt::analyze<Args...>(std::string_view{s})) {}
+
+        constexpr basic_fmt_string(const std::format_string<Args...> f) noexcept // NOLINT(google-explicit-constructor)
+            : fmt_(f) {}
+
+        basic_fmt_string(const runtime_fmt_string r) noexcept // NOLINT(google-explicit-constructor)
+            : fmt_(std::runtime_format(r.str)) {}
+
+        // std::format_string would be a second user-defined conversion, and the runtime string is
+        // neither copyable nor movable, so the view is read back out of it
+        basic_fmt_string(const std_runtime_format_string &r) noexcept // NOLINT(google-explicit-constructor)
+            : basic_fmt_string(runtime_fmt(view_of(r))) {}
+
+        [[nodiscard]] constexpr std::format_string<Args...> get() const noexcept { return fmt_; }
+        [[nodiscard]] constexpr const detail::fmt::plan    &plan() const noexcept { return plan_; }
+
+    private:
+        std::format_string<Args...> fmt_;
+        detail::fmt::plan           plan_{};
+
+        static std::string_view view_of(const std_runtime_format_string &r) noexcept {
+            // Its only member is the string_view, so the two are pointer-interconvertible
+            static_assert(std::is_standard_layout_v<std_runtime_format_string>
+                          && sizeof(std_runtime_format_string) == sizeof(std::string_view));
+            return *reinterpret_cast<const std::string_view *>(&r);
+        }
+    };
+
+    /// @brief Format string parameter type of fmt_buf (and wrappers that forward to it).
+    template<typename... Args>
+    using fmt_string = basic_fmt_string<std::type_identity_t<Args>...>;
+
     /**
      * @brief Stack-allocated formatted text buffer.
      * @tparam N Buffer capacity in bytes (must be >= 2). Defaults to 64.
@@ -35,8 +396,16 @@ namespace imgui_util {
         /// @brief Construct by formatting into the internal buffer. Truncates on overflow.
         // NOTE: std::format_to_n is constexpr in C++26 (P2510R3) but not in C++23.
         template<typename... Args>
-        constexpr explicit fmt_buf(std::format_string<Args...> fmt, Args &&...args) {
-            auto result = std::format_to_n(buf.data(), N - 1, fmt, std::forward<Args>(args)...);
+        constexpr explicit fmt_buf(fmt_string<Args...> fmt, Args &&...args) {
+            if !consteval {
+                if (fmt.plan().fast) {
+                    len      = static_cast<uint16_t>(
+                        detail::fmt::run(fmt.plan(), fmt.get().get(), buf.data(), N - 1, args...));
+                    buf[len] = '\0';
+                    return;
+                }
+            }
+            auto result = std::format_to_n(buf.data(), N - 1, fmt.get(), std::forward<Args>(args)...);
             len         = static_cast<uint16_t>(result.out - buf.data());
             buf[len]    = '\0';
         }
@@ -61,12 +430,54 @@ namespace imgui_util {
 
         /// @brief Append formatted text to the buffer. Truncates on overflow.
         template<typename... Args>
-        constexpr void append(std::format_string<Args...> fmt, Args &&...args) {
+        constexpr void append(fmt_string<Args...> fmt, Args &&...args) {
             if (len >= N - 1) return;
             const auto remaining = static_cast<std::ptrdiff_t>(N - 1 - len);
-            auto       result    = std::format_to_n(buf.data() + len, remaining, fmt, std::forward<Args>(args)...);
-            len                  = static_cast<uint16_t>(result.out - buf.data());
-            buf[len]             = '\0';
+            if !consteval {
+                if (fmt.plan().fast) {
+                    len += static_cast<uint16_t>(detail::fmt::run(fmt.plan(), fmt.get().get(), buf.data() + len,
+                                                                  static_cast<std::size_t>(remaining), args...));
+                    buf[len] = '\0';
+                    return;
+                }
+            }
+            auto result = std::format_to_n(buf.data() + len, remaining, fmt.get(), std::forward<Args>(args)...);
+            len         = static_cast<uint16_t>(result.out - buf.data());
+            buf[len]    = '\0';
+        }
+
+        /// @brief Append @p s verbatim. Truncates on overflow.
+        constexpr void append_str(const std::string_view s) noexcept {
+            detail::fmt::sink out = tail();
+            out.put(s);
+            finish(out);
+        }
+
+        /**
+         * @brief Append an integer in decimal, as "{:>W}" (or "{:0W}" with @p fill '0', sign first).
+         * @param width Minimum field width; shorter output is padded on the left.
+         * @param fill  ' ' or '0'.
+         */
+        constexpr void append_int(const std::integral auto v, const unsigned width = 0,
+                                  const char fill = ' ') noexcept {
+            detail::fmt::sink out = tail();
+            detail::fmt::put_integer(out, v, {.width = width, .zero_pad = fill == '0'}, 10, false);
+            finish(out);
+        }
+
+        /// @brief Append an integer in zero-padded hex, as "{:0WX}" (or "{:0Wx}").
+        constexpr void append_hex(const std::integral auto v, const unsigned width = 0,
+                                  const bool upper = true) noexcept {
+            detail::fmt::sink out = tail();
+            detail::fmt::put_integer(out, v, {.width = width, .zero_pad = true}, 16, upper);
+            finish(out);
+        }
+
+        /// @brief Append a float in fixed notation, as "{:>W.Pf}".
+        void append_fixed(const std::floating_point auto v, const int precision, const unsigned width = 0) noexcept {
+            detail::fmt::sink out = tail();
+            detail::fmt::put_float(out, v, std::clamp(precision, 0, 64), {.width = width});
+            finish(out);
         }
 
         // Heap-allocating conversion for when you actually need a std::string
@@ -76,6 +487,13 @@ namespace imgui_util {
         [[nodiscard]] constexpr bool operator==(const std::string_view other) const noexcept { return sv() == other; }
         [[nodiscard]] constexpr auto operator<=>(const fmt_buf &o) const noexcept { return sv() <=> o.sv(); }
         [[nodiscard]] constexpr auto operator<=>(const std::string_view o) const noexcept { return sv() <=> o; }
+
+    private:
+        [[nodiscard]] constexpr detail::fmt::sink tail() noexcept { return {buf.data() + len, buf.data() + N - 1}; }
+        constexpr void                            finish(const detail::fmt::sink &out) noexcept {
+            len      = static_cast<uint16_t>(out.out - buf.data());
+            buf[len] = '\0';
+        }
     };
 
     /// @brief Format a count with K/M suffixes (e.g. 1500 -> "1.5K", 2000000 -> "2.0M").
@@ -0,0 +1,158 @@
+/// @file label_id.hpp
+/// @brief Compile-time hashed ImGui labels: "##entries"_id.
+///
+/// ImGui turns every string label into an ID by running CRC32 over it, seeded with the top of
+/// the window's ID stack, on every call. For a label known at compile time only the seed is
+/// unknown, and CRC32 is linear: hash(seed, label) = shift_n(~seed) ^ crc(0, label), where
+/// shift_n advances the CRC register over n zero bytes. label_id precomputes crc(0, label)
+/// and points at a table form of shift_n (4 x 256 entries, one set per distinct label
+/// length), so resolving the ID is four lookups instead of one dependent lookup per byte.
+/// The result is bit-identical to ImGui::GetID(label), including the "###" rule.
+///
+/// Usage:
+/// @code
+///   using namespace imgui_util::literals;
+///   if (imgui_util::child c{"##entries"_id, ImVec2(0, 0), ImGuiChildFlags_Borders}) { ... }
+///   { imgui_util::id scope{"##row"_id}; ... }
+///   ImGui::OpenPopup(imgui_util::get_id("##menu"_id));
+/// @endcode
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <imgui.h>
+#include <string_view>
+
+namespace imgui_util {
+
+    namespace detail {
+
+        /// @brief CRC32 (0xEDB88320) byte table, identical to ImGui's GCrc32LookupTable.
+        inline constexpr auto crc32_lut = [] {
+            std::array<std::uint32_t, 256> t{};
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                std::uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1u) != 0 ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+                t[i] = c;
+            }
+            return t;
+        }();
+
+        constexpr std::uint32_t crc32_step(const std::uint32_t crc, const unsigned char c) noexcept {
+            return (crc >> 8) ^ crc32_lut[(crc & 0xFFu) ^ c];
+        }
+
+        /// @brief Start of the part of @p label ImGui hashes: the last "###", or 0.
+        constexpr std::size_t hashed_offset(const std::string_view label) noexcept {
+            const std::size_t p = label.rfind("###");
+            return p == std::string_view::npos ? 0 : p;
+        }
+
+        /// @brief shift_n split by input byte: t[k][b] = register b << 8k advanced over n zero bytes.
+        using crc32_shift = std::array<std::array<std::uint32_t, 256>, 4>;
+
+        template<std::size_t N>
+        inline constexpr crc32_shift crc32_shift_v = [] {
+            crc32_shift t{};
+            for (std::size_t k = 0; k < 4; ++k) {
+                for (std::uint32_t b = 0; b < 256; ++b) {
+                    std::uint32_t crc = b << (8 * k);
+                    for (std::size_t i = 0; i < N; ++i) crc = crc32_step(crc, 0);
+                    t[k][b] = crc;
+                }
+            }
+            return t;
+        }();
+
+        /// @brief Structural string literal wrapper so labels can be template arguments.
+        template<std::size_t N>
+        struct label_chars {
+            char str[N]{};
+
+            consteval label_chars(const char (&s)[N]) noexcept { // NOLINT(google-explicit-constructor)
+                for (std::size_t i = 0; i < N; ++i) str[i] = s[i];
+            }
+
+            [[nodiscard]] constexpr std::string_view view() const noexcept { return {str, N - 1}; }
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief ImGui-compatible label hash (same result as ImHashStr(label, size, seed)).
+     *
+     * Runtime reference for label_id; also usable in constant expressions.
+     */
+    [[nodiscard]] constexpr ImGuiID hash_label(const std::string_view label, const ImGuiID seed = 0) noexcept {
+        const std::uint32_t start = ~seed;
+        std::uint32_t       crc   = start;
+        for (std::size_t i = 0; i < label.size(); ++i) {
+            if (label[i] == '#' && label.size() - i > 2 && label[i + 1] == '#' && label[i + 2] == '#') crc = start;
+            crc = detail::crc32_step(crc, static_cast<unsigned char>(label[i]));
+        }
+        return ~crc;
+    }
+
+    /**
+     * @brief Static label with its seed-independent hash precomputed.
+     *
+     * Created only at compile time (via "..."_id or label_id::of<"...">()); trivially copyable
+     * and meant to be passed by value.
+     */
+    class label_id {
+    public:
+        template<detail::label_chars S>
+        [[nodiscard]] static consteval label_id of() noexcept {
+            constexpr std::string_view label = S.view();
+            constexpr std::string_view tail  = label.substr(detail::hashed_offset(label));
+            std::uint32_t              key   = 0;
+            for (const char c: tail) key = detail::crc32_step(key, static_cast<unsigned char>(c));
+            return label_id{S.str, static_cast<std::uint32_t>(label.size()), key, &detail::crc32_shift_v<tail.size()>};
+        }
+
+        /// @brief ID of this label under @p seed (the top of the ID stack); equals hash_label(view(), seed).
+        [[nodiscard]] constexpr ImGuiID id(const ImGuiID seed) const noexcept {
+            const std::uint32_t        s = ~seed;
+            const detail::crc32_shift &t = *shift_;
+            return ~(t[0][s & 0xFFu] ^ t[1][(s >> 8) & 0xFFu] ^ t[2][(s >> 16) & 0xFFu] ^ t[3][s >> 24] ^ key_);
+        }
+
+        /// @brief Null-terminated label text (for display and for APIs that also take the name).
+        [[nodiscard]] constexpr const char      *c_str() const noexcept { return str_; }
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {str_, size_}; }
+
+    private:
+        consteval label_id(const char *str, const std::uint32_t size, const std::uint32_t key,
+                           const detail::crc32_shift *shift) noexcept :
+            str_(str), size_(size), key_(key), shift_(shift) {}
+
+        const char                *str_;
+        std::uint32_t              size_;
+        std::uint32_t              key_; // CRC register after the hashed part, starting from 0
+        const detail::crc32_shift *shift_;
+    };
+
+    inline namespace literals {
+        /// @brief "##name"_id: compile-time hashed label for id, child, tree_node and table scopes.
+        template<detail::label_chars S>
+        consteval label_id operator""_id() noexcept {
+            return label_id::of<S>();
+        }
+    } // namespace literals
+
+    /// @brief ImGui::GetID() for a precomputed label: one combine with the current ID-stack seed.
+    [[nodiscard]] ImGuiID get_id(label_id label) noexcept;
+
+    namespace detail {
+        // Precomputed-ID counterparts of PushID / BeginChild / TreeNodeEx / BeginTable, used by the
+        // raii traits. Defined out of line so raii.hpp stays free of imgui_internal.h.
+        void push_id(label_id label) noexcept;
+        bool begin_child(label_id label, const ImVec2 &size, ImGuiChildFlags child_flags,
+                         ImGuiWindowFlags window_flags) noexcept;
+        bool tree_node(label_id label, ImGuiTreeNodeFlags flags) noexcept;
+        bool begin_table(label_id label, int columns, ImGuiTableFlags flags, const ImVec2 &outer_size,
+                         float inner_width) noexcept;
+    } // namespace detail
+
+} // namespace imgui_util
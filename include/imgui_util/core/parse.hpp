@@ -9,19 +9,31 @@
 ///   float f = imgui_util::parse::parse_float("bad", -1); // -1 (default on error)
 ///   auto opt = imgui_util::parse::try_parse_int("123");  // std::optional<int>{123}
 ///   ImVec4 c = imgui_util::parse::parse_vec4("1.0, 0.5, 0.0, 1.0");
+///
+///   std::vector<double> table(imgui_util::parse::count_tokens(csv_text));
+///   auto r = imgui_util::parse::parse_numbers(csv_text, std::span{table}); // r.error: offset of a bad token
 /// @endcode
+///
+/// The bulk functions (for_each_token, parse_numbers, for_each_config_entry) find token
+/// and line boundaries with SIMD byte scanners, 32 bytes at a time; in constant evaluation
+/// they fall back to the scalar loop, which is the reference the scanners are tested against.
 #pragma once
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <charconv>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <imgui.h>
 #include <optional>
 #include <span>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace imgui_util::parse {
 
@@ -163,6 +175,140 @@ namespace imgui_util::parse {
         return i;
     }
 
+    // ========================================================================
+    // Bulk parsing
+    // ========================================================================
+
+    namespace detail {
+
+        /// @brief Token separators for the bulk functions: @p delim plus space, tab, CR and LF.
+        [[nodiscard]] constexpr bool is_separator(const char c, const char delim) noexcept {
+            return c == delim || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        /// @brief Bytes classified per separator_bits() call (bitmap kept on the stack).
+        inline constexpr std::size_t scan_block = 4096;
+
+        /**
+         * @brief Separator bitmap of @p block: bit b of out[w] is set if byte 32 * w + b is a separator.
+         *
+         * Bits past the end of @p block are set. @p block is at most scan_block bytes and
+         * @p out holds at least (block.size() + 31) / 32 words.
+         */
+        void separator_bits(std::string_view block, char delim, std::span<std::uint32_t> out) noexcept;
+
+    } // namespace detail
+
+    /// @brief Name of the compiled separator scanner: "avx2", "sse2" or "scalar".
+    [[nodiscard]] std::string_view scan_backend() noexcept;
+
+    /**
+     * @brief Invoke fn(token, offset) for every run of non-separator bytes in @p sv.
+     *
+     * Separators are @p delim, space, tab, CR and LF; runs of them (and so empty fields)
+     * produce no token. Returning false from @p fn stops the scan.
+     * @param sv    Input text.
+     * @param delim Field delimiter in addition to whitespace.
+     * @param fn    Callback invoked as bool fn(std::string_view token, size_t offset).
+     * @return Number of tokens passed to @p fn.
+     */
+    template<typename Fn>
+        requires std::is_invocable_r_v<bool, Fn &, std::string_view, std::size_t>
+    constexpr std::size_t for_each_token(const std::string_view sv, const char delim, Fn fn) {
+        std::size_t count = 0;
+        auto        emit  = [&](const std::size_t first, const std::size_t last) {
+            ++count;
+            return static_cast<bool>(fn(sv.substr(first, last - first), first));
+        };
+
+        if consteval {
+            for (std::size_t i = 0; i < sv.size();) {
+                if (detail::is_separator(sv[i], delim)) {
+                    ++i;
+                    continue;
+                }
+                const std::size_t first = i;
+                while (i < sv.size() && !detail::is_separator(sv[i], delim)) ++i;
+                if (!emit(first, i)) break;
+            }
+        } else {
+            // Walk the separator bitmap: ctz of ~bits finds a token start, ctz of bits its end.
+            std::array<std::uint32_t, detail::scan_block / 32> bits; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            std::size_t first = std::string_view::npos;
+            for (std::size_t base = 0; base < sv.size(); base += detail::scan_block) {
+                const std::string_view block = sv.substr(base, detail::scan_block);
+                const std::size_t      words = (block.size() + 31) / 32;
+                detail::separator_bits(block, delim, bits);
+                for (std::size_t w = 0; w < words; ++w) {
+                    const std::uint32_t sep = bits[w];
+                    const std::size_t   at  = base + 32 * w;
+                    for (unsigned bit = 0; bit < 32;) {
+                        if (first == std::string_view::npos) {
+                            const std::uint32_t tok = ~sep >> bit;
+                            if (tok == 0) break;
+                            bit += static_cast<unsigned>(std::countr_zero(tok));
+                            first = at + bit;
+                        }
+                        const std::uint32_t end = sep >> bit;
+                        if (end == 0) break; // token continues into the next word
+                        bit += static_cast<unsigned>(std::countr_zero(end));
+                        if (!emit(first, std::min(at + bit, sv.size()))) return count;
+                        first = std::string_view::npos;
+                    }
+                }
+            }
+            if (first != std::string_view::npos) emit(first, sv.size());
+        }
+        return count;
+    }
+
+    /// @brief Number of tokens for_each_token() would report (to size a parse_numbers() buffer).
+    [[nodiscard]] constexpr std::size_t count_tokens(const std::string_view sv, const char delim = ',') {
+        return for_each_token(sv, delim, [](std::string_view, std::size_t) { return true; });
+    }
+
+    /// @brief Outcome of a bulk parse.
+    struct bulk_result {
+        std::size_t count = 0;                      ///< Values written to the output span.
+        std::size_t next  = 0;                      ///< Offset of the first unparsed token (input size when done).
+        std::size_t error = std::string_view::npos; ///< Offset of the first malformed token, or npos.
+
+        [[nodiscard]] constexpr bool ok() const noexcept { return error == std::string_view::npos; }
+    };
+
+    /**
+     * @brief Parse every delimited number in @p sv into @p out.
+     *
+     * Tokens are split as in for_each_token() and converted with std::from_chars; a token
+     * that is not entirely a number stops the parse and is reported in bulk_result::error.
+     * When @p out fills up, bulk_result::next is where to resume.
+     * @tparam T    Arithmetic type (constexpr for integral types only).
+     * @param sv    Input text, e.g. a CSV table or a whitespace-separated list.
+     * @param out   Destination.
+     * @param delim Field delimiter in addition to whitespace.
+     */
+    template<parseable_arithmetic T, std::size_t N>
+    [[nodiscard]] constexpr bulk_result parse_numbers(const std::string_view sv, const std::span<T, N> out,
+                                                      const char delim = ',') noexcept {
+        bulk_result r{.next = sv.size()};
+        for_each_token(sv, delim, [&](const std::string_view token, const std::size_t offset) {
+            if (r.count == out.size()) {
+                r.next = offset;
+                return false;
+            }
+            const auto *const end = token.data() + token.size();
+            const auto [ptr, ec]  = std::from_chars(token.data(), end, out[r.count]);
+            if (ec != std::errc() || ptr != end) { // NOLINT(clang-analyzer-optin.core.EnumCastOutOfRange)
+                r.error = offset;
+                r.next  = offset;
+                return false;
+            }
+            ++r.count;
+            return true;
+        });
+        return r;
+    }
+
     /**
      * @brief Parse N comma-separated float components into a fixed-size span.
      *
@@ -248,4 +394,210 @@ namespace imgui_util::parse {
         return IM_COL32(components[0], components[1], components[2], components[3]);
     }
 
+    // ========================================================================
+    // key=value config files
+    // ========================================================================
+
+    /// @brief One "key=value" line; views into the config text.
+    struct config_entry {
+        std::string_view key;
+        std::string_view value;    ///< Everything after the first '=', minus a trailing CR.
+        std::size_t      line = 0; ///< 1-based line number.
+    };
+
+    namespace detail {
+
+        /**
+         * @brief LF and '=' bitmaps of @p block, one bit per byte (bit b of word w is byte 32 * w + b).
+         *
+         * Bits past the end of @p block are clear. Same size limits as separator_bits().
+         */
+        void line_bits(std::string_view block, std::span<std::uint32_t> newlines,
+                       std::span<std::uint32_t> equals) noexcept;
+
+        constexpr config_entry make_entry(const std::string_view text, const std::size_t first, const std::size_t eq,
+                                          std::size_t last, const std::size_t line) noexcept {
+            if (last > eq + 1 && text[last - 1] == '\r') --last;
+            return {text.substr(first, eq - first), text.substr(eq + 1, last - eq - 1), line};
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Invoke fn(entry) for every line of @p text that contains '='.
+     *
+     * The key is everything before the first '=' and is not trimmed; lines without '=' are
+     * skipped. Nothing is allocated; entries view @p text.
+     * @param text Whole config file contents (see read_text_file()).
+     * @param fn   Callback invoked as fn(const config_entry &).
+     * @return Number of entries passed to @p fn.
+     */
+    template<typename Fn>
+        requires std::invocable<Fn &, const config_entry &>
+    constexpr std::size_t for_each_config_entry(const std::string_view text, Fn fn) {
+        std::size_t count    = 0;
+        std::size_t first    = 0;
+        std::size_t eq       = std::string_view::npos;
+        std::size_t line     = 1;
+        auto        end_line = [&](const std::size_t last) {
+            if (eq != std::string_view::npos) {
+                fn(detail::make_entry(text, first, eq, last, line));
+                ++count;
+            }
+            first = last + 1;
+            eq    = std::string_view::npos;
+            ++line;
+        };
+
+        if consteval {
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                if (text[i] == '\n') end_line(i);
+                else if (text[i] == '=' && eq == std::string_view::npos) eq = i;
+            }
+        } else {
+            // Per word: each LF closes a line; the lowest '=' bit below it (if the line has none
+            // yet) is its separator. '=' bits left after the last LF carry into the next word.
+            std::array<std::uint32_t, detail::scan_block / 32> nl_bits; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            std::array<std::uint32_t, detail::scan_block / 32> eq_bits; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (std::size_t base = 0; base < text.size(); base += detail::scan_block) {
+                const std::string_view block = text.substr(base, detail::scan_block);
+                const std::size_t      words = (block.size() + 31) / 32;
+                detail::line_bits(block, nl_bits, eq_bits);
+                for (std::size_t w = 0; w < words; ++w) {
+                    const std::size_t at = base + 32 * w;
+                    std::uint32_t     nl = nl_bits[w];
+                    std::uint32_t     es = eq_bits[w];
+                    while (nl != 0) {
+                        const auto          bit   = static_cast<unsigned>(std::countr_zero(nl));
+                        const std::uint32_t below = (1u << bit) - 1;
+                        if (eq == std::string_view::npos && (es & below) != 0)
+                            eq = at + static_cast<unsigned>(std::countr_zero(es & below));
+                        end_line(at + bit);
+                        es &= ~((2u << bit) - 1); // drop '=' up to and including this LF (bit 31: 2u << 31 == 0)
+                        nl &= nl - 1;
+                    }
+                    if (eq == std::string_view::npos && es != 0) eq = at + static_cast<unsigned>(std::countr_zero(es));
+                }
+            }
+        }
+        if (first < text.size()) end_line(text.size()); // last line without a trailing LF
+        return count;
+    }
+
+    /**
+     * @brief Read a whole file into one string (a single allocation and read).
+     * @return File contents, or nullopt if it cannot be opened or read.
+     */
+    [[nodiscard]] std::optional<std::string> read_text_file(const std::filesystem::path &path);
+
+    /// @brief Parse @p value into @p out via try_parse; @p out is untouched on failure.
+    template<parseable_arithmetic T>
+    [[nodiscard]] constexpr bool bind_value(const std::string_view value, T &out) noexcept {
+        if (const auto v = try_parse<T>(value)) {
+            out = *v;
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief "true"/"false"/"1"/"0" into @p out.
+    [[nodiscard]] constexpr bool bind_value(const std::string_view value, bool &out) noexcept {
+        if (const auto v = parse_bool(value)) {
+            out = *v;
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Copy @p value into @p out (the only binding that allocates).
+    [[nodiscard]] inline bool bind_value(const std::string_view value, std::string &out) {
+        out.assign(value);
+        return true;
+    }
+
+    /// @brief "x, y" into @p out; components that fail to parse keep their value.
+    [[nodiscard]] constexpr bool bind_value(const std::string_view value, ImVec2 &out) noexcept {
+        std::array c = {out.x, out.y};
+        if (!parse_float_components<2>(value, std::span{c})) return false;
+        out = {c[0], c[1]};
+        return true;
+    }
+
+    /// @brief "x, y, z, w" into @p out; components that fail to parse keep their value.
+    [[nodiscard]] constexpr bool bind_value(const std::string_view value, ImVec4 &out) noexcept {
+        std::array c = {out.x, out.y, out.z, out.w};
+        if (!parse_float_components<4>(value, std::span{c})) return false;
+        out = {c[0], c[1], c[2], c[3]};
+        return true;
+    }
+
+    /// @brief Types bind_value() accepts.
+    template<typename T>
+    concept config_bindable = requires(std::string_view v, T &out) {
+        { bind_value(v, out) } -> std::same_as<bool>;
+    };
+
+    /**
+     * @brief Table of key -> typed variable bindings applied to config entries.
+     *
+     * Usage:
+     * @code
+     *   parse::config_binder settings;
+     *   settings.bind("font_size", cfg.font_size).bind("vsync", cfg.vsync).bind("window_pos", cfg.window_pos);
+     *   if (auto text = parse::read_text_file("tool.ini")) settings.load(*text);
+     * @endcode
+     * Keys and targets are referenced, not copied, and must outlive the binder.
+     */
+    class config_binder {
+    public:
+        /// @brief Counts from one load().
+        struct load_result {
+            std::size_t applied      = 0; ///< Entries whose value was parsed into a bound variable.
+            std::size_t unknown      = 0; ///< Entries with no binding for their key.
+            std::size_t invalid      = 0; ///< Bound entries whose value failed to parse.
+            std::size_t invalid_line = 0; ///< Line of the first invalid entry (0 if none).
+        };
+
+        /// @brief Bind @p key to @p target (rebinding a key replaces the earlier target).
+        template<config_bindable T>
+        config_binder &bind(const std::string_view key, T &target) {
+            const binding b{key, &target,
+                            [](const std::string_view v, void *p) { return bind_value(v, *static_cast<T *>(p)); }};
+            const auto    it = std::ranges::lower_bound(bindings_, key, {}, &binding::key);
+            if (it != bindings_.end() && it->key == key) *it = b;
+            else bindings_.insert(it, b);
+            return *this;
+        }
+
+        /// @brief Apply one entry: nullopt for an unknown key, else whether the value parsed.
+        [[nodiscard]] std::optional<bool> apply(const config_entry &e) const {
+            const auto it = std::ranges::lower_bound(bindings_, e.key, {}, &binding::key);
+            if (it == bindings_.end() || it->key != e.key) return std::nullopt;
+            return it->assign(e.value, it->target);
+        }
+
+        /// @brief Apply every entry of a whole config text.
+        load_result load(const std::string_view text) const {
+            load_result r;
+            for_each_config_entry(text, [&](const config_entry &e) {
+                const auto ok = apply(e);
+                if (!ok) r.unknown++;
+                else if (*ok) r.applied++;
+                else if (r.invalid++ == 0) r.invalid_line = e.line;
+            });
+            return r;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return bindings_.size(); }
+
+    private:
+        struct binding {
+            std::string_view key;
+            void            *target = nullptr;
+            bool (*assign)(std::string_view, void *) = nullptr;
+        };
+
+        std::vector<binding> bindings_; // sorted by key
+    };
+
 } // namespace imgui_util::parse
@@ -10,6 +10,7 @@
 ///   if (imgui_util::tab_bar tb{"Tabs"}) { ... }
 ///   { imgui_util::style_var sv{ImGuiStyleVar_Alpha, 0.5f}; ... }
 ///   { imgui_util::id scope{"my_id"}; ... }
+///   if (imgui_util::child c{"##list"_id}) { ... } // label hashed at compile time (label_id.hpp)
 /// @endcode
 #pragma once
 
@@ -21,6 +22,8 @@
 #include <utility>
 #include <variant>
 
+#include "imgui_util/core/label_id.hpp"
+
 namespace imgui_util {
 
     /**
@@ -207,6 +210,10 @@ namespace imgui_util {
                           const ImGuiWindowFlags window_flags = 0) noexcept {
             return ImGui::BeginChild(id, size, child_flags, window_flags);
         }
+        static bool begin(const label_id id, const ImVec2 &size = ImVec2(0, 0), const ImGuiChildFlags child_flags = 0,
+                          const ImGuiWindowFlags window_flags = 0) noexcept {
+            return detail::begin_child(id, size, child_flags, window_flags);
+        }
         static void end() noexcept { ImGui::EndChild(); }
     };
 
@@ -248,6 +255,9 @@ namespace imgui_util {
         static bool begin(const char *label, const ImGuiTreeNodeFlags flags = 0) noexcept {
             return ImGui::TreeNodeEx(label, flags);
         }
+        static bool begin(const label_id label, const ImGuiTreeNodeFlags flags = 0) noexcept {
+            return detail::tree_node(label, flags);
+        }
         static void end() noexcept { ImGui::TreePop(); }
     };
 
@@ -282,6 +292,10 @@ namespace imgui_util {
                           const ImVec2 &outer_size = ImVec2(0, 0), const float inner_width = 0.0f) noexcept {
             return ImGui::BeginTable(id, columns, flags, outer_size, inner_width);
         }
+        static bool begin(const label_id id, const int columns, const ImGuiTableFlags flags = 0,
+                          const ImVec2 &outer_size = ImVec2(0, 0), const float inner_width = 0.0f) noexcept {
+            return detail::begin_table(id, columns, flags, outer_size, inner_width);
+        }
         static void end() noexcept { ImGui::EndTable(); }
     };
 
@@ -307,6 +321,7 @@ namespace imgui_util {
         static void begin(const char *str_id) noexcept { ImGui::PushID(str_id); }
         static void begin(const int int_id) noexcept { ImGui::PushID(int_id); }
         static void begin(const void *ptr_id) noexcept { ImGui::PushID(ptr_id); }
+        static void begin(const label_id label) noexcept { detail::push_id(label); }
         static void end() noexcept { ImGui::PopID(); }
     };
 
@@ -0,0 +1,100 @@
+/// @file text_metrics.hpp
+/// @brief Retained text-size cache for labels that are drawn every frame.
+///
+/// ImGui measures text from scratch on every call: UTF-8 decode and one glyph lookup per
+/// character. Widgets that lay out the same labels every frame (tags, timeline events,
+/// toolbar and status bar text) ask this cache instead. Entries are keyed by
+/// (font, font size, text) with a 64-bit hash for lookup and the text stored for an
+/// exact match, bounded by an LRU policy. The shared instance() is cleared automatically
+/// when the font atlas of a context using it changes (rebuilt, fonts added or removed),
+/// detected once per frame; each context's atlas is tracked separately.
+///
+/// Usage:
+/// @code
+///   const ImVec2 sz = imgui_util::calc_text_size(tag);      // shared cache, current font
+///   imgui_util::text_metrics_cache local{256};              // private cache
+///   const ImVec2 sz2 = local.measure(font, 18.0f, label);
+/// @endcode
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <imgui.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace imgui_util {
+
+    /**
+     * @brief LRU cache of ImGui::CalcTextSize results.
+     *
+     * measure() returns exactly what ImGui::CalcTextSize(text) returns for the given font and
+     * size (no "##" hiding, no wrapping). UI thread only.
+     */
+    class text_metrics_cache {
+    public:
+        explicit text_metrics_cache(std::size_t capacity = 2048);
+
+        /// @brief Size of @p text in @p font at @p size, measured on a miss.
+        [[nodiscard]] ImVec2 measure(ImFont *font, float size, std::string_view text);
+
+        /// @brief measure() with the current font and font size.
+        [[nodiscard]] ImVec2 measure(std::string_view text);
+
+        /**
+         * @brief Clear the cache if the fonts in @p atlas changed since the last call.
+         * @return True if entries were dropped.
+         */
+        bool sync(const ImFontAtlas &atlas) noexcept;
+
+        void clear() noexcept;
+
+        /// @brief Change the entry bound; shrinking drops the least recently used entries.
+        void set_capacity(std::size_t capacity);
+
+        [[nodiscard]] std::size_t   size() const noexcept { return entries_.size(); }
+        [[nodiscard]] std::size_t   capacity() const noexcept { return capacity_; }
+        [[nodiscard]] std::uint64_t hits() const noexcept { return hits_; }
+        [[nodiscard]] std::uint64_t misses() const noexcept { return misses_; }
+
+        /// @brief Library-wide cache; checked against each using context's atlas at the start of its frames.
+        [[nodiscard]] static text_metrics_cache &instance();
+
+    private:
+        static constexpr std::uint32_t none = ~std::uint32_t{0};
+
+        struct entry {
+            ImFont       *font = nullptr;
+            float         size = 0.0f;
+            std::uint64_t key  = 0;
+            std::string   text;
+            ImVec2        extent;
+            std::uint32_t prev = none; // toward most recently used
+            std::uint32_t next = none; // toward least recently used
+        };
+
+        void unlink(std::uint32_t i) noexcept;
+        void push_front(std::uint32_t i) noexcept;
+        void evict_back();
+
+        std::vector<entry>                               entries_;
+        std::unordered_map<std::uint64_t, std::uint32_t> index_; // key -> entry
+        std::uint32_t                                    head_        = none;
+        std::uint32_t                                    tail_        = none;
+        std::size_t                                      capacity_    = 0;
+        std::uint64_t                                    fingerprint_ = 0;
+        std::uint64_t                                    hits_        = 0;
+        std::uint64_t                                    misses_      = 0;
+    };
+
+    /// @brief ImGui::CalcTextSize(text) through the shared text_metrics_cache.
+    [[nodiscard]] inline ImVec2 calc_text_size(const std::string_view text) {
+        return text_metrics_cache::instance().measure(text);
+    }
+
+    /// @brief ImGui::TextUnformatted() laid out with the cached size of @p text.
+    void text_unformatted_cached(std::string_view text);
+
+} // namespace imgui_util
@@ -10,10 +10,16 @@
 #include "imgui_util/layout/helpers.hpp"
 #include "imgui_util/layout/presets.hpp"
 #include "imgui_util/table/table_builder.hpp"
+#include "imgui_util/theme/color_batch.hpp"
 #include "imgui_util/theme/color_math.hpp"
+#include "imgui_util/theme/contrast.hpp"
 #include "imgui_util/theme/dynamic_colors.hpp"
+#include "imgui_util/theme/overlay.hpp"
+#include "imgui_util/theme/palette.hpp"
 #include "imgui_util/theme/theme.hpp"
 #include "imgui_util/theme/theme_manager.hpp"
+#include "imgui_util/theme/theme_watcher.hpp"
+#include "imgui_util/theme/transition.hpp"
 #include "imgui_util/widgets.hpp"
 // Note: plot/raii.hpp is intentionally excluded — ImPlot is an optional dependency.
 // Include "imgui_util/plot/raii.hpp" directly if ImPlot is available in your build.
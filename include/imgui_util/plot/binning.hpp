@@ -0,0 +1,53 @@
+/// @file binning.hpp
+/// @brief Uniform bin axis and batch bin-index kernels (SSE2 / AVX2, scalar fallback).
+///
+/// bin_axis::index() is the constexpr scalar reference; bin_indices() computes the same
+/// indices for a whole span, 2 (SSE2) or 4 (AVX2) samples per instruction, and matches the
+/// reference exactly (both compute in double). Used by the histograms in histogram.hpp.
+///
+/// Usage:
+/// @code
+///   constexpr implot::bin_axis axis{0.0, 100.0, 50};
+///   static_assert(axis.index(42.0) == 21);
+///   std::array<std::int32_t, 256> idx;
+///   implot::bin_indices(samples.first(256), axis, idx); // -1 for samples outside [min, max]
+/// @endcode
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace imgui_util::implot {
+
+    /// @brief @p bins equal-width bins over [min, max]; max itself falls in the last bin.
+    struct bin_axis {
+        double min  = 0.0;
+        double max  = 1.0;
+        int    bins = 1;
+
+        [[nodiscard]] constexpr double width() const noexcept { return (max - min) / bins; }
+        [[nodiscard]] constexpr double scale() const noexcept { return bins / (max - min); }
+        [[nodiscard]] constexpr double edge(const int i) const noexcept { return min + i * width(); }
+        [[nodiscard]] constexpr double center(const int i) const noexcept { return min + (i + 0.5) * width(); }
+
+        /// @brief Bin of @p x, or -1 if x is outside [min, max] or NaN (reference for bin_indices()).
+        [[nodiscard]] constexpr int index(const double x) const noexcept {
+            if (!(x >= min && x <= max)) return -1;
+            return static_cast<int>(std::min((x - min) * scale(), bins - 1.0));
+        }
+
+        constexpr bool operator==(const bin_axis &) const = default;
+    };
+
+    /// @brief Name of the compiled kernel set: "avx2", "sse2" or "scalar".
+    [[nodiscard]] std::string_view binning_backend() noexcept;
+
+    /// @brief out[i] = axis.index(in[i]) for i < min(in.size(), out.size()).
+    void bin_indices(std::span<const float> in, const bin_axis &axis, std::span<std::int32_t> out) noexcept;
+    /// @copydoc bin_indices(std::span<const float>, const bin_axis &, std::span<std::int32_t>)
+    void bin_indices(std::span<const double> in, const bin_axis &axis, std::span<std::int32_t> out) noexcept;
+
+} // namespace imgui_util::implot
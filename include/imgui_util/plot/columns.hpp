@@ -0,0 +1,259 @@
+/// @file columns.hpp
+/// @brief Columnar plot store: one shared x column, N y columns, decimated together.
+///
+/// Dashboards often plot dozens of series against the same timestamps. Plotting each one as
+/// its own xy_series duplicates the x array, repeats the visible-range binary search per
+/// series, and re-reads x in every decimation pass. shared_x_store keeps x once and the y
+/// columns as separate contiguous arrays (structure of arrays). Per view change, x is
+/// searched once and swept once into pixel-column buckets; every y column is then reduced
+/// against those buckets with a contiguous sweep that never touches x again.
+///
+/// Usage:
+/// @code
+///   implot::shared_x_store<double, float> store{labels.size()};
+///   store.push_row(t, row_values);           // one value per column
+///   implot::shared_x_cache cache;            // kept across frames
+///   if (implot::plot p{"Dashboard"}) implot::plot_lines_shared_x(labels, store, cache);
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <implot.h>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "imgui_util/plot/decimate.hpp"
+
+namespace imgui_util::implot {
+
+    /**
+     * @brief Append-only table of rows (x, y_0 .. y_{n-1}) stored column by column.
+     * @tparam X Arithmetic x type (non-decreasing across rows).
+     * @tparam Y Arithmetic y type shared by all columns.
+     */
+    template<typename X = double, typename Y = float>
+        requires std::is_arithmetic_v<X> && std::is_arithmetic_v<Y>
+    class shared_x_store {
+    public:
+        explicit shared_x_store(const std::size_t columns) : ys_(columns) {}
+
+        void reserve(const std::size_t rows) {
+            xs_.reserve(rows);
+            for (auto &c: ys_) c.reserve(rows);
+        }
+
+        /// @brief Append one row; missing trailing values are NaN (0 for integral Y), extra ones are ignored.
+        void push_row(const X x, const std::span<const Y> values) {
+            xs_.push_back(x);
+            for (std::size_t j = 0; j < ys_.size(); ++j) ys_[j].push_back(j < values.size() ? values[j] : missing());
+            ++version_;
+        }
+
+        /**
+         * @brief Append a block of rows given column-wise.
+         * @param xs      New x values.
+         * @param columns One span per y column, each at least xs.size() long (shorter ones are NaN-padded).
+         */
+        void append(const std::span<const X> xs, const std::span<const std::span<const Y>> columns) {
+            xs_.insert(xs_.end(), xs.begin(), xs.end());
+            for (std::size_t j = 0; j < ys_.size(); ++j) {
+                const std::span<const Y> c = j < columns.size() ? columns[j] : std::span<const Y>{};
+                const std::size_t        n = std::min(c.size(), xs.size());
+                ys_[j].insert(ys_[j].end(), c.begin(), c.begin() + static_cast<std::ptrdiff_t>(n));
+                ys_[j].resize(xs_.size(), missing());
+            }
+            ++version_;
+        }
+
+        void clear() noexcept {
+            xs_.clear();
+            for (auto &c: ys_) c.clear();
+            ++version_;
+        }
+
+        [[nodiscard]] std::size_t        size() const noexcept { return xs_.size(); }
+        [[nodiscard]] std::size_t        columns() const noexcept { return ys_.size(); }
+        [[nodiscard]] std::span<const X> xs() const noexcept { return xs_; }
+        [[nodiscard]] std::span<const Y> ys(const std::size_t column) const noexcept { return ys_[column]; }
+
+        /// @brief Column @p column as a plot_series (for the single-series helpers in decimate.hpp).
+        [[nodiscard]] xy_series<X, Y> series(const std::size_t column) const noexcept {
+            return {xs_, ys_[column]};
+        }
+
+        /// @brief Bumped by every mutation; used as the cache key.
+        [[nodiscard]] std::uint64_t version() const noexcept { return version_; }
+
+    private:
+        static constexpr Y missing() noexcept {
+            if constexpr (std::numeric_limits<Y>::has_quiet_NaN) return std::numeric_limits<Y>::quiet_NaN();
+            else return Y{};
+        }
+
+        std::vector<X>              xs_;
+        std::vector<std::vector<Y>> ys_;
+        std::uint64_t               version_ = 0;
+    };
+
+    /**
+     * @brief Split @p r into the sample groups decimate_minmax() reduces: one bucket per pixel
+     *        column inside [x_min, x_max], one single-sample bucket per sample outside it.
+     *
+     * Depends only on x, so it is computed once and shared by every y column.
+     */
+    template<typename X>
+    constexpr void pixel_buckets(const std::span<const X> xs, const index_range r, const double x_min,
+                                 const double x_max, const int columns, std::vector<index_range> &out) {
+        out.clear();
+        out.reserve(static_cast<std::size_t>(std::max(columns, 1)) + 2);
+        const double scale  = x_max > x_min ? std::max(columns, 1) / (x_max - x_min) : 0.0;
+        auto         column = [&](const double x) { return static_cast<std::int64_t>((x - x_min) * scale); };
+
+        for (std::size_t i = r.first; i < r.last;) {
+            const double x0 = static_cast<double>(xs[i]);
+            if (x0 < x_min || x0 > x_max) {
+                out.push_back({i, i + 1});
+                ++i;
+                continue;
+            }
+            const std::int64_t col   = column(x0);
+            const std::size_t  first = i;
+            for (++i; i < r.last; ++i) {
+                const double x = static_cast<double>(xs[i]);
+                if (x > x_max || column(x) != col) break;
+            }
+            out.push_back({first, i});
+        }
+    }
+
+    /**
+     * @brief Min/max of one y column over precomputed @p buckets, in sample order.
+     *
+     * Emits exactly what decimate_minmax() emits for the same range; x is only read for the
+     * (at most two) samples kept per bucket.
+     */
+    template<typename X, typename Y>
+    constexpr void decimate_buckets(const std::span<const X> xs, const std::span<const Y> ys,
+                                    const std::span<const index_range> buckets, std::vector<ImPlotPoint> &out) {
+        out.clear();
+        out.reserve(2 * buckets.size());
+        for (const index_range &b: buckets) {
+            std::size_t lo  = b.first;
+            std::size_t hi  = b.first;
+            Y           ylo = ys[b.first];
+            Y           yhi = ylo;
+            for (std::size_t i = b.first + 1; i < b.last; ++i) {
+                const Y y = ys[i];
+                if (y < ylo) {
+                    ylo = y;
+                    lo  = i;
+                } else if (y > yhi) {
+                    yhi = y;
+                    hi  = i;
+                }
+            }
+            const std::size_t p = std::min(lo, hi);
+            const std::size_t q = std::max(lo, hi);
+            out.emplace_back(static_cast<double>(xs[p]), static_cast<double>(ys[p]));
+            if (q != p) out.emplace_back(static_cast<double>(xs[q]), static_cast<double>(ys[q]));
+        }
+    }
+
+    /**
+     * @brief Decimated points of every column of a shared_x_store, recomputed only on a view or data change.
+     *
+     * Keyed on (store version, column count, x limits, pixel width, method), like decimation_cache.
+     */
+    class shared_x_cache {
+    public:
+        /// @brief Return one point list per column for the given view, recomputing on a key change.
+        template<typename X, typename Y>
+        std::span<const std::vector<ImPlotPoint>> update(const shared_x_store<X, Y> &store, const double x_min,
+                                                         const double x_max, const int pixel_width,
+                                                         const decimation method = decimation::minmax) {
+            const cache_key k{store.version(), store.columns(), x_min, x_max, pixel_width, method};
+            if (valid_ && k == key_) return points_;
+            key_   = k;
+            valid_ = true;
+            ++rebuilds_;
+
+            points_.resize(store.columns());
+            range_ = visible_range(xy_series<X, X>{store.xs(), store.xs()}, x_min, x_max); // one search for all columns
+
+            const std::size_t budget = 2 * static_cast<std::size_t>(std::max(pixel_width, 0));
+            if (pixel_width <= 0) {
+                for (auto &p: points_) p.clear();
+            } else if (range_.size() <= budget) {
+                for (std::size_t j = 0; j < store.columns(); ++j) copy_points(store.series(j), range_, points_[j]);
+            } else if (method == decimation::lttb) {
+                for (std::size_t j = 0; j < store.columns(); ++j)
+                    decimate_lttb(store.series(j), range_, budget, points_[j]);
+            } else {
+                pixel_buckets(store.xs(), range_, x_min, x_max, pixel_width, buckets_);
+                for (std::size_t j = 0; j < store.columns(); ++j)
+                    decimate_buckets(store.xs(), store.ys(j), buckets_, points_[j]);
+            }
+            return points_;
+        }
+
+        [[nodiscard]] std::span<const std::vector<ImPlotPoint>> points() const noexcept { return points_; }
+
+        /// @brief Visible sample range found by the last recompute.
+        [[nodiscard]] index_range visible() const noexcept { return range_; }
+
+        /// @brief Force a recompute on the next update().
+        void invalidate() noexcept { valid_ = false; }
+
+        /// @brief Number of recomputations so far (diagnostics).
+        [[nodiscard]] int rebuilds() const noexcept { return rebuilds_; }
+
+    private:
+        struct cache_key {
+            std::uint64_t version     = 0;
+            std::size_t   columns     = 0;
+            double        x_min       = 0.0;
+            double        x_max       = 0.0;
+            int           pixel_width = 0;
+            decimation    method      = decimation::minmax;
+
+            bool operator==(const cache_key &) const = default;
+        };
+
+        cache_key                             key_;
+        bool                                  valid_    = false;
+        int                                   rebuilds_ = 0;
+        index_range                           range_;
+        std::vector<index_range>              buckets_;
+        std::vector<std::vector<ImPlotPoint>> points_;
+    };
+
+    /**
+     * @brief PlotLine every column of @p store, decimated together to the current plot's view.
+     *
+     * Must be called between BeginPlot/EndPlot. Columns without a label (a nullptr entry,
+     * or past the end of @p labels) are skipped.
+     * @param labels One item label per column.
+     * @param store  Shared-x data.
+     * @param cache  Cache kept across frames.
+     * @param method Reduction applied above two samples per pixel column.
+     * @param flags  Forwarded to PlotLineG.
+     */
+    template<typename X, typename Y>
+    void plot_lines_shared_x(const std::span<const char *const> labels, const shared_x_store<X, Y> &store,
+                             shared_x_cache &cache, const decimation method = decimation::minmax,
+                             const ImPlotLineFlags flags = 0) {
+        const ImPlotRect lim = ImPlot::GetPlotLimits();
+        const int        w   = static_cast<int>(ImPlot::GetPlotSize().x);
+        const auto       pts = cache.update(store, lim.X.Min, lim.X.Max, w, method);
+        for (std::size_t j = 0; j < std::min(labels.size(), pts.size()); ++j) {
+            if (labels[j] == nullptr) continue;
+            ImPlot::PlotLineG(labels[j], &span_getter, const_cast<ImPlotPoint *>(pts[j].data()), // NOLINT: read-only
+                              static_cast<int>(pts[j].size()), flags);
+        }
+    }
+
+} // namespace imgui_util::implot
@@ -0,0 +1,337 @@
+/// @file decimate.hpp
+/// @brief Screen-resolution decimation (min/max envelope or LTTB) for large ImPlot line series.
+///
+/// ImPlot tessellates every point handed to PlotLine, so a 50M-sample series costs 50M
+/// segments per frame even though only a few thousand pixel columns are visible. The helpers
+/// here binary-search the visible x window of a sorted series and reduce it to roughly two
+/// points per pixel column before anything reaches ImPlot. The reduced points are plotted
+/// through span_getter and cached until the series version, x limits, or plot width change.
+///
+/// Usage:
+/// @code
+///   implot::decimation_cache cache; // one per plotted series, kept across frames
+///   if (implot::plot p{"Telemetry"}) {
+///       implot::plot_line_decimated("signal", implot::xy_series{xs, ys}, cache, data_version);
+///   }
+/// @endcode
+///
+/// Any type with size(), x(i) and y(i) is a plot_series; x must be non-decreasing.
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <implot.h>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "imgui_util/plot/raii.hpp"
+
+namespace imgui_util::implot {
+
+    /// @brief Indexed (x, y) sample source with non-decreasing x.
+    template<typename S>
+    concept plot_series = requires(const S &s, std::size_t i) {
+        { s.size() } -> std::convertible_to<std::size_t>;
+        { s.x(i) } -> std::convertible_to<double>;
+        { s.y(i) } -> std::convertible_to<double>;
+    };
+
+    /// @brief Separate x and y arrays (e.g. std::vector, or spans over mmap'd memory).
+    template<typename X, typename Y = X>
+    struct xy_series {
+        std::span<const X> xs;
+        std::span<const Y> ys;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return std::min(xs.size(), ys.size()); }
+        [[nodiscard]] constexpr double      x(const std::size_t i) const noexcept { return static_cast<double>(xs[i]); }
+        [[nodiscard]] constexpr double      y(const std::size_t i) const noexcept { return static_cast<double>(ys[i]); }
+    };
+    template<std::ranges::contiguous_range RX, std::ranges::contiguous_range RY>
+    xy_series(const RX &, const RY &) -> xy_series<std::ranges::range_value_t<RX>, std::ranges::range_value_t<RY>>;
+
+    /// @brief Evenly sampled y array; x(i) = x0 + i * dx.
+    template<typename Y>
+    struct uniform_series {
+        std::span<const Y> ys;
+        double             x0 = 0.0;
+        double             dx = 1.0;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return ys.size(); }
+        [[nodiscard]] constexpr double      x(const std::size_t i) const noexcept {
+            return x0 + static_cast<double>(i) * dx;
+        }
+        [[nodiscard]] constexpr double y(const std::size_t i) const noexcept { return static_cast<double>(ys[i]); }
+    };
+    template<std::ranges::contiguous_range R>
+    uniform_series(const R &, double = 0.0, double = 1.0) -> uniform_series<std::ranges::range_value_t<R>>;
+
+    /// @brief Half-open sample index range [first, last).
+    struct index_range {
+        std::size_t first = 0;
+        std::size_t last  = 0;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return last - first; }
+        [[nodiscard]] constexpr bool        empty() const noexcept { return last <= first; }
+        constexpr bool                      operator==(const index_range &) const = default;
+    };
+
+    /// @brief Reduction used once a visible window has more than two samples per pixel column.
+    enum class decimation : std::uint8_t {
+        minmax, ///< Min and max of every pixel column; exact envelope, spikes never disappear.
+        lttb,   ///< Largest-Triangle-Three-Buckets; smoother shape, may drop single-sample spikes.
+    };
+
+    /// @brief Identifies the reduction that filled a decimation_cache (part of its cache key).
+    struct reduction_key {
+        /// @brief Producer of the points; each family numbers its own modes.
+        enum class family : std::uint8_t {
+            decimate, ///< decimation_cache::update(); mode is a decimation.
+            pyramid,  ///< plot_line_pyramid(); mode is a pyramid_mode.
+            custom,   ///< Caller-defined reductions passed to update_with().
+        };
+
+        family       source = family::decimate;
+        std::uint8_t mode   = 0;
+
+        constexpr bool operator==(const reduction_key &) const = default;
+    };
+
+    /**
+     * @brief Samples whose x lies in [x_min, x_max], plus one neighbour on each side.
+     *
+     * The extra samples let the line run to the plot edges instead of stopping at the
+     * first visible sample. O(log n).
+     */
+    template<plot_series S>
+    [[nodiscard]] constexpr index_range visible_range(const S &s, const double x_min, const double x_max) noexcept {
+        const auto  idx   = std::views::iota(std::size_t{0}, static_cast<std::size_t>(s.size()));
+        std::size_t first = *std::ranges::partition_point(idx, [&](const std::size_t i) { return s.x(i) < x_min; });
+        std::size_t last  = *std::ranges::partition_point(idx, [&](const std::size_t i) { return s.x(i) <= x_max; });
+        if (first > 0) --first;
+        if (last < idx.size()) ++last;
+        return {first, last};
+    }
+
+    /// @brief Copy @p r unchanged into @p out.
+    template<plot_series S>
+    constexpr void copy_points(const S &s, const index_range r, std::vector<ImPlotPoint> &out) {
+        out.clear();
+        out.reserve(r.size());
+        for (std::size_t i = r.first; i < r.last; ++i) out.emplace_back(s.x(i), s.y(i));
+    }
+
+    /**
+     * @brief Min/max envelope: at most two points per pixel column over [x_min, x_max].
+     *
+     * Samples of one column are reduced to its minimum and maximum, emitted in sample order
+     * so the polyline still draws the vertical extent of the column. Samples outside the
+     * limits (the padding from visible_range) pass through unchanged.
+     * @param columns Plot width in pixels.
+     */
+    template<plot_series S>
+    constexpr void decimate_minmax(const S &s, const index_range r, const double x_min, const double x_max,
+                                   const int columns, std::vector<ImPlotPoint> &out) {
+        out.clear();
+        out.reserve(2 * static_cast<std::size_t>(std::max(columns, 1)) + 2);
+        const double scale  = x_max > x_min ? std::max(columns, 1) / (x_max - x_min) : 0.0;
+        auto         column = [&](const double x) { return static_cast<std::int64_t>((x - x_min) * scale); };
+
+        for (std::size_t i = r.first; i < r.last;) {
+            const double x0 = s.x(i);
+            if (x0 < x_min || x0 > x_max) {
+                out.emplace_back(x0, s.y(i++));
+                continue;
+            }
+            const std::int64_t col = column(x0);
+            std::size_t        lo  = i;
+            std::size_t        hi  = i;
+            double             ylo = s.y(i);
+            double             yhi = ylo;
+            for (++i; i < r.last; ++i) {
+                const double x = s.x(i);
+                if (x > x_max || column(x) != col) break;
+                const double y = s.y(i);
+                if (y < ylo) {
+                    ylo = y;
+                    lo  = i;
+                } else if (y > yhi) {
+                    yhi = y;
+                    hi  = i;
+                }
+            }
+            const std::size_t a = std::min(lo, hi);
+            const std::size_t b = std::max(lo, hi);
+            out.emplace_back(s.x(a), s.y(a));
+            if (b != a) out.emplace_back(s.x(b), s.y(b));
+        }
+    }
+
+    /**
+     * @brief Largest-Triangle-Three-Buckets down-sampling of @p r to @p threshold points.
+     *
+     * Keeps the first and last sample; from each of the threshold - 2 equal-count buckets in
+     * between keeps the sample forming the largest triangle with the previous pick and the
+     * mean of the next bucket. Ranges already within @p threshold are copied.
+     */
+    template<plot_series S>
+    constexpr void decimate_lttb(const S &s, const index_range r, const std::size_t threshold,
+                                 std::vector<ImPlotPoint> &out) {
+        if (r.size() <= threshold || threshold < 3) {
+            copy_points(s, r, out);
+            return;
+        }
+        out.clear();
+        out.reserve(threshold);
+
+        const double every = static_cast<double>(r.size() - 2) / static_cast<double>(threshold - 2);
+        std::size_t  a     = r.first;
+        out.emplace_back(s.x(a), s.y(a));
+
+        for (std::size_t b = 0; b < threshold - 2; ++b) {
+            // Mean of the next bucket (the last sample for the final bucket).
+            const std::size_t next_lo = r.first + 1 + static_cast<std::size_t>(static_cast<double>(b + 1) * every);
+            const std::size_t next_hi =
+                std::min(r.first + 1 + static_cast<std::size_t>(static_cast<double>(b + 2) * every), r.last);
+            double mx = 0.0;
+            double my = 0.0;
+            if (next_lo < next_hi) {
+                for (std::size_t i = next_lo; i < next_hi; ++i) {
+                    mx += s.x(i);
+                    my += s.y(i);
+                }
+                mx /= static_cast<double>(next_hi - next_lo);
+                my /= static_cast<double>(next_hi - next_lo);
+            } else {
+                mx = s.x(r.last - 1);
+                my = s.y(r.last - 1);
+            }
+
+            const std::size_t lo = r.first + 1 + static_cast<std::size_t>(static_cast<double>(b) * every);
+            const std::size_t hi = std::min(next_lo, r.last - 1);
+            const double      ax = s.x(a);
+            const double      ay = s.y(a);
+            double            best_area = -1.0;
+            std::size_t       best      = lo;
+            for (std::size_t i = lo; i < hi; ++i) {
+                const double area = (ax - mx) * (s.y(i) - ay) - (ax - s.x(i)) * (my - ay);
+                const double mag  = area < 0.0 ? -area : area;
+                if (mag > best_area) {
+                    best_area = mag;
+                    best      = i;
+                }
+            }
+            out.emplace_back(s.x(best), s.y(best));
+            a = best;
+        }
+        out.emplace_back(s.x(r.last - 1), s.y(r.last - 1));
+    }
+
+    /**
+     * @brief Reduce @p r to about two points per pixel column with @p method.
+     *
+     * Windows with at most two samples per column are copied unchanged.
+     * @param pixel_width Plot width in pixels; nothing is emitted for a non-positive width.
+     */
+    template<plot_series S>
+    constexpr void decimate(const S &s, const index_range r, const double x_min, const double x_max,
+                            const int pixel_width, const decimation method, std::vector<ImPlotPoint> &out) {
+        if (pixel_width <= 0) {
+            out.clear();
+            return;
+        }
+        const std::size_t budget = 2 * static_cast<std::size_t>(pixel_width);
+        if (r.size() <= budget) copy_points(s, r, out);
+        else if (method == decimation::lttb) decimate_lttb(s, r, budget, out);
+        else decimate_minmax(s, r, x_min, x_max, pixel_width, out);
+    }
+
+    /**
+     * @brief Decimated points of one series, recomputed only when the view or data changes.
+     *
+     * Keyed on (series version, x limits, pixel width, method). The caller bumps the version
+     * whenever the series data changes; keep one cache per plotted series.
+     */
+    class decimation_cache {
+    public:
+        /// @brief Return the decimated points for the given view, recomputing on a key change.
+        template<plot_series S>
+        std::span<const ImPlotPoint> update(const S &s, const std::uint64_t version, const double x_min,
+                                            const double x_max, const int pixel_width,
+                                            const decimation method = decimation::minmax) {
+            return update_with(version, x_min, x_max, pixel_width,
+                               {reduction_key::family::decimate, static_cast<std::uint8_t>(method)},
+                               [&](std::vector<ImPlotPoint> &out) {
+                                   decimate(s, visible_range(s, x_min, x_max), x_min, x_max, pixel_width, method, out);
+                               });
+        }
+
+        /**
+         * @brief Like update(), but @p fill produces the points (for other reductions sharing this cache).
+         * @param reduction Distinguishes reductions in the cache key.
+         * @param fill      Invoked with the cleared-or-stale output vector on a key change.
+         */
+        template<typename Fill>
+            requires std::is_invocable_v<Fill &, std::vector<ImPlotPoint> &>
+        std::span<const ImPlotPoint> update_with(const std::uint64_t version, const double x_min, const double x_max,
+                                                 const int pixel_width, const reduction_key reduction, Fill &&fill) {
+            const cache_key k{version, x_min, x_max, pixel_width, reduction};
+            if (!valid_ || k != key_) {
+                fill(points_);
+                key_   = k;
+                valid_ = true;
+                ++rebuilds_;
+            }
+            return points_;
+        }
+
+        [[nodiscard]] std::span<const ImPlotPoint> points() const noexcept { return points_; }
+
+        /// @brief Force a recompute on the next update() (e.g. after in-place edits without a version bump).
+        void invalidate() noexcept { valid_ = false; }
+
+        /// @brief Number of recomputations so far (diagnostics).
+        [[nodiscard]] int rebuilds() const noexcept { return rebuilds_; }
+
+    private:
+        struct cache_key {
+            std::uint64_t version     = 0;
+            double        x_min       = 0.0;
+            double        x_max       = 0.0;
+            int           pixel_width = 0;
+            reduction_key reduction;
+
+            bool operator==(const cache_key &) const = default;
+        };
+
+        cache_key                key_;
+        bool                     valid_    = false;
+        int                      rebuilds_ = 0;
+        std::vector<ImPlotPoint> points_;
+    };
+
+    /**
+     * @brief PlotLine a series decimated to the current plot's x limits and pixel width.
+     *
+     * Must be called between BeginPlot/EndPlot (reads GetPlotLimits and GetPlotSize).
+     * @param label   Item label.
+     * @param s       Series with non-decreasing x.
+     * @param cache   Per-series cache kept across frames.
+     * @param version Bumped by the caller whenever the series data changes.
+     * @param method  Reduction applied above two samples per pixel column.
+     * @param flags   Forwarded to PlotLineG.
+     */
+    template<plot_series S>
+    void plot_line_decimated(const char *label, const S &s, decimation_cache &cache, const std::uint64_t version,
+                             const decimation method = decimation::minmax, const ImPlotLineFlags flags = 0) {
+        const ImPlotRect             lim = ImPlot::GetPlotLimits();
+        const int                    w   = static_cast<int>(ImPlot::GetPlotSize().x);
+        std::span<const ImPlotPoint> pts = cache.update(s, version, lim.X.Min, lim.X.Max, w, method);
+        ImPlot::PlotLineG(label, &span_getter, const_cast<ImPlotPoint *>(pts.data()), // NOLINT: getter is read-only
+                          static_cast<int>(pts.size()), flags);
+    }
+
+} // namespace imgui_util::implot
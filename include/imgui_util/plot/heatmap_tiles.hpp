@@ -0,0 +1,238 @@
+/// @file heatmap_tiles.hpp
+/// @brief CPU-rasterized, tiled and cached heatmap images for large 2D arrays.
+///
+/// PlotHeatmap emits one rectangle per cell, so a 4096x4096 grid is 16M quads per frame.
+/// tiled_heatmap instead rasterizes the grid into RGBA tiles on worker threads: a tile at
+/// zoom level z has one pixel per 2^z x 2^z block of cells (the block mean, mapped through
+/// a colormap lookup table). Finished tiles are uploaded once through a pluggable texture
+/// backend and drawn with one PlotImage each, so drawing costs O(visible tiles). While a
+/// tile is being rasterized, the nearest finished coarser tile is drawn in its place.
+///
+/// Usage:
+/// @code
+///   implot::tiled_heatmap heat{my_texture_backend, implot::colormap_lut::from_implot(ImPlotColormap_Viridis)};
+///   heat.set_data(values, rows, cols, 0.0, 1.0); // row-major, row 0 at the top (as PlotHeatmap)
+///   // each frame
+///   if (implot::plot p{"Grid"}) implot::plot_heatmap_tiles("grid", heat);
+/// @endcode
+///
+/// The backend only needs to turn an RGBA8 buffer into an ImTextureID and free it again;
+/// null_texture_backend() does neither and is meant for headless use and tests.
+
+#pragma once
+
+#include <array>
+#include <compare>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <implot.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace imgui_util::implot {
+
+    /// @brief Creates and destroys textures for finished tiles (called on the UI thread only).
+    struct texture_backend {
+        /// @brief Upload @p width x @p height RGBA8 pixels (IM_COL32 layout, rows top to bottom).
+        std::function<ImTextureID(const ImU32 *pixels, int width, int height)> create;
+        std::function<void(ImTextureID)>                                      destroy;
+    };
+
+    /// @brief Backend that hands out distinct dummy texture ids and uploads nothing.
+    [[nodiscard]] texture_backend null_texture_backend();
+
+    /// @brief 256-entry colormap lookup table, interpolated between key colors in OKLab.
+    class colormap_lut {
+    public:
+        static constexpr std::size_t size = 256;
+
+        /// @brief Interpolate @p keys (at least one, evenly spaced from t = 0 to t = 1).
+        explicit colormap_lut(std::span<const ImU32> keys);
+
+        /// @brief Keys of an ImPlot colormap (requires a current ImPlot context).
+        [[nodiscard]] static colormap_lut from_implot(const ImPlotColormap cmap) {
+            std::vector<ImU32> keys(static_cast<std::size_t>(ImPlot::GetColormapSize(cmap)));
+            for (std::size_t i = 0; i < keys.size(); i++)
+                keys[i] = ImGui::ColorConvertFloat4ToU32(ImPlot::GetColormapColor(static_cast<int>(i), cmap));
+            return colormap_lut{keys};
+        }
+
+        /// @brief Color at @p t in [0, 1] (clamped).
+        [[nodiscard]] ImU32 operator()(const float t) const noexcept {
+            const float c = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+            return colors_[static_cast<std::size_t>(c * (size - 1) + 0.5f)];
+        }
+
+        [[nodiscard]] std::span<const ImU32, size> colors() const noexcept { return colors_; }
+
+    private:
+        std::array<ImU32, size> colors_{};
+    };
+
+    /// @brief Row-major 2D scalar grid; row 0 is drawn at the top, as with PlotHeatmap.
+    struct heatmap_source {
+        std::span<const float> values;
+        int                    rows      = 0;
+        int                    cols      = 0;
+        double                 scale_min = 0.0; ///< Value mapped to the first colormap entry.
+        double                 scale_max = 1.0; ///< Value mapped to the last colormap entry.
+    };
+
+    /// @brief Tile address: zoom level (pixel = 2^level cells per side) and tile column/row.
+    struct tile_key {
+        int level = 0;
+        int tx    = 0;
+        int ty    = 0;
+
+        auto operator<=>(const tile_key &) const = default;
+    };
+
+    /// @brief Plot-space view to cover: axis limits and plot size in pixels.
+    struct heatmap_view {
+        double x_min        = 0.0;
+        double x_max        = 1.0;
+        double y_min        = 0.0;
+        double y_max        = 1.0;
+        int    pixel_width  = 1;
+        int    pixel_height = 1;
+    };
+
+    /// @brief One PlotImage call: texture and plot-space bounds (uv0 = (0, 1), uv1 = (1, 0)).
+    struct tile_draw {
+        ImTextureID texture{};
+        ImPlotPoint bounds_min;
+        ImPlotPoint bounds_max;
+    };
+
+    /**
+     * @brief Rasterize one tile: block means of 2^level x 2^level cells mapped through @p lut.
+     *
+     * NaN cells are ignored; an all-NaN block is transparent. Edge tiles are smaller than
+     * @p tile_px. Pure function, run on the worker threads.
+     * @param out    Receives width * height pixels, rows top to bottom.
+     * @return       {width, height} of the tile in pixels.
+     */
+    std::pair<int, int> rasterize_tile(const heatmap_source &src, const tile_key &key, int tile_px,
+                                       const colormap_lut &lut, std::vector<ImU32> &out);
+
+    /// @brief Worker-rasterized, zoom-level tiled image cache for one heatmap.
+    class tiled_heatmap {
+    public:
+        struct options {
+            int         tile_px   = 256; ///< Tile edge in pixels.
+            int         workers   = 2;   ///< Rasterizer threads.
+            std::size_t max_tiles = 512; ///< Cached tiles (and textures) kept before LRU eviction.
+        };
+
+        tiled_heatmap(texture_backend backend, const colormap_lut &lut);
+        tiled_heatmap(texture_backend backend, const colormap_lut &lut, const options &opts);
+        /// @brief Stops the workers and destroys every cached texture.
+        ~tiled_heatmap();
+
+        tiled_heatmap(const tiled_heatmap &)            = delete;
+        tiled_heatmap &operator=(const tiled_heatmap &) = delete;
+
+        /**
+         * @brief Replace the grid and drop all cached tiles.
+         *
+         * Waits for tiles already being rasterized; @p values must then stay valid until the
+         * next set_data() or destruction.
+         * @param bounds_min Plot-space lower-left corner of the grid.
+         * @param bounds_max Plot-space upper-right corner of the grid.
+         */
+        void set_data(std::span<const float> values, int rows, int cols, double scale_min, double scale_max,
+                      const ImPlotPoint &bounds_min = ImPlotPoint(0, 0),
+                      const ImPlotPoint &bounds_max = ImPlotPoint(1, 1));
+
+        /**
+         * @brief Tiles to draw for @p view (UI thread).
+         *
+         * Uploads tiles finished since the last call, queues missing visible tiles, and
+         * returns ready tiles plus coarser stand-ins for those still pending.
+         */
+        [[nodiscard]] std::span<const tile_draw> prepare(const heatmap_view &view);
+
+        /// @brief Zoom level used for @p view: the coarsest whose pixels are no larger than screen pixels.
+        [[nodiscard]] int level_for(const heatmap_view &view) const noexcept;
+
+        /// @brief Block until no tile is queued or being rasterized (tests, shutdown).
+        void wait_idle();
+
+        [[nodiscard]] std::size_t cached_tiles() const noexcept { return tiles_.size(); }
+        [[nodiscard]] int         uploads() const noexcept { return uploads_; }
+
+    private:
+        struct tile {
+            ImTextureID   texture{};
+            bool          ready     = false;
+            std::uint64_t last_used = 0;
+        };
+        struct job {
+            tile_key      key;
+            std::uint64_t generation = 0;
+        };
+        struct result {
+            tile_key           key;
+            std::uint64_t      generation = 0;
+            std::vector<ImU32> pixels;
+            int                width  = 0;
+            int                height = 0;
+        };
+
+        texture_backend backend_;
+        colormap_lut    lut_;
+        options         opts_;
+        heatmap_source  src_;
+        ImPlotPoint     bounds_min_;
+        ImPlotPoint     bounds_max_;
+
+        // UI-thread state
+        std::map<tile_key, tile> tiles_;
+        std::vector<tile_draw>   draws_;
+        std::uint64_t            frame_   = 0;
+        int                      uploads_ = 0;
+
+        // Shared with workers, guarded by mutex_
+        std::mutex                  mutex_;
+        std::condition_variable_any work_cv_;
+        std::condition_variable     idle_cv_;
+        std::deque<job>             queue_;
+        std::vector<result>         done_;
+        std::uint64_t               generation_ = 0;
+        int                         busy_       = 0;
+
+        std::vector<std::jthread> workers_; // declared last: started after, and joined before, the state above
+
+        [[nodiscard]] int                  max_level() const noexcept;
+        [[nodiscard]] std::pair<int, int>  tile_extent(int level, int tx, int ty) const noexcept; // cells
+        [[nodiscard]] tile_draw            placement(const tile_key &key, ImTextureID texture) const noexcept;
+        void                               collect_finished();
+        void                               evict();
+        void                               work(const std::stop_token &stop);
+    };
+
+    /**
+     * @brief PlotImage every visible tile of @p heat for the current plot (between BeginPlot/EndPlot).
+     * @param label Item label (shared by all tiles).
+     * @param heat  Heatmap cache.
+     * @param flags Forwarded to PlotImage.
+     */
+    inline void plot_heatmap_tiles(const char *label, tiled_heatmap &heat, const ImPlotImageFlags flags = 0) {
+        const ImPlotRect lim  = ImPlot::GetPlotLimits();
+        const ImVec2     size = ImPlot::GetPlotSize();
+        const auto       draws =
+            heat.prepare({lim.X.Min, lim.X.Max, lim.Y.Min, lim.Y.Max, static_cast<int>(size.x), static_cast<int>(size.y)});
+        for (const tile_draw &d: draws)
+            ImPlot::PlotImage(label, d.texture, d.bounds_min, d.bounds_max, ImVec2(0, 1), ImVec2(1, 0),
+                              ImVec4(1, 1, 1, 1), flags);
+    }
+
+} // namespace imgui_util::implot
@@ -0,0 +1,374 @@
+/// @file histogram.hpp
+/// @brief Incrementally binned 1D histograms and 2D heatmaps, handed straight to PlotBars/PlotHeatmap.
+///
+/// ImPlot::PlotHistogram re-bins every sample each frame. These histograms bin once, as
+/// samples are appended, using the batch kernels from binning.hpp, and keep fine counts
+/// that coarser displays are summed from without touching the samples again.
+///
+/// Worker threads bin into their own partial (no sharing, no atomics) and publish() it
+/// now and then; the render thread folds published counts in with sync().
+///
+/// Usage:
+/// @code
+///   implot::histogram h{{0.0, 500.0, 1000}};        // fine bins: 0.5 ms
+///   // worker thread
+///   auto part = h.make_partial();
+///   part.add(latencies);                            // std::vector<float>
+///   h.publish(part);
+///   // render thread
+///   if (implot::plot p{"Latency"}) implot::plot_histogram("ms", h, 10); // 5 ms bars
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <implot.h>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/plot/binning.hpp"
+
+namespace imgui_util::implot {
+
+    namespace detail {
+
+        inline constexpr std::size_t bin_chunk = 512;
+
+        // Bin @p samples in chunks of bin_chunk and add 1 to counts[idx] for every in-range sample.
+        template<typename T, typename C>
+        void accumulate_bins(std::span<const T> samples, const bin_axis &axis, std::span<C> counts) noexcept {
+            std::array<std::int32_t, bin_chunk> idx; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            while (!samples.empty()) {
+                const std::size_t n = std::min(samples.size(), bin_chunk);
+                bin_indices(samples.first(n), axis, idx);
+                for (std::size_t i = 0; i < n; i++)
+                    if (idx[i] >= 0) counts[static_cast<std::size_t>(idx[i])] += 1;
+                samples = samples.subspan(n);
+            }
+        }
+
+        // 2D variant: cell = row * x.bins + column, with row 0 at the top (max y) as PlotHeatmap expects.
+        template<typename T, typename C>
+        void accumulate_bins_2d(std::span<const T> xs, std::span<const T> ys, const bin_axis &x, const bin_axis &y,
+                                std::span<C> counts) noexcept {
+            std::array<std::int32_t, bin_chunk> ix; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            std::array<std::int32_t, bin_chunk> iy; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            std::size_t                         left = std::min(xs.size(), ys.size());
+            for (std::size_t off = 0; left > 0;) {
+                const std::size_t n = std::min(left, bin_chunk);
+                bin_indices(xs.subspan(off, n), x, ix);
+                bin_indices(ys.subspan(off, n), y, iy);
+                for (std::size_t i = 0; i < n; i++) {
+                    if (ix[i] < 0 || iy[i] < 0) continue;
+                    const auto row = static_cast<std::size_t>(y.bins - 1 - iy[i]);
+                    counts[row * static_cast<std::size_t>(x.bins) + static_cast<std::size_t>(ix[i])] += 1;
+                }
+                off += n;
+                left -= n;
+            }
+        }
+
+        // Sum groups of @p factor fine bins (the last group may be short).
+        inline void group_bins(std::span<const double> fine, const int factor, std::span<double> out) noexcept {
+            std::ranges::fill(out, 0.0);
+            for (std::size_t i = 0; i < fine.size(); i++) out[i / static_cast<std::size_t>(factor)] += fine[i];
+        }
+
+        [[nodiscard]] constexpr int grouped_bins(const int bins, const int factor) noexcept {
+            return (bins + factor - 1) / factor;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief 1D histogram with fixed fine bins, filled incrementally.
+     *
+     * add() is for the owning (render) thread. Other threads bin into a partial and publish();
+     * publish() and sync() share a mutex held for O(bins), never for the binning itself.
+     */
+    class histogram {
+    public:
+        /// @brief Worker-local counts over the histogram's fine axis.
+        class partial {
+        public:
+            void add(const std::span<const float> samples) noexcept {
+                detail::accumulate_bins(samples, axis_, std::span<std::uint64_t>{counts_});
+            }
+            void add(const std::span<const double> samples) noexcept {
+                detail::accumulate_bins(samples, axis_, std::span<std::uint64_t>{counts_});
+            }
+
+            [[nodiscard]] const bin_axis &axis() const noexcept { return axis_; }
+
+        private:
+            friend class histogram;
+            explicit partial(const bin_axis &axis) : axis_(axis), counts_(static_cast<std::size_t>(axis.bins)) {}
+
+            bin_axis                   axis_;
+            std::vector<std::uint64_t> counts_;
+        };
+
+        /// @brief Bin centers, counts and bar width of one display resolution.
+        struct bars {
+            std::vector<double> centers;
+            std::vector<double> counts;
+            double              width = 0.0;
+        };
+
+        explicit histogram(const bin_axis &fine) :
+            axis_(fine), counts_(static_cast<std::size_t>(fine.bins)), pending_(counts_.size()) {}
+
+        [[nodiscard]] partial make_partial() const { return partial{axis_}; }
+
+        /// @brief Bin samples directly into the histogram (owning thread).
+        void add(const std::span<const float> samples) noexcept {
+            detail::accumulate_bins(samples, axis_, std::span<double>{counts_});
+            ++version_;
+        }
+        /// @copydoc add(std::span<const float>)
+        void add(const std::span<const double> samples) noexcept {
+            detail::accumulate_bins(samples, axis_, std::span<double>{counts_});
+            ++version_;
+        }
+
+        /// @brief Hand a partial's counts over to the histogram and zero it (any thread).
+        void publish(partial &p) {
+            const std::scoped_lock lock{mutex_};
+            for (std::size_t i = 0; i < pending_.size(); i++) pending_[i] += std::exchange(p.counts_[i], 0);
+            has_pending_ = true;
+        }
+
+        /// @brief Fold published partials into the counts (owning thread). Returns true if any arrived.
+        bool sync() {
+            const std::scoped_lock lock{mutex_};
+            if (!has_pending_) return false;
+            for (std::size_t i = 0; i < pending_.size(); i++)
+                counts_[i] += static_cast<double>(std::exchange(pending_[i], 0));
+            has_pending_ = false;
+            ++version_;
+            return true;
+        }
+
+        /// @brief Zero the counts, dropping partials published but not yet synced (owning thread).
+        void clear() {
+            const std::scoped_lock lock{mutex_};
+            std::ranges::fill(counts_, 0.0);
+            std::ranges::fill(pending_, std::uint64_t{0});
+            has_pending_ = false;
+            ++version_;
+        }
+
+        [[nodiscard]] const bin_axis         &axis() const noexcept { return axis_; }
+        [[nodiscard]] std::span<const double> counts() const noexcept { return counts_; }
+
+        /// @brief Incremented whenever the counts change.
+        [[nodiscard]] std::uint64_t version() const noexcept { return version_; }
+
+        /**
+         * @brief Display bins of @p factor fine bins each, summed from the fine counts.
+         *
+         * Cached until the counts or the factor change, so calling this every frame is free.
+         */
+        [[nodiscard]] const bars &grouped(int factor) {
+            factor = std::clamp(factor, 1, axis_.bins);
+            if (factor != bars_factor_ || bars_version_ != version_) {
+                const bin_axis coarse{axis_.min, axis_.edge(detail::grouped_bins(axis_.bins, factor) * factor),
+                                      detail::grouped_bins(axis_.bins, factor)};
+                bars_.counts.resize(static_cast<std::size_t>(coarse.bins));
+                bars_.centers.resize(bars_.counts.size());
+                for (int i = 0; i < coarse.bins; i++) bars_.centers[static_cast<std::size_t>(i)] = coarse.center(i);
+                bars_.width = coarse.width();
+                detail::group_bins(counts_, factor, bars_.counts);
+                bars_factor_  = factor;
+                bars_version_ = version_;
+            }
+            return bars_;
+        }
+
+        /**
+         * @brief Derive counts for @p target from the fine bins without re-binning samples.
+         *
+         * Possible when every target edge lies on a fine edge (target width is a whole number
+         * of fine bins and its range starts on a fine edge inside the fine range); returns
+         * false otherwise, in which case the samples must be binned again.
+         */
+        [[nodiscard]] bool rebin(const bin_axis &target, std::vector<double> &out) const {
+            constexpr double eps    = 1e-9; // tolerance, in fine bins, for edges to count as aligned
+            const double     first  = (target.min - axis_.min) / axis_.width();
+            const double     factor = target.width() / axis_.width();
+            const auto       f0     = static_cast<long long>(std::floor(first + 0.5));
+            const auto       k      = static_cast<long long>(std::floor(factor + 0.5));
+            if (k < 1 || std::abs(first - f0) > eps || std::abs(factor - k) > eps) return false;
+            if (f0 < 0 || f0 + k * target.bins > axis_.bins) return false;
+
+            out.assign(static_cast<std::size_t>(target.bins), 0.0);
+            for (long long i = 0; i < k * target.bins; i++)
+                out[static_cast<std::size_t>(i / k)] += counts_[static_cast<std::size_t>(f0 + i)];
+            return true;
+        }
+
+    private:
+        bin_axis                   axis_;
+        std::vector<double>        counts_;
+        std::uint64_t              version_ = 0;
+        std::mutex                 mutex_;
+        std::vector<std::uint64_t> pending_;
+        bool                       has_pending_ = false;
+        bars                       bars_;
+        int                        bars_factor_  = 0;
+        std::uint64_t              bars_version_ = 0;
+    };
+
+    /// @brief 2D histogram (heatmap) with fixed fine cells, filled incrementally; same threading as histogram.
+    class histogram_2d {
+    public:
+        /// @brief Worker-local counts over the histogram's fine grid.
+        class partial {
+        public:
+            void add(const std::span<const float> xs, const std::span<const float> ys) noexcept {
+                detail::accumulate_bins_2d(xs, ys, x_, y_, std::span<std::uint64_t>{counts_});
+            }
+            void add(const std::span<const double> xs, const std::span<const double> ys) noexcept {
+                detail::accumulate_bins_2d(xs, ys, x_, y_, std::span<std::uint64_t>{counts_});
+            }
+
+        private:
+            friend class histogram_2d;
+            partial(const bin_axis &x, const bin_axis &y) :
+                x_(x), y_(y), counts_(static_cast<std::size_t>(x.bins) * static_cast<std::size_t>(y.bins)) {}
+
+            bin_axis                   x_;
+            bin_axis                   y_;
+            std::vector<std::uint64_t> counts_;
+        };
+
+        /// @brief Row-major cell values (row 0 = top) ready for PlotHeatmap.
+        struct grid {
+            std::vector<double> values;
+            int                 rows = 0;
+            int                 cols = 0;
+        };
+
+        histogram_2d(const bin_axis &x, const bin_axis &y) :
+            x_(x), y_(y), counts_(static_cast<std::size_t>(x.bins) * static_cast<std::size_t>(y.bins)),
+            pending_(counts_.size()) {}
+
+        [[nodiscard]] partial make_partial() const { return partial{x_, y_}; }
+
+        /// @brief Bin (x, y) pairs directly into the histogram (owning thread).
+        void add(const std::span<const float> xs, const std::span<const float> ys) noexcept {
+            detail::accumulate_bins_2d(xs, ys, x_, y_, std::span<double>{counts_});
+            ++version_;
+        }
+        /// @copydoc add(std::span<const float>, std::span<const float>)
+        void add(const std::span<const double> xs, const std::span<const double> ys) noexcept {
+            detail::accumulate_bins_2d(xs, ys, x_, y_, std::span<double>{counts_});
+            ++version_;
+        }
+
+        /// @brief Hand a partial's counts over to the histogram and zero it (any thread).
+        void publish(partial &p) {
+            const std::scoped_lock lock{mutex_};
+            for (std::size_t i = 0; i < pending_.size(); i++) pending_[i] += std::exchange(p.counts_[i], 0);
+            has_pending_ = true;
+        }
+
+        /// @brief Fold published partials into the counts (owning thread). Returns true if any arrived.
+        bool sync() {
+            const std::scoped_lock lock{mutex_};
+            if (!has_pending_) return false;
+            for (std::size_t i = 0; i < pending_.size(); i++)
+                counts_[i] += static_cast<double>(std::exchange(pending_[i], 0));
+            has_pending_ = false;
+            ++version_;
+            return true;
+        }
+
+        /// @brief Zero the counts, dropping partials published but not yet synced (owning thread).
+        void clear() {
+            const std::scoped_lock lock{mutex_};
+            std::ranges::fill(counts_, 0.0);
+            std::ranges::fill(pending_, std::uint64_t{0});
+            has_pending_ = false;
+            ++version_;
+        }
+
+        [[nodiscard]] const bin_axis         &x_axis() const noexcept { return x_; }
+        [[nodiscard]] const bin_axis         &y_axis() const noexcept { return y_; }
+        [[nodiscard]] std::span<const double> counts() const noexcept { return counts_; }
+        [[nodiscard]] std::uint64_t           version() const noexcept { return version_; }
+
+        /// @brief Cells of fx by fy fine cells each, summed from the fine counts; cached like histogram::grouped().
+        [[nodiscard]] const grid &grouped(int fx, int fy) {
+            fx = std::clamp(fx, 1, x_.bins);
+            fy = std::clamp(fy, 1, y_.bins);
+            if (fx != grid_fx_ || fy != grid_fy_ || grid_version_ != version_) {
+                grid_.cols = detail::grouped_bins(x_.bins, fx);
+                grid_.rows = detail::grouped_bins(y_.bins, fy);
+                grid_.values.assign(static_cast<std::size_t>(grid_.rows) * static_cast<std::size_t>(grid_.cols), 0.0);
+                // Fine row r counts down from max y; group from the bottom so partial groups sit at the top.
+                for (int r = 0; r < y_.bins; r++) {
+                    const int gr = grid_.rows - 1 - (y_.bins - 1 - r) / fy;
+                    for (int c = 0; c < x_.bins; c++)
+                        grid_.values[static_cast<std::size_t>(gr * grid_.cols + c / fx)] +=
+                            counts_[static_cast<std::size_t>(r * x_.bins + c)];
+                }
+                grid_fx_      = fx;
+                grid_fy_      = fy;
+                grid_version_ = version_;
+            }
+            return grid_;
+        }
+
+    private:
+        bin_axis                   x_;
+        bin_axis                   y_;
+        std::vector<double>        counts_;
+        std::uint64_t              version_ = 0;
+        std::mutex                 mutex_;
+        std::vector<std::uint64_t> pending_;
+        bool                       has_pending_ = false;
+        grid                       grid_;
+        int                        grid_fx_      = 0;
+        int                        grid_fy_      = 0;
+        std::uint64_t              grid_version_ = 0;
+    };
+
+    /**
+     * @brief sync() @p h and PlotBars it at @p factor fine bins per bar.
+     * @param label  Item label.
+     * @param h      Histogram (owning thread).
+     * @param factor Fine bins per bar.
+     * @param flags  Forwarded to PlotBars.
+     */
+    inline void plot_histogram(const char *label, histogram &h, const int factor = 1,
+                               const ImPlotBarsFlags flags = 0) {
+        h.sync();
+        const histogram::bars &b = h.grouped(factor);
+        ImPlot::PlotBars(label, b.centers.data(), b.counts.data(), static_cast<int>(b.counts.size()), b.width, flags);
+    }
+
+    /**
+     * @brief sync() @p h and PlotHeatmap it at fx by fy fine cells per cell.
+     * @param label Item label.
+     * @param h     2D histogram (owning thread).
+     * @param fx    Fine x bins per cell.
+     * @param fy    Fine y bins per cell.
+     * @param flags Forwarded to PlotHeatmap. Cell labels are off: grids are usually far too dense.
+     */
+    inline void plot_histogram_2d(const char *label, histogram_2d &h, const int fx = 1, const int fy = 1,
+                                  const ImPlotHeatmapFlags flags = 0) {
+        h.sync();
+        const histogram_2d::grid &g     = h.grouped(fx, fy);
+        const double              x_max = h.x_axis().edge(g.cols * std::clamp(fx, 1, h.x_axis().bins));
+        const double              y_max = h.y_axis().edge(g.rows * std::clamp(fy, 1, h.y_axis().bins));
+        ImPlot::PlotHeatmap(label, g.values.data(), g.rows, g.cols, 0.0, 0.0, nullptr,
+                            ImPlotPoint(h.x_axis().min, h.y_axis().min), ImPlotPoint(x_max, y_max), flags);
+    }
+
+} // namespace imgui_util::implot
@@ -0,0 +1,282 @@
+/// @file pyramid.hpp
+/// @brief Multi-resolution min/max/mean pyramid for plotting huge append-only series in O(pixels).
+///
+/// decimate.hpp reduces the visible window per frame, which still reads every visible sample:
+/// fully zoomed out on a 1B-sample capture that is 1B reads per view change. A sample_pyramid
+/// precomputes a mip chain of 2^k-sample buckets (min, max, sum) so a query reads only the
+/// level whose buckets are about one pixel wide. Level 0 starts at 2^min_shift samples to
+/// keep memory at a fraction of the data (default 64-sample buckets: ~0.5 byte per float
+/// sample for the whole chain); narrower views fall back to scanning raw samples, which is
+/// then cheap because fewer than pixel_width * 2^min_shift samples are visible.
+///
+/// The pyramid only reads its samples through a std::span, so they can live in an mmap'd
+/// file; building streams through the array once, front to back.
+///
+/// Usage:
+/// @code
+///   // once, off the UI thread (samples must stay valid and unchanged until the build finishes)
+///   auto pending = implot::sample_pyramid<float>::build_async(ys);
+///   // each frame
+///   if (pending.valid() && pending.wait_for(0s) == std::future_status::ready) pyr = pending.get();
+///   pyr.append(ys); // after new samples were appended: O(new samples)
+///   if (implot::plot p{"Capture"}) implot::plot_line_pyramid("ch0", implot::uniform_series{ys}, pyr, cache);
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <implot.h>
+#include <span>
+#include <vector>
+
+#include "imgui_util/plot/decimate.hpp"
+
+namespace imgui_util::implot {
+
+    /// @brief What plot_line_pyramid() draws from each bucket.
+    enum class pyramid_mode : std::uint8_t {
+        envelope, ///< Min and max of every bucket (two points per bucket).
+        mean,     ///< Bucket mean (one point per bucket).
+    };
+
+    namespace detail {
+
+        /// @brief Process-wide generation source, so two pyramids never report the same generation.
+        [[nodiscard]] inline std::uint64_t next_pyramid_generation() noexcept {
+            static std::atomic<std::uint64_t> last{0};
+            return last.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Min/max/sum mip chain over an append-only sample array.
+     *
+     * levels()[j] holds buckets of 2^(min_shift + j) samples; the last bucket of every level
+     * may be partial and is recomputed on append. The top level has a single bucket.
+     * @tparam T Arithmetic sample type.
+     */
+    template<typename T>
+    class sample_pyramid {
+    public:
+        static constexpr unsigned default_min_shift = 6;
+
+        /// @brief Per-level bucket statistics (structure of arrays).
+        struct level {
+            std::vector<T>            min;
+            std::vector<T>            max;
+            std::vector<double>       sum;
+            std::vector<std::uint8_t> max_first; ///< 1 if the bucket's (first) max precedes its (first) min.
+        };
+
+        explicit sample_pyramid(const unsigned min_shift = default_min_shift) noexcept : min_shift_(min_shift) {}
+
+        /**
+         * @brief Build a pyramid over @p samples on a background thread.
+         *
+         * The samples are only read, so a read-only mapping is fine; they must stay valid and
+         * unchanged until the future is ready.
+         */
+        [[nodiscard]] static std::future<sample_pyramid> build_async(std::span<const T> samples,
+                                                                     const unsigned     min_shift = default_min_shift) {
+            return std::async(std::launch::async, [samples, min_shift] {
+                sample_pyramid p{min_shift};
+                p.append(samples);
+                return p;
+            });
+        }
+
+        /**
+         * @brief Summarize samples added since the last call.
+         *
+         * @p samples is the whole array (the previously summarized prefix must be unchanged);
+         * only buckets touching [size(), samples.size()) are recomputed, so an append costs
+         * O(new samples + levels). A shorter array than size() rebuilds from scratch; for a
+         * replaced array of the same or greater length, clear() first.
+         */
+        void append(std::span<const T> samples) {
+            const std::size_t n = samples.size();
+            if (n < size_) clear();
+            if (n == size_) return;
+            generation_ = detail::next_pyramid_generation();
+
+            std::size_t dirty = size_ >> min_shift_;
+            std::size_t count = ((n - 1) >> min_shift_) + 1;
+            for (std::size_t j = 0;; ++j) {
+                if (j == levels_.size()) levels_.emplace_back();
+                level &l = levels_[j];
+                l.min.resize(count);
+                l.max.resize(count);
+                l.sum.resize(count);
+                l.max_first.resize(count);
+                if (j == 0) summarize_samples(samples, l, dirty);
+                else summarize_level(levels_[j - 1], l, dirty);
+
+                if (count == 1) {
+                    levels_.resize(j + 1);
+                    break;
+                }
+                dirty >>= 1;
+                count = (count + 1) / 2;
+            }
+            size_ = n;
+        }
+
+        void clear() noexcept {
+            levels_.clear();
+            size_       = 0;
+            generation_ = detail::next_pyramid_generation();
+        }
+
+        /// @brief Number of samples summarized.
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+        /**
+         * @brief Changes on every append() that adds samples and on clear().
+         *
+         * Generations are unique across pyramids (copies share theirs), so a pyramid rebuilt or
+         * replaced by another one over different samples never reports a stale generation.
+         */
+        [[nodiscard]] std::uint64_t generation() const noexcept { return generation_; }
+
+        [[nodiscard]] unsigned min_shift() const noexcept { return min_shift_; }
+
+        [[nodiscard]] std::span<const level> levels() const noexcept { return levels_; }
+
+        /// @brief Samples per bucket at level @p j.
+        [[nodiscard]] std::size_t bucket_size(const std::size_t j) const noexcept {
+            return std::size_t{1} << (min_shift_ + j);
+        }
+
+        /**
+         * @brief Level whose buckets are one to two pixel columns wide, or -1 for raw samples.
+         *
+         * That is half to one bucket per column, so envelope mode emits one to two points per column.
+         * @param visible     Number of visible samples.
+         * @param pixel_width Plot width in pixels.
+         */
+        [[nodiscard]] int level_for(const std::size_t visible, const int pixel_width) const noexcept {
+            if (pixel_width <= 0 || levels_.empty()) return -1;
+            const std::size_t per_px = visible / static_cast<std::size_t>(pixel_width);
+            const auto        shift  = static_cast<unsigned>(std::bit_width(per_px)); // bucket > per_px samples
+            if (shift < min_shift_) return -1;
+            return static_cast<int>(std::min<std::size_t>(shift - min_shift_, levels_.size() - 1));
+        }
+
+        /**
+         * @brief Reduce samples [r.first, r.last) of @p s for a @p pixel_width wide plot.
+         *
+         * @p s must be the series this pyramid summarizes (y(i) == samples[i]); it supplies the
+         * x coordinates. Samples past size() are ignored. Views too narrow for level 0 fall back
+         * to decimate_minmax() over the raw samples.
+         */
+        template<plot_series S>
+        void decimate(const S &s, index_range r, const double x_min, const double x_max, const int pixel_width,
+                      const pyramid_mode mode, std::vector<ImPlotPoint> &out) const {
+            r.last      = std::min(r.last, size_);
+            r.first     = std::min(r.first, r.last);
+            const int j = level_for(r.size(), pixel_width);
+            if (r.empty() || j < 0) {
+                implot::decimate(s, r, x_min, x_max, pixel_width, decimation::minmax, out);
+                return;
+            }
+
+            const level      &l     = levels_[static_cast<std::size_t>(j)];
+            const unsigned    shift = min_shift_ + static_cast<unsigned>(j);
+            const std::size_t last  = ((r.last - 1) >> shift) + 1;
+            out.clear();
+            out.reserve(2 * (last - (r.first >> shift)));
+            for (std::size_t b = r.first >> shift; b < last; ++b) {
+                const std::size_t start = b << shift;
+                const std::size_t count = std::min(std::size_t{1} << shift, size_ - start);
+                const std::size_t mid   = start + count / 2;
+                if (mode == pyramid_mode::mean) {
+                    out.emplace_back(s.x(mid), l.sum[b] / static_cast<double>(count));
+                } else {
+                    // In sample order, so a falling edge is drawn falling
+                    const bool max_first = l.max_first[b] != 0;
+                    out.emplace_back(s.x(start), static_cast<double>(max_first ? l.max[b] : l.min[b]));
+                    out.emplace_back(s.x(mid), static_cast<double>(max_first ? l.min[b] : l.max[b]));
+                }
+            }
+        }
+
+    private:
+        unsigned           min_shift_;
+        std::size_t        size_       = 0;
+        std::uint64_t      generation_ = detail::next_pyramid_generation();
+        std::vector<level> levels_;
+
+        void summarize_samples(std::span<const T> samples, level &l, const std::size_t from) const {
+            for (std::size_t b = from; b < l.min.size(); ++b) {
+                const std::size_t start = b << min_shift_;
+                const auto        chunk = samples.subspan(start, std::min(bucket_size(0), samples.size() - start));
+                std::size_t       lo    = 0;
+                std::size_t       hi    = 0;
+                double            sum   = 0.0;
+                for (std::size_t i = 0; i < chunk.size(); ++i) {
+                    if (chunk[i] < chunk[lo]) lo = i;
+                    if (chunk[hi] < chunk[i]) hi = i;
+                    sum += static_cast<double>(chunk[i]);
+                }
+                l.min[b]       = chunk[lo];
+                l.max[b]       = chunk[hi];
+                l.sum[b]       = sum;
+                l.max_first[b] = hi < lo ? 1 : 0;
+            }
+        }
+
+        static void summarize_level(const level &src, level &l, const std::size_t from) {
+            for (std::size_t b = from; b < l.min.size(); ++b) {
+                const std::size_t a = 2 * b;
+                if (a + 1 < src.min.size()) {
+                    // Ties keep the left child, i.e. the first occurrence
+                    const std::size_t lo = src.min[a + 1] < src.min[a] ? a + 1 : a;
+                    const std::size_t hi = src.max[a] < src.max[a + 1] ? a + 1 : a;
+                    l.min[b]             = src.min[lo];
+                    l.max[b]             = src.max[hi];
+                    l.sum[b]             = src.sum[a] + src.sum[a + 1];
+                    l.max_first[b]       = lo == hi ? src.max_first[lo] : static_cast<std::uint8_t>(hi < lo);
+                } else {
+                    l.min[b]       = src.min[a];
+                    l.max[b]       = src.max[a];
+                    l.sum[b]       = src.sum[a];
+                    l.max_first[b] = src.max_first[a];
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief PlotLine a pyramid-backed series at the current plot's resolution.
+     *
+     * Must be called between BeginPlot/EndPlot. Cost is O(pixel width) at any zoom level once
+     * the view spans more than pixel_width * 2^min_shift samples. The pyramid's generation is
+     * the cache version, so appending, clearing or swapping in another pyramid invalidates the
+     * cached points automatically.
+     * @param label Item label.
+     * @param s     Series summarized by @p pyr (supplies x coordinates).
+     * @param pyr   Pyramid over the series' y values.
+     * @param cache Per-series cache kept across frames.
+     * @param mode  Envelope or mean line.
+     * @param flags Forwarded to PlotLineG.
+     */
+    template<plot_series S, typename T>
+    void plot_line_pyramid(const char *label, const S &s, const sample_pyramid<T> &pyr, decimation_cache &cache,
+                           const pyramid_mode mode = pyramid_mode::envelope, const ImPlotLineFlags flags = 0) {
+        const ImPlotRect             lim = ImPlot::GetPlotLimits();
+        const int                    w   = static_cast<int>(ImPlot::GetPlotSize().x);
+        const reduction_key          key{reduction_key::family::pyramid, static_cast<std::uint8_t>(mode)};
+        std::span<const ImPlotPoint> pts = cache.update_with(
+            pyr.generation(), lim.X.Min, lim.X.Max, w, key, [&](std::vector<ImPlotPoint> &out) {
+                pyr.decimate(s, visible_range(s, lim.X.Min, lim.X.Max), lim.X.Min, lim.X.Max, w, mode, out);
+            });
+        ImPlot::PlotLineG(label, &span_getter, const_cast<ImPlotPoint *>(pts.data()), // NOLINT: getter is read-only
+                          static_cast<int>(pts.size()), flags);
+    }
+
+} // namespace imgui_util::implot
@@ -0,0 +1,184 @@
+/// @file streaming.hpp
+/// @brief Single-producer lock-free scrolling buffer of (x, y) samples for real-time plots.
+///
+/// An acquisition thread push()es samples without locks or waiting; when the ring is full the
+/// oldest samples are overwritten. The UI thread takes a snapshot() each frame: two spans over
+/// the ring (before and after the wrap point) covering the newest capacity() samples, with no
+/// copying. The ring holds spare "guard" slots beyond capacity(), so the producer can keep
+/// writing while the UI reads a snapshot without touching the snapshotted slots; intact()
+/// reports whether the producer outran the guard during the frame.
+///
+/// Sample fields are written and read through relaxed std::atomic_ref, and the producer
+/// fences before each write like a seqlock writer. Reading a slot the producer is
+/// overwriting is therefore not a data race: it yields a stale or mixed sample, and
+/// intact() (checked after the reads) reports that it happened.
+///
+/// Usage:
+/// @code
+///   implot::streaming_series<double> rx{100'000};
+///   // producer thread
+///   rx.push(t, value);
+///   // UI thread, each frame
+///   const auto snap = rx.snapshot();
+///   snap.copy_to(rows); // when every value must be exact: copy, then check intact()
+///   if (!rx.intact(snap)) { /* the producer lapped the guard; rows may hold torn samples */ }
+///   if (implot::plot p{"Live"}) implot::plot_line_decimated("rx", snap, cache, snap.version());
+///   // or without decimation:
+///   implot::getter g{snap};
+///   ImPlot::PlotLineG("rx", g.get(), g.data(), static_cast<int>(snap.size()));
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <implot.h>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "imgui_util/plot/raii.hpp"
+
+namespace imgui_util::implot {
+
+    /**
+     * @brief Fixed-capacity SPSC ring of (x, y) samples.
+     *
+     * Exactly one thread may push; any number of threads may take snapshots. x should be
+     * non-decreasing (e.g. timestamps) for the snapshot to be used with decimate.hpp.
+     * @tparam T Arithmetic sample type with lock-free std::atomic_ref.
+     */
+    template<typename T>
+        requires std::is_arithmetic_v<T> && std::atomic_ref<T>::is_always_lock_free
+    class streaming_series {
+        static constexpr std::size_t field_align = std::atomic_ref<T>::required_alignment;
+
+        [[nodiscard]] static T load(const T &field) noexcept {
+            // The ring's storage is never const; only the view's spans are
+            return std::atomic_ref<T>{const_cast<T &>(field)}.load(std::memory_order_relaxed); // NOLINT
+        }
+
+    public:
+        struct sample {
+            alignas(field_align) T x;
+            alignas(field_align) T y;
+        };
+
+        /**
+         * @brief Newest samples at the time of snapshot(), oldest first, split at the ring's wrap point.
+         *
+         * first and second alias live ring slots: read samples through the accessors below
+         * (atomic loads), not by dereferencing the spans.
+         */
+        struct view {
+            std::span<const sample> first;
+            std::span<const sample> second;
+            std::uint64_t           end = 0; ///< Total samples pushed when the snapshot was taken.
+
+            [[nodiscard]] std::size_t size() const noexcept { return first.size() + second.size(); }
+            [[nodiscard]] bool        empty() const noexcept { return size() == 0; }
+
+            [[nodiscard]] sample operator[](const std::size_t i) const noexcept {
+                const sample &s = i < first.size() ? first[i] : second[i - first.size()];
+                return {load(s.x), load(s.y)};
+            }
+            [[nodiscard]] double x(const std::size_t i) const noexcept { return static_cast<double>((*this)[i].x); }
+            [[nodiscard]] double y(const std::size_t i) const noexcept { return static_cast<double>((*this)[i].y); }
+
+            /// @brief Getter-compatible access, so `getter{snap}` plots the snapshot directly.
+            [[nodiscard]] ImPlotPoint operator()(const int idx) const noexcept {
+                const sample s = (*this)[static_cast<std::size_t>(idx)];
+                return {static_cast<double>(s.x), static_cast<double>(s.y)};
+            }
+
+            /// @brief Copy the samples into @p out (resized), oldest first.
+            void copy_to(std::vector<sample> &out) const {
+                out.resize(size());
+                std::size_t i = 0;
+                for (const auto part: {first, second})
+                    for (const sample &s: part) out[i++] = {load(s.x), load(s.y)};
+            }
+
+            /// @brief Changes whenever new samples arrive; use as the decimation_cache version.
+            [[nodiscard]] std::uint64_t version() const noexcept { return end; }
+        };
+
+        /**
+         * @param capacity Samples visible in a snapshot.
+         * @param guard    Minimum spare slots the producer may fill while a snapshot is in use;
+         *                 rounded up so the ring size is a power of two. 0 picks capacity / 4.
+         */
+        explicit streaming_series(const std::size_t capacity, const std::size_t guard = 0) :
+            capacity_(std::max<std::size_t>(capacity, 1)),
+            mask_(std::bit_ceil(capacity_ + std::max<std::size_t>(guard != 0 ? guard : capacity_ / 4, 1)) - 1),
+            buf_(std::make_unique_for_overwrite<sample[]>(mask_ + 1)) {}
+
+        streaming_series(const streaming_series &)            = delete;
+        streaming_series &operator=(const streaming_series &) = delete;
+
+        /// @brief Append one sample (producer thread only; wait-free).
+        void push(const T x, const T y) noexcept {
+            const std::uint64_t h = head_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release); // see intact()
+            store(buf_[h & mask_], {x, y});
+            head_.store(h + 1, std::memory_order_release);
+        }
+
+        /// @brief Append a block of samples with a single publish (producer thread only; wait-free).
+        void push(std::span<const sample> samples) noexcept {
+            const std::uint64_t h = head_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (std::size_t i = 0; i < samples.size(); ++i) store(buf_[(h + i) & mask_], samples[i]);
+            head_.store(h + samples.size(), std::memory_order_release);
+        }
+
+        /// @brief View of the newest min(pushed(), capacity()) samples; never blocks the producer.
+        [[nodiscard]] view snapshot() const noexcept {
+            const std::uint64_t h     = head_.load(std::memory_order_acquire);
+            const std::size_t   n     = static_cast<std::size_t>(std::min<std::uint64_t>(h, capacity_));
+            const std::size_t   start = static_cast<std::size_t>((h - n) & mask_);
+            const std::size_t   run   = std::min(n, mask_ + 1 - start);
+            return {{buf_.get() + start, run}, {buf_.get(), n - run}, h};
+        }
+
+        /**
+         * @brief True if the producer has not overwritten any slot of @p snap since it was taken.
+         *
+         * Check after reading a snapshot when a producer burst could exceed guard() samples per
+         * frame; a false result means some of the values read may be torn.
+         *
+         * Seqlock argument: a read that saw an overwrite of a snapshot slot happened after the
+         * producer's fence that follows publishing head >= snap.end + guard(), so the head
+         * loaded here, after an acquire fence, is at least that. The sample at index head may
+         * be mid-write, hence the strict comparison.
+         */
+        [[nodiscard]] bool intact(const view &snap) const noexcept {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return head_.load(std::memory_order_relaxed) - snap.end < guard();
+        }
+
+        /// @brief Total samples pushed so far.
+        [[nodiscard]] std::uint64_t pushed() const noexcept { return head_.load(std::memory_order_acquire); }
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        /// @brief Spare ring slots; a snapshot stays intact while fewer than guard() samples are pushed after it.
+        [[nodiscard]] std::size_t guard() const noexcept { return mask_ + 1 - capacity_; }
+
+    private:
+        static void store(sample &slot, const sample &s) noexcept {
+            std::atomic_ref<T>{slot.x}.store(s.x, std::memory_order_relaxed);
+            std::atomic_ref<T>{slot.y}.store(s.y, std::memory_order_relaxed);
+        }
+
+        std::size_t               capacity_;
+        std::size_t               mask_;
+        std::unique_ptr<sample[]> buf_;
+
+        alignas(64) std::atomic<std::uint64_t> head_{0}; // own cache line: the only shared write
+    };
+
+} // namespace imgui_util::implot
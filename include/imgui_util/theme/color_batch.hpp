@@ -0,0 +1,80 @@
+/// @file color_batch.hpp
+/// @brief Batch color conversions over spans (SSE2 / AVX2 kernels, scalar fallback).
+///
+/// Colors are processed in structure-of-arrays form: one contiguous float span per
+/// channel, so each kernel streams 4 (SSE2) or 8 (AVX2) colors per instruction. The
+/// scalar constexpr functions in color_math.hpp are the reference implementation; the
+/// kernels reproduce them to within ~1e-6 and handle the tail of each batch with them.
+///
+/// Usage:
+/// @code
+///   std::vector<float> r(n), g(n), b(n), a(n);
+///   const color::float4_soa soa{r, g, b, a};
+///   color::unpack_u32(packed_colors, soa);   // ImU32 -> float channels
+///   color::srgb_to_linear(soa);              // in place
+///   color::linear_to_oklab(soa);             // x/y/z now hold L/a/b
+///   color::oklab_to_oklch(soa);
+///   ...
+///   color::pack_u32(soa, packed_colors);     // float channels -> ImU32
+/// @endcode
+///
+/// The kernel width is chosen at compile time from the target flags: build with
+/// -mavx2 (or -march=x86-64-v3 / native) for the 8-wide path; x86-64 always has SSE2.
+
+#pragma once
+
+#include <cstddef>
+#include <imgui.h>
+#include <span>
+#include <string_view>
+
+namespace imgui_util::color {
+
+    /// @brief Structure-of-arrays view over colors: one float span per channel, all the same length.
+    ///
+    /// Channels are named after ImVec4: for RGB data x/y/z are r/g/b, for HSV h/s/v,
+    /// for OKLab L/a/b, for OKLCH L/C/h. w is alpha and is never modified by conversions.
+    struct float4_soa {
+        std::span<float> x;
+        std::span<float> y;
+        std::span<float> z;
+        std::span<float> w;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return x.size(); }
+    };
+
+    /// @brief Name of the compiled kernel set: "avx2", "sse2" or "scalar".
+    [[nodiscard]] std::string_view batch_backend() noexcept;
+
+    /// @brief Unpack packed RGBA colors into channels in [0, 1] (reference: u32_to_float4).
+    void unpack_u32(std::span<const ImU32> in, const float4_soa &out) noexcept;
+
+    /// @brief Pack channels into RGBA colors, clamping to [0, 1] (reference: float4_to_u32).
+    void pack_u32(const float4_soa &in, std::span<ImU32> out) noexcept;
+
+    /// @brief In-place sRGB decode of a single channel span.
+    void srgb_to_linear(std::span<float> channel) noexcept;
+    /// @brief In-place sRGB encode of a single channel span.
+    void linear_to_srgb(std::span<float> channel) noexcept;
+
+    /// @brief In-place sRGB decode of x/y/z (alpha untouched).
+    void srgb_to_linear(const float4_soa &colors) noexcept;
+    /// @brief In-place sRGB encode of x/y/z (alpha untouched).
+    void linear_to_srgb(const float4_soa &colors) noexcept;
+
+    /// @brief In-place RGB -> HSV (hue in turns).
+    void rgb_to_hsv(const float4_soa &colors) noexcept;
+    /// @brief In-place HSV -> RGB.
+    void hsv_to_rgb(const float4_soa &colors) noexcept;
+
+    /// @brief In-place linear sRGB -> OKLab.
+    void linear_to_oklab(const float4_soa &colors) noexcept;
+    /// @brief In-place OKLab -> linear sRGB.
+    void oklab_to_linear(const float4_soa &colors) noexcept;
+
+    /// @brief In-place OKLab -> OKLCH (hue in turns).
+    void oklab_to_oklch(const float4_soa &colors) noexcept;
+    /// @brief In-place OKLCH -> OKLab.
+    void oklch_to_oklab(const float4_soa &colors) noexcept;
+
+} // namespace imgui_util::color
@@ -1,5 +1,5 @@
 /// @file color_math.hpp
-/// @brief Constexpr RGB math and ImU32/ImVec4 conversions.
+/// @brief Constexpr RGB math, ImU32/ImVec4 conversions, and color-space transforms.
 ///
 /// Usage:
 /// @code
@@ -10,14 +10,23 @@
 ///   ImVec4 lit  = offset(base, 0.1f);       // per-channel add
 ///   ImU32  packed = float4_to_u32(col);      // ImVec4 -> packed RGBA
 ///   ImVec4 back   = u32_to_float4(packed);   // packed RGBA -> ImVec4
+///   ImVec4 lch    = oklab_to_oklch(linear_to_oklab(srgb_to_linear(col)));
 /// @endcode
+///
+/// The color-space functions (sRGB/linear, HSV, OKLab, OKLCH) are the scalar reference
+/// for the batch kernels in color_batch.hpp. They are constexpr: pow, cbrt and atan2 use
+/// polynomial approximations, and sqrt_approx switches to std::sqrt outside constant
+/// evaluation. Hue is expressed in turns ([0, 1)) like ImGui's HSV helpers.
 
 #pragma once
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cmath>
 #include <cstdint>
 #include <imgui.h>
+#include <numbers>
 
 namespace imgui_util::color {
 
@@ -194,4 +203,193 @@ namespace imgui_util::color {
                   a.channels[2] + (b.channels[2] - a.channels[2]) * t}}};
     }
 
+    // ========================================================================
+    // Color-space transforms (scalar constexpr reference)
+    // ========================================================================
+
+    namespace detail {
+
+        /// @brief log2 for normal x > 0 (abs. error < 1e-6); exponent split plus atanh series.
+        [[nodiscard]] constexpr float log2_approx(const float x) noexcept {
+            const auto bits = std::bit_cast<std::uint32_t>(x);
+            float      e    = static_cast<float>(static_cast<int>(bits >> 23 & 0xFF) - 127);
+            float      m    = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u); // [1, 2)
+            if (m > std::numbers::sqrt2_v<float>) {
+                m *= 0.5f;
+                e += 1.0f;
+            }
+            const float t  = (m - 1.0f) / (m + 1.0f);
+            const float t2 = t * t;
+            const float p  = t
+                * (2.0f + t2 * (2.0f / 3.0f + t2 * (2.0f / 5.0f + t2 * (2.0f / 7.0f + t2 * (2.0f / 9.0f)))));
+            return e + p * std::numbers::log2e_v<float>;
+        }
+
+        /// @brief 2^y (rel. error < 1e-7); round-to-nearest split plus degree-7 Taylor polynomial.
+        [[nodiscard]] constexpr float exp2_approx(float y) noexcept {
+            y             = std::clamp(y, -126.0f, 126.0f);
+            const int   n = static_cast<int>(y + (y >= 0.0f ? 0.5f : -0.5f));
+            const float f = (y - static_cast<float>(n)) * std::numbers::ln2_v<float>;
+            const float p = 1.0f
+                + f
+                    * (1.0f
+                       + f
+                           * (1.0f / 2.0f
+                              + f
+                                  * (1.0f / 6.0f
+                                     + f
+                                         * (1.0f / 24.0f
+                                            + f * (1.0f / 120.0f + f * (1.0f / 720.0f + f * (1.0f / 5040.0f)))))));
+            return p * std::bit_cast<float>(static_cast<std::uint32_t>(n + 127) << 23);
+        }
+
+        /// @brief x^y for x > 0; returns 0 for x <= 0.
+        [[nodiscard]] constexpr float pow_approx(const float x, const float y) noexcept {
+            return x > 0.0f ? exp2_approx(y * log2_approx(x)) : 0.0f;
+        }
+
+        /// @brief Signed cube root.
+        [[nodiscard]] constexpr float cbrt_approx(const float x) noexcept {
+            if (x == 0.0f) return 0.0f;
+            const float r = exp2_approx(log2_approx(x < 0.0f ? -x : x) * (1.0f / 3.0f));
+            return x < 0.0f ? -r : r;
+        }
+
+        [[nodiscard]] constexpr float sqrt_approx(const float x) noexcept {
+            if consteval {
+                return x > 0.0f ? exp2_approx(0.5f * log2_approx(x)) : 0.0f;
+            } else {
+                return x > 0.0f ? std::sqrt(x) : 0.0f;
+            }
+        }
+
+        /// @brief atan(z) for |z| <= 1 (abs. error < 2e-6 rad).
+        [[nodiscard]] constexpr float atan_unit(const float z) noexcept {
+            const float z2 = z * z;
+            return z
+                * (0.99997726f
+                   + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+        }
+
+        /// @brief atan2(y, x) expressed in turns, wrapped to [0, 1).
+        [[nodiscard]] constexpr float atan2_turns(const float y, const float x) noexcept {
+            constexpr float pi = std::numbers::pi_v<float>;
+            const float     ax = x < 0.0f ? -x : x;
+            const float     ay = y < 0.0f ? -y : y;
+            const float     mx = std::max(ax, ay);
+            const float     mn = std::min(ax, ay);
+            float           a  = atan_unit(mx > 0.0f ? mn / mx : 0.0f);
+            if (ay > ax) a = pi * 0.5f - a;
+            if (x < 0.0f) a = pi - a;
+            if (y < 0.0f) a = -a;
+            const float turns = a * (0.5f / pi);
+            return turns < 0.0f ? turns + 1.0f : turns;
+        }
+
+        /// @brief sin(2*pi*u); folds u into a quarter turn, then degree-11 Taylor polynomial.
+        [[nodiscard]] constexpr float sin_turns(float u) noexcept {
+            u -= static_cast<float>(static_cast<int>(u + (u >= 0.0f ? 0.5f : -0.5f))); // [-0.5, 0.5]
+            if (u > 0.25f) u = 0.5f - u;
+            if (u < -0.25f) u = -0.5f - u;
+            const float x  = u * (2.0f * std::numbers::pi_v<float>);
+            const float x2 = x * x;
+            return x
+                * (1.0f
+                   + x2
+                       * (-1.0f / 6.0f
+                          + x2
+                              * (1.0f / 120.0f
+                                 + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f + x2 * (-1.0f / 39916800.0f))))));
+        }
+
+        [[nodiscard]] constexpr float cos_turns(const float u) noexcept {
+            return sin_turns(u + 0.25f);
+        }
+
+    } // namespace detail
+
+    /// @brief sRGB transfer function decode (gamma-encoded channel -> linear light).
+    [[nodiscard]] constexpr float srgb_to_linear(const float c) noexcept {
+        return c <= 0.04045f ? c * (1.0f / 12.92f) : detail::pow_approx((c + 0.055f) * (1.0f / 1.055f), 2.4f);
+    }
+
+    /// @brief sRGB transfer function encode (linear light -> gamma-encoded channel).
+    [[nodiscard]] constexpr float linear_to_srgb(const float c) noexcept {
+        return c <= 0.0031308f ? c * 12.92f : 1.055f * detail::pow_approx(c, 1.0f / 2.4f) - 0.055f;
+    }
+
+    /// @brief Decode the RGB channels of an sRGB color to linear light (alpha unchanged).
+    [[nodiscard]] constexpr ImVec4 srgb_to_linear(const ImVec4 &c) noexcept {
+        return {srgb_to_linear(c.x), srgb_to_linear(c.y), srgb_to_linear(c.z), c.w};
+    }
+
+    /// @brief Encode the RGB channels of a linear color to sRGB (alpha unchanged).
+    [[nodiscard]] constexpr ImVec4 linear_to_srgb(const ImVec4 &c) noexcept {
+        return {linear_to_srgb(c.x), linear_to_srgb(c.y), linear_to_srgb(c.z), c.w};
+    }
+
+    /// @brief RGB -> HSV, all channels in [0, 1] (hue in turns). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 rgb_to_hsv(const ImVec4 &c) noexcept {
+        const float mx = std::max({c.x, c.y, c.z});
+        const float mn = std::min({c.x, c.y, c.z});
+        const float d  = mx - mn;
+        float       h  = 0.0f;
+        if (d > 0.0f) {
+            if (mx == c.x) {
+                h = (c.y - c.z) / d;
+            } else if (mx == c.y) {
+                h = (c.z - c.x) / d + 2.0f;
+            } else {
+                h = (c.x - c.y) / d + 4.0f;
+            }
+            h *= 1.0f / 6.0f;
+            if (h < 0.0f) h += 1.0f;
+        }
+        return {h, mx > 0.0f ? d / mx : 0.0f, mx, c.w};
+    }
+
+    /// @brief HSV -> RGB, hue in turns (clamped to [0, 1]). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 hsv_to_rgb(const ImVec4 &c) noexcept {
+        const float h6 = std::clamp(c.x, 0.0f, 1.0f) * 6.0f;
+        auto        f  = [&](const float n) {
+            float k = n + h6; // [0, 12)
+            if (k >= 6.0f) k -= 6.0f;
+            return c.z - c.z * c.y * std::clamp(std::min(k, 4.0f - k), 0.0f, 1.0f);
+        };
+        return {f(5.0f), f(3.0f), f(1.0f), c.w};
+    }
+
+    /// @brief Linear sRGB -> OKLab (x = L, y = a, z = b). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 linear_to_oklab(const ImVec4 &c) noexcept {
+        const float l = detail::cbrt_approx(0.4122214708f * c.x + 0.5363325363f * c.y + 0.0514459929f * c.z);
+        const float m = detail::cbrt_approx(0.2119034982f * c.x + 0.6806995451f * c.y + 0.1073969566f * c.z);
+        const float s = detail::cbrt_approx(0.0883024619f * c.x + 0.2817188376f * c.y + 0.6299787005f * c.z);
+        return {0.2104542553f * l + 0.7936177850f * m - 0.0040720468f * s,
+                1.9779984951f * l - 2.4285922050f * m + 0.4505937099f * s,
+                0.0259040371f * l + 0.7827717662f * m - 0.8086757660f * s, c.w};
+    }
+
+    /// @brief OKLab -> linear sRGB (may fall outside [0, 1] for out-of-gamut colors). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 oklab_to_linear(const ImVec4 &c) noexcept {
+        const float l_ = c.x + 0.3963377774f * c.y + 0.2158037573f * c.z;
+        const float m_ = c.x - 0.1055613458f * c.y - 0.0638541728f * c.z;
+        const float s_ = c.x - 0.0894841775f * c.y - 1.2914855480f * c.z;
+        const float l  = l_ * l_ * l_;
+        const float m  = m_ * m_ * m_;
+        const float s  = s_ * s_ * s_;
+        return {4.0767416621f * l - 3.3077115913f * m + 0.2309699292f * s,
+                -1.2684380046f * l + 2.6097574011f * m - 0.3413193965f * s,
+                -0.0041960863f * l - 0.7034186147f * m + 1.7076147010f * s, c.w};
+    }
+
+    /// @brief OKLab -> OKLCH (x = L, y = chroma, z = hue in turns). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 oklab_to_oklch(const ImVec4 &c) noexcept {
+        return {c.x, detail::sqrt_approx(c.y * c.y + c.z * c.z), detail::atan2_turns(c.z, c.y), c.w};
+    }
+
+    /// @brief OKLCH -> OKLab. Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 oklch_to_oklab(const ImVec4 &c) noexcept {
+        return {c.x, c.y * detail::cos_turns(c.z), c.y * detail::sin_turns(c.z), c.w};
+    }
+
 } // namespace imgui_util::color
@@ -0,0 +1,138 @@
+/// @file contrast.hpp
+/// @brief Constexpr WCAG / APCA contrast metrics and an OKLCH lightness contrast solver.
+///
+/// Usage:
+/// @code
+///   float ratio = wcag_contrast(text, bg);                  // 1..21
+///   float lc    = apca_contrast(text, bg);                  // signed Lc, roughly -108..106
+///   ImVec4 fix  = solve_contrast(text, bg, 4.5f);           // nudge text lightness to reach AA
+///   ImVec4 lit  = shift_lightness(bg, 0.05f);               // perceptual lighten in OKLCH
+/// @endcode
+///
+/// All colors are gamma-encoded sRGB with alpha ignored for the metrics. The solver keeps
+/// hue and chroma and only searches OKLCH lightness, so adjusted colors keep their identity.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <imgui.h>
+
+#include "imgui_util/theme/color_math.hpp"
+
+namespace imgui_util::color {
+
+    /// @brief Contrast model used by contrast() and solve_contrast().
+    enum class contrast_metric : std::uint8_t {
+        wcag, ///< WCAG 2.x luminance ratio (1..21); AA body text needs 4.5.
+        apca, ///< APCA lightness contrast |Lc| (0..~108); body text needs ~60, large text ~45.
+    };
+
+    /// @brief sRGB -> OKLCH (x = L, y = chroma, z = hue in turns). Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 srgb_to_oklch(const ImVec4 &c) noexcept {
+        return oklab_to_oklch(linear_to_oklab(srgb_to_linear(c)));
+    }
+
+    /// @brief OKLCH -> sRGB, clipping out-of-gamut results to [0, 1]. Alpha unchanged.
+    [[nodiscard]] constexpr ImVec4 oklch_to_srgb(const ImVec4 &c) noexcept {
+        const ImVec4 s = linear_to_srgb(oklab_to_linear(oklch_to_oklab(c)));
+        return {std::clamp(s.x, 0.0f, 1.0f), std::clamp(s.y, 0.0f, 1.0f), std::clamp(s.z, 0.0f, 1.0f), c.w};
+    }
+
+    /**
+     * @brief Shift OKLCH lightness by @p delta, keeping hue and chroma (perceptual counterpart of offset()).
+     * @param c     sRGB color.
+     * @param delta Lightness delta in OKLab L units (L spans 0..1).
+     * @param alpha Replacement alpha; negative keeps the input alpha.
+     */
+    [[nodiscard]] constexpr ImVec4 shift_lightness(const ImVec4 &c, const float delta,
+                                                   const float alpha = -1.0f) noexcept {
+        ImVec4 lch = srgb_to_oklch(c);
+        lch.x      = std::clamp(lch.x + delta, 0.0f, 1.0f);
+        lch.w      = alpha < 0.0f ? c.w : alpha;
+        return oklch_to_srgb(lch);
+    }
+
+    /// @brief WCAG 2.x relative luminance of an sRGB color.
+    [[nodiscard]] constexpr float relative_luminance(const ImVec4 &c) noexcept {
+        return 0.2126f * srgb_to_linear(c.x) + 0.7152f * srgb_to_linear(c.y) + 0.0722f * srgb_to_linear(c.z);
+    }
+
+    /// @brief WCAG 2.x contrast ratio between two colors (symmetric, 1..21).
+    [[nodiscard]] constexpr float wcag_contrast(const ImVec4 &a, const ImVec4 &b) noexcept {
+        const float la = relative_luminance(a);
+        const float lb = relative_luminance(b);
+        return (std::max(la, lb) + 0.05f) / (std::min(la, lb) + 0.05f);
+    }
+
+    /**
+     * @brief APCA (0.0.98G-4g) lightness contrast of @p text on @p bg.
+     * @return Signed Lc: positive for dark text on a light background, negative for light on dark.
+     */
+    [[nodiscard]] constexpr float apca_contrast(const ImVec4 &text, const ImVec4 &bg) noexcept {
+        auto screen_y = [](const ImVec4 &c) {
+            float y = 0.2126729f * detail::pow_approx(c.x, 2.4f) + 0.7151522f * detail::pow_approx(c.y, 2.4f)
+                + 0.0721750f * detail::pow_approx(c.z, 2.4f);
+            if (y < 0.022f) y += detail::pow_approx(0.022f - y, 1.414f); // soft black clamp
+            return y;
+        };
+        const float yt = screen_y(text);
+        const float yb = screen_y(bg);
+        if (yb - yt < 0.0005f && yt - yb < 0.0005f) return 0.0f;
+
+        if (yb > yt) { // normal polarity: dark text on light background
+            const float s = (detail::pow_approx(yb, 0.56f) - detail::pow_approx(yt, 0.57f)) * 1.14f;
+            return s < 0.1f ? 0.0f : (s - 0.027f) * 100.0f;
+        }
+        const float s = (detail::pow_approx(yb, 0.65f) - detail::pow_approx(yt, 0.62f)) * 1.14f;
+        return s > -0.1f ? 0.0f : (s + 0.027f) * 100.0f;
+    }
+
+    /// @brief Contrast of @p fg on @p bg under @p metric; larger is always more contrast.
+    [[nodiscard]] constexpr float contrast(const ImVec4 &fg, const ImVec4 &bg,
+                                           const contrast_metric metric = contrast_metric::wcag) noexcept {
+        if (metric == contrast_metric::apca) {
+            const float lc = apca_contrast(fg, bg);
+            return lc < 0.0f ? -lc : lc;
+        }
+        return wcag_contrast(fg, bg);
+    }
+
+    /**
+     * @brief Smallest OKLCH lightness change to @p fg that reaches @p target contrast on @p bg.
+     *
+     * Hue, chroma and alpha of @p fg are kept. The side of @p bg that @p fg already sits on is
+     * tried first (light text stays light); if the target is unreachable there, the other side is
+     * tried, and if neither reaches it the higher-contrast extreme is returned. Bisection on L,
+     * so it is cheap enough for constant evaluation.
+     * @param fg     Foreground (text) color, sRGB.
+     * @param bg     Background color, sRGB.
+     * @param target Minimum contrast in @p metric units.
+     * @param metric Contrast model.
+     */
+    [[nodiscard]] constexpr ImVec4 solve_contrast(const ImVec4 &fg, const ImVec4 &bg, const float target,
+                                                  const contrast_metric metric = contrast_metric::wcag) noexcept {
+        if (contrast(fg, bg, metric) >= target) return fg;
+
+        const ImVec4               lch  = srgb_to_oklch(fg);
+        auto                       at   = [&](const float l) { return oklch_to_srgb(ImVec4{l, lch.y, lch.z, fg.w}); };
+        const bool                 up   = lch.x >= srgb_to_oklch(bg).x;
+        const std::array<float, 2> ends = {up ? 1.0f : 0.0f, up ? 0.0f : 1.0f};
+
+        for (const float end: ends) {
+            if (contrast(at(end), bg, metric) < target) continue;
+            float fail = lch.x; // invariant: at(fail) misses the target, at(pass) reaches it
+            float pass = end;
+            for (int i = 0; i < 20; i++) {
+                const float mid = (fail + pass) * 0.5f;
+                (contrast(at(mid), bg, metric) >= target ? pass : fail) = mid;
+            }
+            return at(pass);
+        }
+        const ImVec4 hi = at(1.0f);
+        const ImVec4 lo = at(0.0f);
+        return contrast(hi, bg, metric) >= contrast(lo, bg, metric) ? hi : lo;
+    }
+
+} // namespace imgui_util::color
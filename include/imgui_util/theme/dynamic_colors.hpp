@@ -13,6 +13,7 @@
 #include <imgui.h>
 
 #include "imgui_util/theme/color_math.hpp"
+#include "imgui_util/theme/contrast.hpp"
 
 namespace imgui_util::theme {
 
@@ -95,8 +96,19 @@ namespace imgui_util::theme {
 
     /// @}
 
-    [[nodiscard]] constexpr ImVec4 contrast_text(const ImVec4 &bg, const float alpha = 1.0f) noexcept {
-        return color::luminance(bg) > 0.5f ? ImVec4{0.0f, 0.0f, 0.0f, alpha} : ImVec4{1.0f, 1.0f, 1.0f, alpha};
+    /**
+     * @brief Black or white text for @p bg, whichever has the higher contrast under @p metric.
+     * @param bg     Background color (sRGB).
+     * @param alpha  Alpha of the returned text color.
+     * @param metric Contrast model (WCAG ratio or APCA Lc).
+     */
+    [[nodiscard]] constexpr ImVec4
+    contrast_text(const ImVec4 &bg, const float alpha = 1.0f,
+                  const color::contrast_metric metric = color::contrast_metric::wcag) noexcept {
+        constexpr ImVec4 black{0.0f, 0.0f, 0.0f, 1.0f};
+        constexpr ImVec4 white{1.0f, 1.0f, 1.0f, 1.0f};
+        const bool       dark_text = color::contrast(black, bg, metric) >= color::contrast(white, bg, metric);
+        return dark_text ? ImVec4{0.0f, 0.0f, 0.0f, alpha} : ImVec4{1.0f, 1.0f, 1.0f, alpha};
     }
 
 } // namespace imgui_util::theme
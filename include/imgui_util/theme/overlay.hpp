@@ -0,0 +1,121 @@
+/// @file overlay.hpp
+/// @brief Precompiled per-window theme overrides applied with one batched push/pop.
+///
+/// A theme_overlay is the diff of a theme_config against a base theme, stored as compact
+/// (index, value) arrays. Build it once -- at compile time when both sides come from
+/// presets -- and push it around any window or panel with scoped_overlay.
+///
+/// Usage:
+/// @code
+///   // compile time, from two presets
+///   static constexpr auto warm = theme_overlay::from_presets(base_preset, warm_preset);
+///   // runtime, from a user-edited theme
+///   const auto custom = theme_overlay::diff(mgr.get_current_theme(), edited);
+///
+///   { imgui_util::theme::scoped_overlay ov{warm}; ImGui::Begin("Panel"); ... ImGui::End(); }
+/// @endcode
+///
+/// Only ImGui colors and the style floats in style_float_map are overlaid; ImNodes has no
+/// per-scope style stack, so node colors are ignored.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <imgui.h>
+#include <span>
+
+#include "imgui_util/theme/theme.hpp"
+
+namespace imgui_util::theme {
+
+    /// @brief Compact diff of a theme_config against a base: only differing colors and style floats.
+    struct theme_overlay {
+        struct color_entry {
+            ImGuiCol idx;
+            ImVec4   val;
+        };
+
+        struct var_entry {
+            ImGuiStyleVar idx;
+            float         val;
+        };
+
+        std::array<color_entry, ImGuiCol_COUNT>       color_entries{};
+        std::array<var_entry, style_float_map.size()> var_entries{};
+        std::uint8_t                                  color_count = 0;
+        std::uint8_t                                  var_count   = 0;
+
+        [[nodiscard]] constexpr std::span<const color_entry> colors() const noexcept {
+            return {color_entries.data(), color_count};
+        }
+        [[nodiscard]] constexpr std::span<const var_entry> vars() const noexcept {
+            return {var_entries.data(), var_count};
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept { return color_count == 0 && var_count == 0; }
+
+        /**
+         * @brief Record every color and style float of @p target that differs from @p base.
+         * @param base   Theme the overlay will be pushed on top of.
+         * @param target Theme whose look the overlaid scope should have.
+         */
+        [[nodiscard]] static constexpr theme_overlay diff(const theme_config &base,
+                                                          const theme_config &target) noexcept {
+            theme_overlay out{};
+            for (int i = 0; i < ImGuiCol_COUNT; i++) {
+                const ImVec4 &a = base.colors[i];
+                const ImVec4 &b = target.colors[i];
+                if (a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w) continue;
+                out.color_entries[out.color_count++] = {.idx = i, .val = b};
+            }
+            for (const auto &[name, tptr, sptr, svar]: style_float_map) {
+                if (base.*tptr == target.*tptr) continue;
+                out.var_entries[out.var_count++] = {.idx = svar, .val = target.*tptr};
+            }
+            return out;
+        }
+
+        /**
+         * @brief Derive an overlay from two presets via from_preset_core (usable in constant expressions).
+         * @param base   Preset of the globally applied theme.
+         * @param target Preset the overlaid scope should look like.
+         * @param mode   Dark or light mode, applied to both presets.
+         */
+        [[nodiscard]] static constexpr theme_overlay from_presets(const theme_preset &base, const theme_preset &target,
+                                                                  const theme_mode mode = theme_mode::dark) noexcept {
+            return diff(theme_config::from_preset_core(base, mode), theme_config::from_preset_core(target, mode));
+        }
+    };
+
+    static_assert(ImGuiCol_COUNT <= 255, "theme_overlay stores its color count in a uint8_t");
+
+    /**
+     * @brief RAII scope that pushes a theme_overlay's colors and style vars, popping them all at once.
+     *
+     * One PopStyleColor(n) / PopStyleVar(n) on destruction instead of one guard object per entry.
+     */
+    class [[nodiscard]] scoped_overlay {
+        int colors_;
+        int vars_;
+
+    public:
+        explicit scoped_overlay(const theme_overlay &overlay) noexcept :
+            colors_{overlay.color_count}, vars_{overlay.var_count} {
+            for (const auto &[idx, val]: overlay.colors())
+                ImGui::PushStyleColor(idx, val);
+            for (const auto &[idx, val]: overlay.vars())
+                ImGui::PushStyleVar(idx, val);
+        }
+
+        ~scoped_overlay() {
+            if (vars_ > 0) ImGui::PopStyleVar(vars_);
+            if (colors_ > 0) ImGui::PopStyleColor(colors_);
+        }
+
+        scoped_overlay(const scoped_overlay &)            = delete;
+        scoped_overlay &operator=(const scoped_overlay &) = delete;
+        scoped_overlay(scoped_overlay &&)                 = delete;
+        scoped_overlay &operator=(scoped_overlay &&)      = delete;
+    };
+
+} // namespace imgui_util::theme
@@ -0,0 +1,193 @@
+/// @file palette.hpp
+/// @brief Perceptual (OKLCH) theme derivation with guaranteed text contrast.
+///
+/// from_preset_core() derives shades by RGB offset/scale, so a +0.1 step looks very different
+/// on a blue background than on a grey one and text contrast is whatever falls out. This
+/// derivation steps OKLCH lightness instead (equal steps look equal for every hue) and then
+/// solves text colors against every surface they are drawn on until the requested minimum
+/// contrast holds.
+///
+/// Usage:
+/// @code
+///   // compile time: the whole palette, contrast solving included, is a constant expression
+///   static constexpr auto my_theme = from_preset_perceptual(my_preset);
+///   static_assert(min_text_contrast(my_theme) >= 4.5f);
+///   auto theme = from_preset_perceptual(my_preset, theme_mode::dark, {.text_contrast = 7.0f});
+///
+///   // runtime: repair a user-edited theme in place
+///   enforce_contrast(edited_theme, {.metric = color::contrast_metric::apca, .text_contrast = 60.0f});
+/// @endcode
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <imgui.h>
+
+#include "imgui_util/theme/contrast.hpp"
+#include "imgui_util/theme/theme.hpp"
+
+namespace imgui_util::theme {
+
+    /// @brief Minimum contrast targets used by enforce_contrast() and from_preset_perceptual().
+    struct palette_options {
+        color::contrast_metric metric            = color::contrast_metric::wcag;
+        float                  text_contrast     = 4.5f; ///< Text on every text surface (WCAG AA; APCA ~60).
+        float                  disabled_contrast = 3.0f; ///< TextDisabled on window-level surfaces (APCA ~45).
+    };
+
+    /// @brief Surfaces ImGuiCol_Text is drawn on (accent-filled hover/active states are excluded).
+    inline constexpr std::array<ImGuiCol, 14> text_surfaces = {
+        ImGuiCol_WindowBg,      ImGuiCol_ChildBg,   ImGuiCol_PopupBg,        ImGuiCol_TitleBg,
+        ImGuiCol_TitleBgActive, ImGuiCol_MenuBarBg, ImGuiCol_FrameBg,        ImGuiCol_FrameBgHovered,
+        ImGuiCol_FrameBgActive, ImGuiCol_Button,    ImGuiCol_Header,         ImGuiCol_Tab,
+        ImGuiCol_TabDimmed,     ImGuiCol_TableHeaderBg,
+    };
+
+    /// @brief Surfaces ImGuiCol_TextDisabled must stay legible on.
+    inline constexpr std::array<ImGuiCol, 4> disabled_text_surfaces = {
+        ImGuiCol_WindowBg, ImGuiCol_ChildBg, ImGuiCol_PopupBg, ImGuiCol_FrameBg};
+
+    namespace detail {
+
+        // Repeatedly solve against the lowest-contrast surface until every surface passes.
+        // Fixing the worst one first keeps this stable when surfaces sit on both sides of the text.
+        template<std::size_t N>
+        constexpr void solve_against(const theme_config &cfg, ImVec4 &text, const std::array<ImGuiCol, N> &surfaces,
+                                     const float target, const color::contrast_metric metric) noexcept {
+            for (std::size_t pass = 0; pass < N; pass++) {
+                ImGuiCol worst = surfaces[0];
+                float    lo    = color::contrast(text, cfg.colors[worst], metric);
+                for (const ImGuiCol s: surfaces) {
+                    const float c = color::contrast(text, cfg.colors[s], metric);
+                    if (c < lo) {
+                        lo    = c;
+                        worst = s;
+                    }
+                }
+                if (lo >= target) return;
+                text = color::solve_contrast(text, cfg.colors[worst], target, metric);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Adjust Text and TextDisabled lightness so they meet @p opts on their surfaces.
+     *
+     * Surface colors are never changed; alpha is ignored (surfaces are treated as opaque).
+     * Usable at compile time and at runtime on user-edited themes.
+     */
+    constexpr void enforce_contrast(theme_config &cfg, const palette_options &opts = {}) noexcept {
+        detail::solve_against(cfg, cfg.colors[ImGuiCol_Text], text_surfaces, opts.text_contrast, opts.metric);
+        detail::solve_against(cfg, cfg.colors[ImGuiCol_TextDisabled], disabled_text_surfaces, opts.disabled_contrast,
+                              opts.metric);
+    }
+
+    /// @brief Lowest contrast of ImGuiCol_Text across text_surfaces.
+    [[nodiscard]] constexpr float min_text_contrast(const theme_config          &cfg,
+                                                    const color::contrast_metric metric = color::contrast_metric::wcag) noexcept {
+        float lo = color::contrast(cfg.colors[ImGuiCol_Text], cfg.colors[text_surfaces[0]], metric);
+        for (const ImGuiCol s: text_surfaces)
+            lo = std::min(lo, color::contrast(cfg.colors[ImGuiCol_Text], cfg.colors[s], metric));
+        return lo;
+    }
+
+    /// @brief Palette seed a derived color starts from.
+    enum class palette_seed : std::uint8_t { bg_dark, bg_mid, accent, secondary };
+
+    /// @brief One derived color: seed, OKLCH lightness step, alpha.
+    struct palette_step {
+        ImGuiCol     idx;
+        palette_seed seed;
+        float        dl;                  ///< Lightness step in OKLab L units.
+        float        alpha        = 1.0f;
+        bool         follows_mode = true; ///< Step is mirrored in light mode (background tones).
+    };
+
+    /// @brief Derivation table mirroring from_preset_core(), with RGB offsets replaced by lightness steps.
+    inline constexpr auto perceptual_steps = std::to_array<palette_step>({
+        {ImGuiCol_WindowBg, palette_seed::bg_mid, 0.0f},
+        {ImGuiCol_ChildBg, palette_seed::bg_dark, 0.02f},
+        {ImGuiCol_PopupBg, palette_seed::bg_mid, 0.02f, 0.98f},
+        {ImGuiCol_TitleBg, palette_seed::bg_dark, 0.0f},
+        {ImGuiCol_TitleBgActive, palette_seed::bg_mid, 0.02f},
+        {ImGuiCol_TitleBgCollapsed, palette_seed::bg_dark, -0.02f, 0.8f},
+        {ImGuiCol_MenuBarBg, palette_seed::bg_dark, 0.0f},
+        {ImGuiCol_Border, palette_seed::bg_mid, 0.11f, 0.6f},
+        {ImGuiCol_FrameBg, palette_seed::bg_mid, 0.06f},
+        {ImGuiCol_FrameBgHovered, palette_seed::bg_mid, 0.11f},
+        {ImGuiCol_FrameBgActive, palette_seed::bg_mid, 0.16f},
+        {ImGuiCol_Button, palette_seed::bg_mid, 0.10f},
+        {ImGuiCol_ButtonHovered, palette_seed::accent, -0.05f, 1.0f, false},
+        {ImGuiCol_ButtonActive, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_Header, palette_seed::bg_mid, 0.10f},
+        {ImGuiCol_HeaderHovered, palette_seed::accent, -0.07f, 1.0f, false},
+        {ImGuiCol_HeaderActive, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_Tab, palette_seed::bg_mid, 0.04f},
+        {ImGuiCol_TabHovered, palette_seed::accent, -0.05f, 1.0f, false},
+        {ImGuiCol_TabSelected, palette_seed::accent, -0.11f, 1.0f, false},
+        {ImGuiCol_TabSelectedOverline, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_TabDimmed, palette_seed::bg_mid, 0.0f},
+        {ImGuiCol_TabDimmedSelected, palette_seed::bg_mid, 0.08f},
+        {ImGuiCol_TabDimmedSelectedOverline, palette_seed::accent, -0.07f, 0.5f, false},
+        {ImGuiCol_DockingPreview, palette_seed::accent, 0.0f, 0.7f, false},
+        {ImGuiCol_DockingEmptyBg, palette_seed::bg_dark, 0.0f},
+        {ImGuiCol_ScrollbarBg, palette_seed::bg_dark, 0.0f, 0.6f},
+        {ImGuiCol_ScrollbarGrab, palette_seed::bg_mid, 0.16f},
+        {ImGuiCol_ScrollbarGrabHovered, palette_seed::bg_mid, 0.26f},
+        {ImGuiCol_ScrollbarGrabActive, palette_seed::bg_mid, 0.36f},
+        {ImGuiCol_SliderGrab, palette_seed::secondary, -0.07f, 1.0f, false},
+        {ImGuiCol_SliderGrabActive, palette_seed::secondary, 0.0f, 1.0f, false},
+        {ImGuiCol_CheckMark, palette_seed::secondary, 0.0f, 1.0f, false},
+        {ImGuiCol_ResizeGrip, palette_seed::bg_mid, 0.16f, 0.4f},
+        {ImGuiCol_ResizeGripHovered, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_ResizeGripActive, palette_seed::accent, 0.08f, 1.0f, false},
+        {ImGuiCol_Separator, palette_seed::bg_mid, 0.14f},
+        {ImGuiCol_SeparatorHovered, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_SeparatorActive, palette_seed::accent, 0.08f, 1.0f, false},
+        {ImGuiCol_TextSelectedBg, palette_seed::accent, -0.07f, 0.4f, false},
+        {ImGuiCol_PlotLines, palette_seed::secondary, 0.0f, 1.0f, false},
+        {ImGuiCol_PlotLinesHovered, palette_seed::accent, 0.06f, 1.0f, false},
+        {ImGuiCol_PlotHistogramHovered, palette_seed::accent, 0.06f, 1.0f, false},
+        {ImGuiCol_NavHighlight, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_TableHeaderBg, palette_seed::bg_mid, 0.04f},
+        {ImGuiCol_TableBorderStrong, palette_seed::bg_mid, 0.14f},
+        {ImGuiCol_TableBorderLight, palette_seed::bg_mid, 0.08f, 0.8f},
+        {ImGuiCol_TableRowBgAlt, palette_seed::bg_mid, 0.0f, 0.4f},
+        {ImGuiCol_DragDropTarget, palette_seed::accent, 0.0f, 1.0f, false},
+        {ImGuiCol_TextLink, palette_seed::accent, 0.0f, 1.0f, false},
+    });
+
+    /**
+     * @brief Derive a theme from a preset in OKLCH, then enforce text contrast.
+     *
+     * Starts from from_preset_core() (node colors, style floats, preset seeds, text defaults,
+     * and the colors not listed in perceptual_steps) and re-derives every listed color by
+     * stepping the seed's OKLCH lightness. Text and TextDisabled are then solved with
+     * enforce_contrast(). Usable in constant expressions.
+     * @param preset Source preset descriptor.
+     * @param mode   Dark (steps go lighter) or light (background steps go darker).
+     * @param opts   Contrast targets.
+     */
+    [[nodiscard]] constexpr theme_config from_preset_perceptual(const theme_preset &preset,
+                                                                const theme_mode mode = theme_mode::dark,
+                                                                const palette_options &opts = {}) {
+        theme_config theme = theme_config::from_preset_core(preset, mode);
+        const float  d     = mode == theme_mode::light ? -1.0f : 1.0f;
+
+        const std::array<ImVec4, 4> seeds = {color::rgb(theme.preset_bg_dark), color::rgb(theme.preset_bg_mid),
+                                             color::rgb(theme.preset_accent), color::rgb(theme.preset_secondary)};
+        for (const auto &[idx, seed, dl, alpha, follows_mode]: perceptual_steps) {
+            const ImVec4 &base = seeds[static_cast<std::size_t>(seed)];
+            theme.colors[idx]  = dl == 0.0f ? ImVec4{base.x, base.y, base.z, alpha}
+                                            : color::shift_lightness(base, follows_mode ? d * dl : dl, alpha);
+        }
+
+        enforce_contrast(theme, opts);
+        return theme;
+    }
+
+} // namespace imgui_util::theme
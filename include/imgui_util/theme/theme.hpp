@@ -169,30 +169,44 @@ namespace imgui_util::theme {
 
     /// @brief Compile-time descriptor mapping a theme_config float field to its ImGuiStyle counterpart.
     ///
-    /// Adding a new style float requires changing only this table -- apply() and
-    /// capture_from_current() both iterate it, eliminating duplication.
+    /// Adding a new style float requires changing only this table -- apply(), capture_from_current()
+    /// and theme_overlay (via style_var) all iterate it, eliminating duplication.
     struct style_field_pair {
         std::string_view name;
         float theme_config::*theme_ptr;
         float ImGuiStyle::*imgui_ptr;
+        ImGuiStyleVar        style_var; ///< Matching ImGuiStyleVar_ for scoped PushStyleVar overrides.
     };
 
     inline constexpr std::array style_float_map = std::to_array<style_field_pair>({
         {.name      = "window_rounding",
          .theme_ptr = &theme_config::window_rounding,
-         .imgui_ptr = &ImGuiStyle::WindowRounding},
-        {.name = "frame_rounding", .theme_ptr = &theme_config::frame_rounding, .imgui_ptr = &ImGuiStyle::FrameRounding},
+         .imgui_ptr = &ImGuiStyle::WindowRounding,
+         .style_var = ImGuiStyleVar_WindowRounding},
+        {.name      = "frame_rounding",
+         .theme_ptr = &theme_config::frame_rounding,
+         .imgui_ptr = &ImGuiStyle::FrameRounding,
+         .style_var = ImGuiStyleVar_FrameRounding},
         {.name      = "window_border_size",
          .theme_ptr = &theme_config::window_border_size,
-         .imgui_ptr = &ImGuiStyle::WindowBorderSize},
+         .imgui_ptr = &ImGuiStyle::WindowBorderSize,
+         .style_var = ImGuiStyleVar_WindowBorderSize},
         {.name      = "frame_border_size",
          .theme_ptr = &theme_config::frame_border_size,
-         .imgui_ptr = &ImGuiStyle::FrameBorderSize},
-        {.name = "tab_rounding", .theme_ptr = &theme_config::tab_rounding, .imgui_ptr = &ImGuiStyle::TabRounding},
+         .imgui_ptr = &ImGuiStyle::FrameBorderSize,
+         .style_var = ImGuiStyleVar_FrameBorderSize},
+        {.name      = "tab_rounding",
+         .theme_ptr = &theme_config::tab_rounding,
+         .imgui_ptr = &ImGuiStyle::TabRounding,
+         .style_var = ImGuiStyleVar_TabRounding},
         {.name      = "scrollbar_rounding",
          .theme_ptr = &theme_config::scrollbar_rounding,
-         .imgui_ptr = &ImGuiStyle::ScrollbarRounding},
-        {.name = "grab_rounding", .theme_ptr = &theme_config::grab_rounding, .imgui_ptr = &ImGuiStyle::GrabRounding},
+         .imgui_ptr = &ImGuiStyle::ScrollbarRounding,
+         .style_var = ImGuiStyleVar_ScrollbarRounding},
+        {.name      = "grab_rounding",
+         .theme_ptr = &theme_config::grab_rounding,
+         .imgui_ptr = &ImGuiStyle::GrabRounding,
+         .style_var = ImGuiStyleVar_GrabRounding},
     });
     static_assert(style_float_map.size() == 7,
                   "style_float_map entry count mismatch -- did you add a new style float?");
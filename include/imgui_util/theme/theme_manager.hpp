@@ -5,20 +5,28 @@
 /// @code
 ///   theme_manager mgr;
 ///   mgr.set_theme(theme_config::from_preset(my_preset));
+///   mgr.transition_to(theme_config::from_preset(my_preset, theme_mode::light)); // animated
+///   mgr.update(ImGui::GetIO().DeltaTime);       // call each frame to drive transitions
 ///   mgr.save_to_file("theme.json");
 ///   mgr.load_from_file("theme.json");
+///   mgr.watch_file("theme.json");               // hot reload: re-parsed off-thread, applied in update()
 ///   mgr.render_theme_editor(&show_editor);      // call each frame to show the editor
 /// @endcode
 
 #pragma once
 
+#include <chrono>
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
 
 #include "imgui_util/theme/theme.hpp"
+#include "imgui_util/theme/theme_watcher.hpp"
+#include "imgui_util/theme/transition.hpp"
 
 namespace imgui_util::theme {
 
@@ -34,6 +42,24 @@ namespace imgui_util::theme {
         [[nodiscard]] theme_config       &get_current_theme() { return current_theme_; }
         [[nodiscard]] const theme_config &get_current_theme() const { return current_theme_; }
 
+        /**
+         * @brief Crossfade from the current theme to @p theme over @p duration seconds.
+         *
+         * Only fields that differ between the two themes are written each frame (see
+         * theme_transition). The theme becomes current, and the change callback fires, once
+         * the transition finishes. Retargeting mid-transition starts from the on-screen blend.
+         * @param theme    Target theme.
+         * @param duration Duration in seconds (<= 0 behaves like set_theme()).
+         * @param curve    Easing curve.
+         */
+        void transition_to(theme_config theme, float duration = 0.3f, easing curve = easing::smoothstep);
+
+        /// @brief Apply a pending hot-reloaded theme, then advance a running transition by @p dt seconds.
+        /// Call once per frame on the UI thread.
+        void update(float dt);
+
+        [[nodiscard]] bool is_transitioning() const noexcept { return transition_.active(); }
+
         /// @brief Return all built-in presets.
         [[nodiscard]] static std::span<const theme_preset> get_presets();
         /**
@@ -90,6 +116,40 @@ namespace imgui_util::theme {
          */
         [[nodiscard]] bool load_from_file(const std::filesystem::path &path);
 
+        /**
+         * @brief Parse a theme file without applying it. Thread-safe; does not touch ImGui state.
+         * @param path Source file path.
+         * @param base Values for any fields the file does not mention.
+         * @return The parsed theme, or std::nullopt if the file could not be opened or parsed.
+         */
+        [[nodiscard]] static std::optional<theme_config> read_file(const std::filesystem::path &path,
+                                                                   theme_config                 base);
+
+        /// @brief read_file() that adds its warnings and errors to @p notices instead of logging them
+        ///        (for the hot-reload watcher thread).
+        [[nodiscard]] static std::optional<theme_config> read_file(const std::filesystem::path &path, theme_config base,
+                                                                   watch_notices &notices);
+
+        /**
+         * @brief Hot-reload @p path: watch it on a background thread and apply each saved change.
+         *
+         * Change detection, file I/O and parsing all happen on the watcher thread; update()
+         * only swaps in the finished theme_config. Saves are debounced so a burst of writes
+         * reloads once. Replaces any previous watch. Does not load the file now -- call
+         * load_from_file() first if the current contents should be applied immediately.
+         * @param path     Theme file to watch.
+         * @param debounce Quiet period after the last write before the file is re-parsed.
+         * @param backend  inotify (with polling fallback) or forced mtime polling.
+         */
+        void watch_file(const std::filesystem::path &path,
+                        std::chrono::milliseconds    debounce = theme_file_watcher::default_debounce,
+                        watch_backend                backend  = watch_backend::automatic);
+
+        /// @brief Stop hot-reloading (joins the watcher thread).
+        void stop_watching();
+
+        [[nodiscard]] bool is_watching() const noexcept { return watcher_ != nullptr; }
+
         /// @brief Render the built-in theme editor window. Call each frame when open.
         void render_theme_editor(bool *open);
 
@@ -104,6 +164,14 @@ namespace imgui_util::theme {
 
         std::function<void(const theme_config &)> on_theme_changed_;
 
+        theme_transition transition_;
+        theme_config     transition_target_;
+
+        std::unique_ptr<theme_file_watcher> watcher_;
+
+        void commit_theme(theme_config theme);
+        void adopt_loaded(theme_config theme);
+
         void        render_color_category(const char *name, std::span<const int> indices);
         void        render_node_colors();
         void        render_sizes_tab();
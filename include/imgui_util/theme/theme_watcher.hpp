@@ -0,0 +1,135 @@
+/// @file theme_watcher.hpp
+/// @brief Background file watcher that re-parses a theme file on change (inotify or mtime polling).
+///
+/// The watcher thread owns all file I/O and parsing. Each successfully parsed theme is
+/// published through an atomic shared_ptr swap; the UI thread picks it up with take(),
+/// which never blocks. Bursts of writes (editors that save in several steps, rapid
+/// successive saves) are coalesced: the file is only parsed once it has been quiet for
+/// the debounce interval. The thread never logs: its warnings and errors queue up as
+/// watch_notices for the UI thread to drain with take_notices() and log.
+///
+/// Usage (theme_manager::watch_file() wraps this):
+/// @code
+///   theme_file_watcher w{"theme.txt",
+///                        [](const auto &p, auto &notes) { return theme_manager::read_file(p, base, notes); }};
+///   // each frame, on the UI thread:
+///   for (const auto &n: w.take_notices()) report(n);
+///   if (auto t = w.take()) t->apply();
+/// @endcode
+///
+/// On Linux the parent directory is watched with inotify (so atomic rename-over saves are
+/// seen); elsewhere, or when inotify is unavailable or polling is requested, the file's
+/// mtime and size are polled.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/theme/theme.hpp"
+
+namespace imgui_util::theme {
+
+    /// @brief Change-detection strategy for theme_file_watcher.
+    enum class watch_backend : std::uint8_t {
+        automatic, ///< inotify where available, mtime polling otherwise.
+        polling,   ///< Always poll mtime/size (e.g. network filesystems where inotify is silent).
+    };
+
+    /// @brief A message from the watcher thread, to be logged on the thread that drains it.
+    struct watch_notice {
+        enum class level : std::uint8_t { warning, error };
+
+        level       severity = level::warning;
+        std::string text;
+    };
+
+    using watch_notices = std::vector<watch_notice>;
+
+    /// @brief Watches one theme file on a background thread and publishes re-parsed themes.
+    class theme_file_watcher {
+    public:
+        /// @brief Parser run on the watcher thread; returns std::nullopt on failure and adds any
+        ///        messages to the notices argument instead of logging them.
+        using parse_fn = std::function<std::optional<theme_config>(const std::filesystem::path &, watch_notices &)>;
+
+        static constexpr std::chrono::milliseconds default_debounce{150};
+        static constexpr std::chrono::milliseconds poll_interval{100};
+
+        /**
+         * @brief Start watching @p path. Does not parse the current contents; only changes are reported.
+         * @param path     Theme file to watch.
+         * @param parse    Parser invoked off-thread after each debounced change.
+         * @param debounce Quiet period required after the last change before parsing.
+         * @param backend  Change-detection strategy.
+         */
+        theme_file_watcher(std::filesystem::path path, parse_fn parse,
+                           std::chrono::milliseconds debounce = default_debounce,
+                           watch_backend             backend  = watch_backend::automatic);
+
+        /// @brief Stops and joins the watcher thread (bounded by poll_interval).
+        ~theme_file_watcher() = default;
+
+        theme_file_watcher(const theme_file_watcher &)            = delete;
+        theme_file_watcher &operator=(const theme_file_watcher &) = delete;
+        theme_file_watcher(theme_file_watcher &&)                 = delete;
+        theme_file_watcher &operator=(theme_file_watcher &&)      = delete;
+
+        /// @brief Take the most recently parsed theme, if any (UI thread; lock-free, never blocks).
+        [[nodiscard]] std::shared_ptr<theme_config> take() noexcept { return pending_.exchange(nullptr); }
+
+        /// @brief Take the messages queued by the watcher thread since the last call, oldest first.
+        [[nodiscard]] watch_notices take_notices() {
+            const std::scoped_lock lock{notices_mutex_};
+            return std::exchange(notices_, {});
+        }
+
+        [[nodiscard]] const std::filesystem::path &path() const noexcept { return path_; }
+
+        /// @brief True once the watch is armed; writes made before that may go unnoticed.
+        [[nodiscard]] bool ready() const noexcept { return ready_.load(std::memory_order_acquire); }
+
+        /// @brief Block until ready() (the thread arms the watch right after it starts).
+        void wait_ready() const noexcept { ready_.wait(false, std::memory_order_acquire); }
+
+        /// @brief True once the thread has successfully set up inotify (false while polling).
+        [[nodiscard]] bool using_inotify() const noexcept { return inotify_.load(std::memory_order_relaxed); }
+
+        /// @brief Number of successful re-parses published so far.
+        [[nodiscard]] int reload_count() const noexcept { return reloads_.load(std::memory_order_relaxed); }
+
+    private:
+        std::filesystem::path     path_;
+        parse_fn                  parse_;
+        std::chrono::milliseconds debounce_;
+        watch_backend             backend_;
+
+        std::atomic<std::shared_ptr<theme_config>> pending_;
+        std::atomic<bool>                          inotify_{false};
+        std::atomic<bool>                          ready_{false};
+        std::atomic<int>                           reloads_{0};
+        std::mutex                                 notices_mutex_;
+        watch_notices                              notices_;
+
+        std::jthread thread_; // declared last: starts after, and joins before, the state above
+
+        void run(const std::stop_token &stop);
+        bool run_inotify(const std::stop_token &stop);
+        void run_polling(const std::stop_token &stop);
+        void reload();
+        void post(watch_notices notes);
+        void mark_ready() noexcept;
+    };
+
+} // namespace imgui_util::theme
@@ -0,0 +1,142 @@
+/// @file transition.hpp
+/// @brief Animated theme crossfades that only touch fields which actually change.
+///
+/// lerp() builds a whole theme_config and apply() rewrites every style field, which is
+/// wasteful when run every frame of a crossfade. theme_transition diffs the two themes
+/// once, keeps start/delta pairs for the differing fields in contiguous arrays, and each
+/// update() writes only those fields into ImGuiStyle / ImNodesStyle.
+///
+/// Usage:
+/// @code
+///   theme_transition fade{current, target, 0.3f, easing::smoothstep};
+///   // each frame:
+///   if (!fade.update(ImGui::GetIO().DeltaTime)) { /* finished; target values written exactly */ }
+/// @endcode
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <imgui.h>
+#include <imnodes.h>
+
+#include "imgui_util/theme/theme.hpp"
+
+namespace imgui_util::theme {
+
+    /// @brief Easing curve applied to normalized transition time.
+    enum class easing : std::uint8_t { linear, smoothstep, ease_in_out_cubic, ease_out_quad };
+
+    /**
+     * @brief Map normalized time through an easing curve.
+     * @param e Easing curve.
+     * @param t Normalized time, clamped to [0, 1].
+     * @return Eased factor in [0, 1] (0 at t == 0, 1 at t == 1).
+     */
+    [[nodiscard]] constexpr float ease(const easing e, float t) noexcept {
+        t = std::clamp(t, 0.0f, 1.0f);
+        switch (e) {
+            case easing::linear:
+                return t;
+            case easing::smoothstep:
+                return t * t * (3.0f - 2.0f * t);
+            case easing::ease_in_out_cubic: {
+                if (t < 0.5f) return 4.0f * t * t * t;
+                const float u = -2.0f * t + 2.0f;
+                return 1.0f - u * u * u * 0.5f;
+            }
+            case easing::ease_out_quad:
+                return 1.0f - (1.0f - t) * (1.0f - t);
+        }
+        return t;
+    }
+
+    /**
+     * @brief Incremental crossfade between two theme_configs.
+     *
+     * The constructor (or start()) diffs @c from against @c to and records only the
+     * ImGui colors, ImNodes colors, and style floats that differ. update() advances time,
+     * evaluates the easing curve, and writes start + delta * t for those fields only. On
+     * completion the exact target values are written (no accumulated float error).
+     *
+     * Assumes @c from is what is currently applied; fields equal in both themes are never written.
+     */
+    class theme_transition {
+    public:
+        theme_transition() = default;
+
+        /**
+         * @brief Prepare a transition from @p from to @p to.
+         * @param from     Theme currently applied.
+         * @param to       Target theme.
+         * @param duration Duration in seconds (<= 0 snaps on the first update()).
+         * @param curve    Easing curve.
+         */
+        theme_transition(const theme_config &from, const theme_config &to, float duration = 0.3f,
+                         easing curve = easing::smoothstep) noexcept {
+            start(from, to, duration, curve);
+        }
+
+        /// @brief (Re)initialize the transition; see the constructor. Does not write anything yet.
+        void start(const theme_config &from, const theme_config &to, float duration = 0.3f,
+                   easing curve = easing::smoothstep) noexcept;
+
+        /**
+         * @brief Advance by @p dt seconds and write the interpolated dirty fields.
+         * @return True while the transition is still running; false once the target has been written.
+         */
+        bool update(float dt) noexcept;
+
+        /// @brief Jump to the end: write exact target values for every dirty field and stop.
+        void finish() noexcept;
+
+        /// @brief Stop without writing anything further.
+        void cancel() noexcept { active_ = false; }
+
+        [[nodiscard]] bool  active() const noexcept { return active_; }
+        [[nodiscard]] float progress() const noexcept { return duration_ > 0.0f ? elapsed_ / duration_ : 1.0f; }
+        [[nodiscard]] float eased_progress() const noexcept { return ease(curve_, progress()); }
+
+        /// @brief Number of fields that differ between the two themes (and are written per update).
+        /// @{
+        [[nodiscard]] int dirty_color_count() const noexcept { return color_count_; }
+        [[nodiscard]] int dirty_node_color_count() const noexcept { return node_count_; }
+        [[nodiscard]] int dirty_float_count() const noexcept { return float_count_; }
+        /// @}
+
+    private:
+        // Dirty ImGui colors, packed contiguously so each entry is one 16-byte lane.
+        alignas(16) std::array<ImVec4, ImGuiCol_COUNT> color_start_{};
+        alignas(16) std::array<ImVec4, ImGuiCol_COUNT> color_delta_{};
+        std::array<ImVec4, ImGuiCol_COUNT>             color_end_{};
+        std::array<std::uint8_t, ImGuiCol_COUNT>       color_idx_{};
+        int                                            color_count_ = 0;
+
+        // Dirty ImNodes colors, unpacked to float4 for interpolation.
+        alignas(16) std::array<ImVec4, ImNodesCol_COUNT> node_start_{};
+        alignas(16) std::array<ImVec4, ImNodesCol_COUNT> node_delta_{};
+        std::array<ImU32, ImNodesCol_COUNT>              node_end_{};
+        std::array<std::uint8_t, ImNodesCol_COUNT>       node_idx_{};
+        int                                              node_count_ = 0;
+
+        // Dirty style floats, indexed into theme_float_fields (ImGui entries first, then ImNodes).
+        static constexpr std::size_t float_field_count = theme_float_fields.size();
+        std::array<float, float_field_count>        float_start_{};
+        std::array<float, float_field_count>        float_delta_{};
+        std::array<float, float_field_count>        float_end_{};
+        std::array<std::uint8_t, float_field_count> float_idx_{};
+        int                                         float_count_ = 0;
+
+        float  duration_ = 0.0f;
+        float  elapsed_  = 0.0f;
+        easing curve_    = easing::smoothstep;
+        bool   active_   = false;
+
+        void write(float t) const noexcept;
+        void write_end() const noexcept;
+
+        static_assert(ImGuiCol_COUNT <= 256 && ImNodesCol_COUNT <= 256, "dirty index tables store uint8_t indices");
+    };
+
+} // namespace imgui_util::theme
@@ -5,6 +5,7 @@
 // NOLINTBEGIN(misc-include-cleaner)
 #pragma once
 #include "imgui_util/widgets/command_palette.hpp"
+#include "imgui_util/widgets/command_registry.hpp"
 #include "imgui_util/widgets/confirm_button.hpp"
 #include "imgui_util/widgets/controls.hpp"
 #include "imgui_util/widgets/curve_editor.hpp"
@@ -12,6 +13,7 @@
 #include "imgui_util/widgets/drag_drop.hpp"
 #include "imgui_util/widgets/helpers.hpp"
 #include "imgui_util/widgets/hex_viewer.hpp"
+#include "imgui_util/widgets/hotkey_registry.hpp"
 #include "imgui_util/widgets/inline_edit.hpp"
 #include "imgui_util/widgets/key_binding.hpp"
 #include "imgui_util/widgets/log_viewer.hpp"
@@ -27,6 +29,7 @@
 #include "imgui_util/widgets/splitter.hpp"
 #include "imgui_util/widgets/status_bar.hpp"
 #include "imgui_util/widgets/tag_input.hpp"
+#include "imgui_util/widgets/tag_vocabulary.hpp"
 #include "imgui_util/widgets/text.hpp"
 #include "imgui_util/widgets/timeline.hpp"
 #include "imgui_util/widgets/toast.hpp"
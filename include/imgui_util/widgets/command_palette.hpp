@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <imgui.h>
 #include <string>
@@ -25,6 +26,8 @@
 #include <vector>
 
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/core/text_metrics.hpp"
+#include "imgui_util/widgets/search_bar.hpp"
 
 namespace imgui_util {
 
@@ -37,21 +40,55 @@ namespace imgui_util {
          * @param callback  Action invoked when the command is selected.
          */
         void add(std::string name, std::move_only_function<void()> callback) {
-            commands_.push_back({.name = std::move(name), .description = {}, .callback = std::move(callback)});
+            add(std::move(name), {}, {}, std::move(callback));
         }
 
         /// @brief Register a command with a description shown in the results list.
         void add(std::string name, const std::string_view description, std::move_only_function<void()> callback) {
-            commands_.push_back(
-                {.name = std::move(name), .description = std::string(description), .callback = std::move(callback)});
+            add(std::move(name), description, {}, std::move(callback));
+        }
+
+        /**
+         * @brief Register a command with a description, shortcut label and enable predicate.
+         * @param shortcut  Shortcut text (e.g. "Ctrl+S") drawn right-aligned; empty for none.
+         * @param enabled   Queried for each visible row every frame; disabled commands are greyed
+         *                  out and cannot be invoked. Empty = always enabled.
+         */
+        void add(std::string name, const std::string_view description, const std::string_view shortcut,
+                 std::move_only_function<void()> callback, std::move_only_function<bool()> enabled = {}) {
+            push({.name        = std::move(name),
+                  .description = std::string(description),
+                  .shortcut    = std::string(shortcut),
+                  .callback    = std::move(callback),
+                  .enabled     = std::move(enabled)});
+        }
+
+        /**
+         * @brief add() with the shortcut text looked up every frame, so rebinds show up at once.
+         * @param shortcut  Returns the current shortcut text (empty for none); queried for each
+         *                  visible row, the view must stay valid until the row is drawn.
+         */
+        void add_live_shortcut(std::string name, const std::string_view description,
+                               std::move_only_function<std::string_view()> shortcut,
+                               std::move_only_function<void()>             callback,
+                               std::move_only_function<bool()>             enabled = {}) {
+            push({.name        = std::move(name),
+                  .description = std::string(description),
+                  .shortcut_of = std::move(shortcut),
+                  .callback    = std::move(callback),
+                  .enabled     = std::move(enabled)});
         }
 
         /// @brief Remove all registered commands.
-        void clear() noexcept { commands_.clear(); }
+        void clear() noexcept {
+            commands_.clear();
+            scored_stale_ = true;
+        }
 
         /// @brief Remove the command with the given name, if it exists.
         void remove(const std::string_view name) {
             std::erase_if(commands_, [name](const command_entry &e) { return e.name == name; });
+            scored_stale_ = true;
         }
 
         /// @brief Set the maximum number of results shown in the list.
@@ -61,8 +98,7 @@ namespace imgui_util {
         void open() noexcept {
             should_open_ = true;
             filter_.fill('\0');
-            filter_dirty_ = true;
-            selected_     = 0;
+            selected_ = 0;
         }
 
         /// @brief Render the command palette. Call once per frame.
@@ -88,8 +124,7 @@ namespace imgui_util {
                 // Filter input
                 if (ImGui::IsWindowAppearing()) ImGui::SetKeyboardFocusHere();
                 ImGui::SetNextItemWidth(-1.0f);
-                if (ImGui::InputTextWithHint("##input", "Type a command...", filter_.data(), filter_.size()))
-                    filter_dirty_ = true;
+                (void)ImGui::InputTextWithHint("##input", "Type a command...", filter_.data(), filter_.size());
 
                 update_scored_results();
                 handle_keyboard();
@@ -99,29 +134,46 @@ namespace imgui_util {
 
     private:
         struct command_entry {
-            std::string                     name;
-            std::string                     description;
-            std::move_only_function<void()> callback;
+            std::string                                 name;
+            std::string                                 description = {};
+            std::string                                 shortcut    = {};
+            std::move_only_function<std::string_view()> shortcut_of = {}; // replaces shortcut when set
+            std::move_only_function<void()>             callback    = {};
+            std::move_only_function<bool()>             enabled     = {};
+            std::uint64_t                               mask        = 0; // search::char_mask(name)
         };
 
+        void push(command_entry e) {
+            e.mask = search::char_mask(e.name);
+            commands_.push_back(std::move(e));
+            scored_stale_ = true;
+        }
+
         struct scored_entry {
             int idx{};
             int score{};
         };
 
+        // Rescored only when the query or the command list changed, so reopening stays warm.
         void update_scored_results() {
-            if (!filter_dirty_) return;
-            filter_dirty_ = false;
             const std::string_view query{filter_.data()};
+            if (!scored_stale_ && query == scored_query_) return;
+            scored_stale_ = false;
+            scored_query_.assign(query);
             scored_.clear();
+            const std::uint64_t qmask = search::char_mask(query);
             for (int i = 0; std::cmp_less(i, commands_.size()); ++i) {
-                if (int score = 0; query.empty() || fuzzy_match(query, commands_[i].name, score)) {
+                const command_entry &c = commands_[static_cast<std::size_t>(i)];
+                if ((qmask & ~c.mask) != 0) continue;
+                if (int score = 0; query.empty() || search::fuzzy_match(query, c.name, score)) {
                     scored_.push_back({.idx = i, .score = score});
                 }
             }
-            std::ranges::sort(scored_, [](const auto &a, const auto &b) { return a.score > b.score; });
+            std::ranges::stable_sort(scored_, std::ranges::greater{}, &scored_entry::score);
         }
 
+        [[nodiscard]] static bool is_enabled(command_entry &c) { return !c.enabled || c.enabled(); }
+
         void handle_keyboard() {
             const int max_idx = scored_.empty() ? 0 : static_cast<int>(scored_.size()) - 1;
             if (ImGui::IsKeyPressed(ImGuiKey_DownArrow) && selected_ < max_idx) ++selected_;
@@ -130,8 +182,10 @@ namespace imgui_util {
 
             // Enter to invoke selected
             if (ImGui::IsKeyPressed(ImGuiKey_Enter) && !scored_.empty()) {
-                commands_[scored_[selected_].idx].callback();
-                ImGui::CloseCurrentPopup();
+                if (auto &c = commands_[scored_[selected_].idx]; is_enabled(c)) {
+                    c.callback();
+                    ImGui::CloseCurrentPopup();
+                }
             }
 
             // Escape to close
@@ -144,16 +198,24 @@ namespace imgui_util {
             ImGui::Separator();
             const int max_visible = std::min(static_cast<int>(scored_.size()), max_visible_);
             for (int i = 0; i < max_visible; ++i) {
-                auto &[name, description, callback] = commands_[scored_[i].idx];
-                const bool sel                      = i == selected_;
+                command_entry &c   = commands_[scored_[i].idx];
+                const bool     sel = i == selected_;
 
-                if (ImGui::Selectable(name.c_str(), sel)) {
-                    callback();
+                const disabled guard{!is_enabled(c)};
+                if (ImGui::Selectable(c.name.c_str(), sel)) {
+                    c.callback();
                     ImGui::CloseCurrentPopup();
                 }
-                if (!description.empty()) {
+                if (!c.description.empty()) {
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("%s", c.description.c_str());
+                }
+                if (const std::string_view shortcut = c.shortcut_of ? c.shortcut_of() : std::string_view{c.shortcut};
+                    !shortcut.empty()) {
                     ImGui::SameLine();
-                    ImGui::TextDisabled("%s", description.c_str());
+                    const float w = calc_text_size(shortcut).x;
+                    ImGui::SetCursorPosX(ImGui::GetCursorPosX() + std::max(0.0f, ImGui::GetContentRegionAvail().x - w));
+                    ImGui::TextDisabled("%.*s", static_cast<int>(shortcut.size()), shortcut.data());
                 }
                 if (sel) ImGui::SetItemDefaultFocus();
             }
@@ -163,46 +225,14 @@ namespace imgui_util {
             }
         }
 
-        // Fuzzy match: all query chars must appear in order in candidate.
-        // Score prefers consecutive matches and matches near the start.
-        [[nodiscard]] static constexpr bool fuzzy_match(const std::string_view query, const std::string_view candidate,
-                                                       int &score) noexcept {
-            score                  = 0;
-            std::size_t ci         = 0;
-            int         last_match = -1;
-
-            constexpr auto to_lower = [](const char c) constexpr noexcept -> char {
-                return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
-            };
-
-            for (const char qc: query) {
-                const char qlower = to_lower(qc);
-                bool       found  = false;
-                while (ci < candidate.size()) {
-                    if (const char clower = to_lower(candidate[ci]); qlower == clower) {
-                        // Bonus for consecutive matches
-                        if (last_match >= 0 && static_cast<int>(ci) == last_match + 1) score += 5;
-                        // Bonus for early matches
-                        score += std::max(0, 10 - static_cast<int>(ci));
-                        last_match = static_cast<int>(ci);
-                        ++ci;
-                        found = true;
-                        break;
-                    }
-                    ++ci;
-                }
-                if (!found) return false;
-            }
-            return true;
-        }
-
         std::vector<command_entry> commands_;
-        std::vector<scored_entry>  scored_; // transient per-frame
+        std::vector<scored_entry>  scored_; // results for scored_query_
         std::array<char, 128>      filter_{};
+        std::string                scored_query_;
         int                        selected_     = 0;
         int                        max_visible_  = 10;
         bool                       should_open_  = false;
-        bool                       filter_dirty_ = true;
+        bool                       scored_stale_ = true;
     };
 
 } // namespace imgui_util
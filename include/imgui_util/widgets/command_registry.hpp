@@ -0,0 +1,208 @@
+/// @file command_registry.hpp
+/// @brief Central table of application commands shared by menus, toolbars, the palette and hotkeys.
+///
+/// Each command is registered once with its label, optional shortcut, enable predicate and
+/// action, and is then referenced by command_id. menu_bar_builder::item(), toolbar::button()
+/// and add_to(command_palette&) draw commands by ID, so builders can be built once and
+/// re-rendered without rebuilding labels or closures. The enable predicate runs at most once
+/// per frame per command no matter how many menus, toolbars or palette rows show it.
+///
+/// Usage:
+/// @code
+///   // Once, at startup (commands, bar, menus and palette are long-lived members):
+///   const auto save = *commands.add({.label    = "Save",
+///                                    .action   = [&] { save_document(); },
+///                                    .enabled  = [&] { return doc.dirty(); },
+///                                    .shortcut = {ImGuiKey_S, ImGuiMod_Ctrl}});
+///   (void)bar.button(commands, save);
+///   (void)menus.menu("File", [&](auto &m) { (void)m.item(commands, save); });
+///   commands.add_to(palette);
+///
+///   // Every frame:
+///   commands.dispatch(); // shortcuts
+///   menus.render_main();
+///   bar.render();
+/// @endcode
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <imgui.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/widgets/command_palette.hpp"
+#include "imgui_util/widgets/hotkey_registry.hpp"
+#include "imgui_util/widgets/key_binding.hpp"
+
+namespace imgui_util {
+
+    /// @brief Stable handle to a command_registry command.
+    using command_id = std::uint32_t;
+
+    /// @brief Everything needed to register a command (designated-initializer friendly).
+    struct command_desc {
+        std::string                     label       = {}; ///< Display name, unique within the registry.
+        std::move_only_function<void()> action      = {}; ///< Invoked when executed while enabled.
+        std::move_only_function<bool()> enabled     = {}; ///< Enable predicate; empty = always enabled.
+        key_combo                       shortcut    = {}; ///< Hotkey; ImGuiKey_None = none.
+        std::string                     description = {}; ///< Palette description and toolbar tooltip.
+    };
+
+    /**
+     * @brief Retained command table: label, shortcut, enable state and action per command_id.
+     *
+     * Widgets hold a pointer to the registry, so it is neither copyable nor movable. Commands
+     * are never removed; their ids stay valid for the registry's lifetime. UI thread only.
+     */
+    class command_registry {
+    public:
+        static constexpr command_id invalid_id = ~command_id{0};
+
+        command_registry()                                    = default;
+        command_registry(const command_registry &)            = delete;
+        command_registry &operator=(const command_registry &) = delete;
+
+        /**
+         * @brief Register a command.
+         * @return Its id, or on a conflict the id of the command that already has the label or shortcut.
+         */
+        std::expected<command_id, command_id> add(command_desc desc) {
+            if (const auto it = by_label_.find(desc.label); it != by_label_.end()) return std::unexpected(it->second);
+            if (const hotkey_id holder = hotkeys_.find(desc.shortcut); holder != hotkey_registry::invalid_id)
+                return std::unexpected(command_of(holder));
+
+            const auto id = static_cast<command_id>(commands_.size());
+            commands_.push_back({.label       = std::move(desc.label),
+                                 .description = std::move(desc.description),
+                                 .shortcut    = {},
+                                 .action      = std::move(desc.action),
+                                 .enabled     = std::move(desc.enabled)});
+            by_label_.emplace(commands_.back().label, id);
+            (void)rebind(id, desc.shortcut);
+            return id;
+        }
+
+        /**
+         * @brief Change the shortcut of @p id (ImGuiKey_None removes it).
+         * @return invalid_id if @p id does not exist, or on conflict the id of the command holding
+         *         @p combo; nothing changes then.
+         */
+        std::expected<void, command_id> rebind(const command_id id, const key_combo combo) {
+            if (!contains(id)) return std::unexpected(invalid_id);
+            command &c = commands_[id];
+            if (c.hotkey == hotkey_registry::invalid_id) {
+                if (combo.key == ImGuiKey_None) return {};
+                const auto added = hotkeys_.add(c.label, combo, [this, id] { (void)execute(id); });
+                if (!added) return std::unexpected(command_of(added.error()));
+                c.hotkey = *added;
+            } else if (const auto moved = hotkeys_.rebind(c.hotkey, combo); !moved) {
+                return std::unexpected(command_of(moved.error()));
+            }
+            const key_combo bound = hotkeys_.combo(c.hotkey);
+            c.shortcut            = bound.key == ImGuiKey_None ? std::string{} : to_string(bound).str();
+            return {};
+        }
+
+        [[nodiscard]] bool        contains(const command_id id) const noexcept { return id < commands_.size(); }
+        [[nodiscard]] std::size_t size() const noexcept { return commands_.size(); }
+
+        /// @brief Command registered under @p label, or invalid_id.
+        [[nodiscard]] command_id find(const std::string_view label) const noexcept {
+            const auto it = by_label_.find(label);
+            return it == by_label_.end() ? invalid_id : it->second;
+        }
+
+        /// @brief Null-terminated label of @p id ("" if missing).
+        [[nodiscard]] const char *label(const command_id id) const noexcept {
+            return contains(id) ? commands_[id].label.c_str() : "";
+        }
+
+        /// @brief Shortcut text of @p id (e.g. "Ctrl+S"), or nullptr if it has none.
+        [[nodiscard]] const char *shortcut(const command_id id) const noexcept {
+            return contains(id) && !commands_[id].shortcut.empty() ? commands_[id].shortcut.c_str() : nullptr;
+        }
+
+        [[nodiscard]] std::string_view description(const command_id id) const noexcept {
+            return contains(id) ? std::string_view{commands_[id].description} : std::string_view{};
+        }
+
+        [[nodiscard]] key_combo combo(const command_id id) const noexcept {
+            return contains(id) ? hotkeys_.combo(commands_[id].hotkey) : key_combo{};
+        }
+
+        /// @brief Enable state of @p id; the predicate runs on the first query of each frame only.
+        [[nodiscard]] bool enabled(const command_id id) {
+            if (!contains(id)) return false;
+            command &c = commands_[id];
+            if (!c.enabled) return true;
+            if (const int frame = ImGui::GetFrameCount(); c.enabled_frame != frame) {
+                c.enabled_frame = frame;
+                c.enabled_value = c.enabled();
+            }
+            return c.enabled_value;
+        }
+
+        /**
+         * @brief Run @p id's action if it is enabled.
+         * @return True if the action ran.
+         */
+        bool execute(const command_id id) {
+            if (!enabled(id) || !commands_[id].action) return false;
+            commands_[id].action();
+            return true;
+        }
+
+        /// @brief Execute commands whose shortcut was pressed this frame (hotkey_registry::dispatch()).
+        int dispatch() { return hotkeys_.dispatch(); }
+
+        [[nodiscard]] const hotkey_registry &hotkeys() const noexcept { return hotkeys_; }
+
+        /**
+         * @brief Add every command to @p palette with its description, shortcut and enable state.
+         *
+         * The palette entries refer back to this registry by id, so they show the current
+         * shortcut after a rebind; disabled commands are listed greyed out.
+         */
+        void add_to(command_palette &palette) {
+            for (command_id id = 0; id < commands_.size(); ++id) {
+                const command &c = commands_[id];
+                palette.add_live_shortcut(
+                    c.label, c.description, [this, id] { return std::string_view{commands_[id].shortcut}; },
+                    [this, id] { (void)execute(id); }, [this, id] { return enabled(id); });
+            }
+        }
+
+    private:
+        struct command {
+            std::string                     label;
+            std::string                     description;
+            std::string                     shortcut; // display text, empty if unbound
+            std::move_only_function<void()> action;
+            std::move_only_function<bool()> enabled;
+            hotkey_id                       hotkey        = hotkey_registry::invalid_id;
+            int                             enabled_frame = -1; // frame enabled_value was computed on
+            bool                            enabled_value = true;
+        };
+
+        struct label_hash {
+            using is_transparent = void;
+            std::size_t operator()(const std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+        };
+
+        [[nodiscard]] command_id command_of(const hotkey_id hotkey) const noexcept {
+            for (command_id id = 0; id < commands_.size(); ++id)
+                if (commands_[id].hotkey == hotkey) return id;
+            return invalid_id;
+        }
+
+        std::vector<command>                                                      commands_;
+        std::unordered_map<std::string, command_id, label_hash, std::equal_to<>> by_label_;
+        hotkey_registry                                                           hotkeys_;
+    };
+
+} // namespace imgui_util
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/widgets/command_registry.hpp"
 
 namespace imgui_util::detail {
 
@@ -21,6 +22,12 @@ namespace imgui_util::detail {
         std::move_only_function<void()> action;
     };
 
+    // Drawn from the registry each frame: label, shortcut and enable state are not copied.
+    struct menu_command {
+        command_registry *commands;
+        command_id        id;
+    };
+
     struct menu_separator {};
 
     struct menu_checkbox {
@@ -38,8 +45,8 @@ namespace imgui_util::detail {
         std::vector<menu_entry>         children;
     };
 
-    struct menu_entry : std::variant<menu_item, menu_separator, menu_checkbox, menu_submenu> {
-        using base_variant = std::variant<menu_item, menu_separator, menu_checkbox, menu_submenu>;
+    struct menu_entry : std::variant<menu_item, menu_command, menu_separator, menu_checkbox, menu_submenu> {
+        using base_variant = std::variant<menu_item, menu_command, menu_separator, menu_checkbox, menu_submenu>;
         using base_variant::base_variant;
     };
 
@@ -51,6 +58,11 @@ namespace imgui_util::detail {
                     if (ImGui::MenuItem(e.label, e.shortcut, false, e.enabled)) {
                         if (e.action) e.action();
                     }
+                } else if constexpr (std::is_same_v<t, menu_command>) {
+                    if (ImGui::MenuItem(e.commands->label(e.id), e.commands->shortcut(e.id), false,
+                                        e.commands->enabled(e.id))) {
+                        (void)e.commands->execute(e.id);
+                    }
                 } else if constexpr (std::is_same_v<t, menu_separator>) {
                     ImGui::Separator();
                 } else if constexpr (std::is_same_v<t, menu_checkbox>) {
@@ -67,7 +67,7 @@ namespace imgui_util {
             // Left pane
             float left_scroll = scroll_sync;
             {
-                const child left_child{"##diff_left", ImVec2(half, 0), ImGuiChildFlags_Borders};
+                const child left_child{"##diff_left"_id, ImVec2(half, 0), ImGuiChildFlags_Borders};
                 render_pane(left, left_scroll);
             }
 
@@ -81,7 +81,7 @@ namespace imgui_util {
             // Right pane
             float right_scroll = scroll_sync;
             {
-                const child right_child{"##diff_right", ImVec2(half, 0), ImGuiChildFlags_Borders};
+                const child right_child{"##diff_right"_id, ImVec2(half, 0), ImGuiChildFlags_Borders};
                 render_pane(right, right_scroll);
             }
 
@@ -17,14 +17,33 @@
 ///
 ///   // Peek without accepting (for hover preview):
 ///   if (auto val = imgui_util::drag_drop::peek_payload<int>("ITEM")) { ... }
+///
+///   // Large or non-trivial payloads: the drag carries an 8-byte handle, the object stays put.
+///   if (const imgui_util::drag_drop_source src{}) {
+///       imgui_util::drag_drop::set_shared_payload<std::vector<asset_id>>("ASSETS", [&] {
+///           return std::make_shared<const std::vector<asset_id>>(selection); // built once per drag
+///       });
+///   }
+///   if (const imgui_util::drag_drop_target tgt{}) {
+///       if (auto ids = imgui_util::drag_drop::accept_shared_payload<std::vector<asset_id>>("ASSETS")) {
+///           import(*ids);
+///       }
+///   }
 /// @endcode
 #pragma once
 
+#include <concepts>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <imgui.h>
+#include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "imgui_util/core/raii.hpp"
 
@@ -104,7 +123,7 @@ namespace imgui_util::drag_drop {
     void source(const char *type, const T &value, const std::string_view preview_text,
                 const ImGuiDragDropFlags flags = 0) noexcept {
         if (const drag_drop_source src{flags}) {
-            set_payload(type, value);
+            set_payload(type, value, ImGuiCond_Once); // copied once per drag, not every frame
             ImGui::TextUnformatted(preview_text.data(), preview_text.data() + preview_text.size());
         }
     }
@@ -123,9 +142,167 @@ namespace imgui_util::drag_drop {
     void source(const char *type, const T &value, TooltipFn &&tooltip_fn,
                 const ImGuiDragDropFlags flags = 0) noexcept {
         if (const drag_drop_source src{flags}) {
-            set_payload(type, value);
+            set_payload(type, value, ImGuiCond_Once);
             std::forward<TooltipFn>(tooltip_fn)();
         }
     }
 
+    // ========================================================================
+    // Shared (handle-based) payloads
+    // ========================================================================
+
+    /// @brief Generation-checked reference to an object in the payload_registry (what the drag carries).
+    struct payload_handle {
+        std::uint32_t slot       = 0;
+        std::uint32_t generation = 0; ///< 0 never refers to a live entry.
+    };
+
+    /**
+     * @brief Slot table of type-erased shared objects referenced by payload_handle.
+     *
+     * Released slots bump their generation, so a stale handle never resolves to a newer object.
+     * instance() is owned by the current ImGui context and swept at the start of each of its
+     * frames: entries not carried by that context's active payload (same handle and payload
+     * type) are released. UI thread only.
+     */
+    class payload_registry {
+    public:
+        /// @param drag_type  Payload type the handle is published under (see carried_by()).
+        template<typename T>
+        [[nodiscard]] payload_handle insert(std::shared_ptr<const T> object, const std::string_view drag_type = {}) {
+            return insert_erased(std::move(object), &type_tag<T>, drag_type);
+        }
+
+        /// @brief Object behind @p h, or nullptr if the handle is stale or refers to another type.
+        template<typename T>
+        [[nodiscard]] const T *get(const payload_handle h) const noexcept {
+            const entry *e = lookup(h, &type_tag<T>);
+            return e != nullptr ? static_cast<const T *>(e->object.get()) : nullptr;
+        }
+
+        /// @brief Like get(), but shares ownership so the object can outlive the drag.
+        template<typename T>
+        [[nodiscard]] std::shared_ptr<const T> find(const payload_handle h) const noexcept {
+            const entry *e = lookup(h, &type_tag<T>);
+            return e != nullptr ? std::static_pointer_cast<const T>(e->object) : nullptr;
+        }
+
+        [[nodiscard]] bool contains(const payload_handle h) const noexcept { return lookup(h, nullptr) != nullptr; }
+
+        /// @brief True if @p h is live and was inserted for payloads of type @p drag_type.
+        [[nodiscard]] bool carried_by(const payload_handle h, const std::string_view drag_type) const noexcept {
+            const entry *e = lookup(h, nullptr);
+            return e != nullptr && e->drag_type == drag_type;
+        }
+
+        void release(const payload_handle h) noexcept {
+            if (lookup(h, nullptr) == nullptr) return;
+            entry &e = slots_[h.slot];
+            e.object.reset();
+            e.drag_type.clear();
+            e.type = nullptr;
+            ++e.generation;
+            free_.push_back(h.slot);
+            --live_;
+        }
+
+        /// @brief Release every entry except @p keep.
+        void release_except(const std::optional<payload_handle> keep) noexcept {
+            for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+                if (slots_[i].type == nullptr) continue;
+                const payload_handle h{i, slots_[i].generation};
+                if (!keep || keep->slot != h.slot || keep->generation != h.generation) release(h);
+            }
+        }
+
+        /// @brief Number of live entries.
+        [[nodiscard]] std::size_t size() const noexcept { return live_; }
+
+        /// @brief Registry of the current context used by the *_shared_payload functions; freed with the context.
+        [[nodiscard]] static payload_registry &instance();
+
+    private:
+        template<typename T>
+        static constexpr char type_tag = 0; // address identifies T
+
+        struct entry {
+            std::shared_ptr<const void> object;
+            std::string                 drag_type;
+            const void                 *type       = nullptr; // nullptr = free
+            std::uint32_t               generation = 1;
+        };
+
+        std::vector<entry>         slots_;
+        std::vector<std::uint32_t> free_;
+        std::size_t                live_ = 0;
+
+        payload_handle insert_erased(std::shared_ptr<const void> object, const void *type,
+                                     const std::string_view drag_type) {
+            std::uint32_t slot = 0;
+            if (!free_.empty()) {
+                slot = free_.back();
+                free_.pop_back();
+            } else {
+                slot = static_cast<std::uint32_t>(slots_.size());
+                slots_.emplace_back();
+            }
+            entry &e = slots_[slot];
+            e.object = std::move(object);
+            e.drag_type.assign(drag_type);
+            e.type = type;
+            ++live_;
+            return {slot, e.generation};
+        }
+
+        // Live entry for h (of the given type, unless type is nullptr), else nullptr.
+        [[nodiscard]] const entry *lookup(const payload_handle h, const void *type) const noexcept {
+            if (h.slot >= slots_.size()) return nullptr;
+            const entry &e = slots_[h.slot];
+            if (e.type == nullptr || e.generation != h.generation) return nullptr;
+            return type == nullptr || e.type == type ? &e : nullptr;
+        }
+    };
+
+    /**
+     * @brief Set a handle payload for the current drag source (call inside drag_drop_source).
+     *
+     * @p make is only invoked on the first frame of the drag; later frames find the handle
+     * already in ImGui's payload and do nothing. The object is released when the drag ends,
+     * unless a target kept it via accept_shared_payload().
+     * @tparam T    Object type (any type; never copied).
+     * @param type  Payload type identifier string (shorter than 32 characters).
+     * @param make  Returns the std::shared_ptr<const T> to publish.
+     */
+    template<typename T, std::invocable MakeFn>
+        requires std::convertible_to<std::invoke_result_t<MakeFn>, std::shared_ptr<const T>>
+    void set_shared_payload(const char *type, MakeFn &&make) {
+        payload_registry &registry = payload_registry::instance();
+        if (const auto h = peek_payload<payload_handle>(type); h && registry.carried_by(*h, type)) return;
+        const payload_handle h = registry.insert<T>(std::invoke(std::forward<MakeFn>(make)), type);
+        set_payload(type, h);
+    }
+
+    /// @brief set_shared_payload() with an existing object.
+    template<typename T>
+    void set_shared_payload(const char *type, std::shared_ptr<const T> object) {
+        set_shared_payload<T>(type, [&] { return std::move(object); });
+    }
+
+    /**
+     * @brief Accept a handle payload and resolve it without copying the object.
+     * @return Shared ownership of the object, or nullptr if nothing matching was dropped.
+     */
+    template<typename T>
+    [[nodiscard]] std::shared_ptr<const T> accept_shared_payload(const char *type, const ImGuiDragDropFlags flags = 0) {
+        if (const auto h = accept_payload<payload_handle>(type, flags)) return payload_registry::instance().find<T>(*h);
+        return nullptr;
+    }
+
+    /// @brief Peek at the active handle payload (hover preview); valid until the end of the frame.
+    template<typename T>
+    [[nodiscard]] const T *peek_shared_payload(const char *type) {
+        if (const auto h = peek_payload<payload_handle>(type)) return payload_registry::instance().get<T>(*h);
+        return nullptr;
+    }
+
 } // namespace imgui_util::drag_drop
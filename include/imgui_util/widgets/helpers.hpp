@@ -64,7 +64,7 @@ namespace imgui_util {
      * @param args         Format arguments.
      */
     template<typename... Args>
-    void label_value_fmt(const std::string_view label, const float label_width, std::format_string<Args...> fmt,
+    void label_value_fmt(const std::string_view label, const float label_width, fmt_string<Args...> fmt,
                          Args &&...args) {
         ImGui::TextUnformatted(label.data(), label.data() + label.size());
         ImGui::SameLine(label_width);
@@ -0,0 +1,253 @@
+/// @file hotkey_registry.hpp
+/// @brief Global hotkey table dispatched from the frame's key events.
+///
+/// Polling every binding with IsKeyPressed costs O(bindings) per frame. hotkey_registry
+/// compiles its key_combos into a flat table indexed by (key, modifier mask) and dispatch()
+/// looks up only the keys that had a press event this frame, so an idle frame costs nothing
+/// no matter how many bindings exist. A combo maps to at most one action: add() and rebind()
+/// report the binding that already holds it instead of silently shadowing it.
+///
+/// Usage:
+/// @code
+///   static imgui_util::hotkey_registry hotkeys;
+///   if (auto r = hotkeys.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { save(); }); !r)
+///       report_conflict(hotkeys.name(r.error()));
+///   hotkeys.add_to(palette); // list every binding, with its shortcut, in a command_palette
+///
+///   // Every frame, after ImGui::NewFrame():
+///   hotkeys.dispatch();
+/// @endcode
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/widgets/command_palette.hpp"
+#include "imgui_util/widgets/key_binding.hpp"
+
+namespace imgui_util {
+
+    /// @brief Stable handle to a hotkey_registry binding (never reused after remove() or clear()).
+    using hotkey_id = std::uint32_t;
+
+    /**
+     * @brief Key combo -> action table with O(key events) per-frame dispatch.
+     *
+     * Actions run on the UI thread from dispatch() or trigger() and must not add, rebind or
+     * remove bindings of the registry that invokes them.
+     */
+    class hotkey_registry {
+    public:
+        static constexpr hotkey_id invalid_id = ~hotkey_id{0};
+
+        /**
+         * @brief Register an action.
+         * @param name    Display name (command palette, conflict reports).
+         * @param combo   Key combination; ImGuiKey_None (or a modifier key) registers the action unbound.
+         * @param action  Invoked when the combo is pressed.
+         * @param repeat  Also fire on key repeat while the combo is held.
+         * @return Id of the new binding, or the id of the binding already holding @p combo (nothing is added).
+         */
+        std::expected<hotkey_id, hotkey_id> add(std::string name, const key_combo combo,
+                                                std::move_only_function<void()> action, const bool repeat = false) {
+            const std::size_t slot = slot_of(combo);
+            if (slot != no_slot && table_[slot] != invalid_id) return std::unexpected(table_[slot]);
+
+            const auto      id    = first_id_ + static_cast<hotkey_id>(bindings_.size());
+            const key_combo bound = normalized(combo);
+            bindings_.push_back({.name   = std::move(name),
+                                 .combo  = bound,
+                                 .label  = label_of(bound),
+                                 .action = std::move(action),
+                                 .repeat = repeat,
+                                 .live   = true});
+            if (slot != no_slot) table_[slot] = id;
+            ++live_;
+            return id;
+        }
+
+        /**
+         * @brief Move binding @p id to @p combo (ImGuiKey_None unbinds it).
+         * @return invalid_id if @p id does not exist, or the id of the binding already holding
+         *         @p combo on conflict; nothing changes then.
+         */
+        std::expected<void, hotkey_id> rebind(const hotkey_id id, const key_combo combo) {
+            if (!contains(id)) return std::unexpected(invalid_id);
+            const std::size_t slot = slot_of(combo);
+            if (slot != no_slot && table_[slot] != invalid_id && table_[slot] != id)
+                return std::unexpected(table_[slot]);
+
+            binding &b = at(id);
+            if (const std::size_t old = slot_of(b.combo); old != no_slot) table_[old] = invalid_id;
+            if (slot != no_slot) table_[slot] = id;
+            b.combo = normalized(combo);
+            b.label = label_of(b.combo);
+            return {};
+        }
+
+        void remove(const hotkey_id id) noexcept {
+            if (!contains(id)) return;
+            binding &b = at(id);
+            if (const std::size_t slot = slot_of(b.combo); slot != no_slot) table_[slot] = invalid_id;
+            b = binding{};
+            --live_;
+        }
+
+        /// @brief Remove every binding; ids handed out so far stay invalid.
+        void clear() noexcept {
+            first_id_ += bindings_.size();
+            bindings_.clear();
+            held_.clear();
+            std::ranges::fill(table_, invalid_id);
+            live_ = 0;
+        }
+
+        /// @brief Binding that holds @p combo, or invalid_id.
+        [[nodiscard]] hotkey_id find(const key_combo combo) const noexcept {
+            const std::size_t slot = slot_of(combo);
+            return slot == no_slot ? invalid_id : table_[slot];
+        }
+
+        [[nodiscard]] bool contains(const hotkey_id id) const noexcept {
+            return id >= first_id_ && id - first_id_ < bindings_.size() && at(id).live;
+        }
+
+        /// @brief Display name of @p id (empty if it does not exist).
+        [[nodiscard]] std::string_view name(const hotkey_id id) const noexcept {
+            return contains(id) ? std::string_view{at(id).name} : std::string_view{};
+        }
+
+        /// @brief Combo of @p id ({ImGuiKey_None, ImGuiMod_None} if unbound or missing).
+        [[nodiscard]] key_combo combo(const hotkey_id id) const noexcept {
+            return contains(id) ? at(id).combo : key_combo{};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return live_; }
+        [[nodiscard]] bool        empty() const noexcept { return live_ == 0; }
+
+        /**
+         * @brief Invoke the action bound to @p combo, if any.
+         * @return True if an action ran.
+         */
+        bool trigger(const key_combo combo) { return invoke(find(combo)); }
+
+        /**
+         * @brief Fire the actions for this frame's key presses. Call once per frame after NewFrame().
+         *
+         * Every key-down event ImGui processed this frame is looked up with the current modifier
+         * state; held combos registered with repeat also fire on ImGui's key repeat. While a
+         * text field has focus, combos without Ctrl, Alt or Super are left to the text field,
+         * and nothing fires while a key_binding_editor is capturing.
+         * @return Number of actions invoked.
+         */
+        int dispatch() {
+            if (live_ == 0 || detail::key_capture_frame(*GImGui) >= ImGui::GetFrameCount() - 1) return 0;
+            const ImGuiIO      &io     = ImGui::GetIO();
+            const ImGuiKeyChord mods   = io.KeyMods & ImGuiMod_Mask_;
+            const bool          typing = io.WantTextInput;
+            const int           frame  = ImGui::GetFrameCount();
+
+            int fired = 0;
+            detail::for_each_key_press([&](const ImGuiKey key) {
+                const hotkey_id id = find({key, mods});
+                if (id == invalid_id || (typing && (mods & text_safe_mods) == 0)) return;
+                if (at(id).repeat && std::ranges::find(held_, id, &held_combo::id) == held_.end())
+                    held_.push_back({.id = id, .frame = frame});
+                fired += invoke(id) ? 1 : 0;
+            });
+
+            // Repeat ticks for held combos; presses this frame already fired above
+            std::erase_if(held_, [&](const held_combo &h) {
+                if (!contains(h.id)) return true;
+                const key_combo c = at(h.id).combo;
+                return c.key == ImGuiKey_None || c.mods != mods || !ImGui::IsKeyDown(c.key);
+            });
+            for (std::size_t i = 0; i < held_.size(); ++i) {
+                const held_combo h = held_[i];
+                if (h.frame == frame || !ImGui::IsKeyPressed(at(h.id).combo.key, true)) continue;
+                if (typing && (mods & text_safe_mods) == 0) continue;
+                fired += invoke(h.id) ? 1 : 0;
+            }
+            return fired;
+        }
+
+        /**
+         * @brief Add every binding to @p palette as a command labelled with its shortcut.
+         *
+         * The palette commands refer back to this registry by id, which must outlive them: they
+         * show the current shortcut after a rebind and are greyed out once the binding is removed.
+         */
+        void add_to(command_palette &palette) {
+            for (std::size_t i = 0; i < bindings_.size(); ++i) {
+                const hotkey_id id = first_id_ + static_cast<hotkey_id>(i);
+                if (!bindings_[i].live) continue;
+                palette.add_live_shortcut(
+                    bindings_[i].name, {}, [this, id] { return contains(id) ? at(id).label.sv() : std::string_view{}; },
+                    [this, id] { (void)invoke(id); }, [this, id] { return contains(id); });
+            }
+        }
+
+    private:
+        static constexpr std::size_t   no_slot        = ~std::size_t{0};
+        static constexpr int           mod_shift      = std::countr_zero(static_cast<unsigned>(ImGuiMod_Ctrl));
+        static constexpr std::size_t   mod_states     = std::size_t{1} << std::popcount(unsigned{ImGuiMod_Mask_});
+        static constexpr ImGuiKeyChord text_safe_mods = ImGuiMod_Ctrl | ImGuiMod_Alt | ImGuiMod_Super;
+
+        struct binding {
+            std::string                     name;
+            key_combo                       combo;
+            fmt_buf<128>                    label; // to_string(combo), empty when unbound
+            std::move_only_function<void()> action;
+            bool                            repeat = false;
+            bool                            live   = false;
+        };
+
+        struct held_combo {
+            hotkey_id id    = invalid_id;
+            int       frame = 0; // frame of the initial press
+        };
+
+        [[nodiscard]] static fmt_buf<128> label_of(const key_combo combo) noexcept {
+            return combo.key == ImGuiKey_None ? fmt_buf<128>{} : to_string(combo);
+        }
+
+        [[nodiscard]] static key_combo normalized(const key_combo combo) noexcept {
+            if (slot_of(combo) == no_slot) return {};
+            return {combo.key, combo.mods & ImGuiMod_Mask_};
+        }
+
+        /// @brief Table index of @p combo: named key major, modifier mask minor; no_slot if unbindable.
+        [[nodiscard]] static std::size_t slot_of(const key_combo combo) noexcept {
+            if (combo.key < ImGuiKey_NamedKey_BEGIN || combo.key >= ImGuiKey_NamedKey_END) return no_slot;
+            if (detail::is_modifier_key(combo.key)) return no_slot;
+            const auto key  = static_cast<std::size_t>(combo.key - ImGuiKey_NamedKey_BEGIN);
+            const auto mods = static_cast<std::size_t>((combo.mods & ImGuiMod_Mask_) >> mod_shift);
+            return key * mod_states + mods;
+        }
+
+        [[nodiscard]] binding       &at(const hotkey_id id) noexcept { return bindings_[id - first_id_]; }
+        [[nodiscard]] const binding &at(const hotkey_id id) const noexcept { return bindings_[id - first_id_]; }
+
+        bool invoke(const hotkey_id id) {
+            if (!contains(id) || !at(id).action) return false;
+            at(id).action();
+            return true;
+        }
+
+        std::vector<binding>    bindings_; // bindings_[i] has id first_id_ + i
+        hotkey_id               first_id_ = 0;
+        std::vector<hotkey_id>  table_ = std::vector<hotkey_id>(ImGuiKey_NamedKey_COUNT * mod_states, invalid_id);
+        std::vector<held_combo> held_; // repeat-enabled combos currently held
+        std::size_t             live_ = 0;
+    };
+
+} // namespace imgui_util
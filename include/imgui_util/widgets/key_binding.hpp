@@ -21,6 +21,7 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 
+#include "imgui_util/core/context_state.hpp"
 #include "imgui_util/core/fmt_buf.hpp"
 #include "imgui_util/core/raii.hpp"
 
@@ -69,6 +70,36 @@ namespace imgui_util {
             }
         }
 
+        /**
+         * @brief Call @p fn(key) for every named, non-modifier key that went down this frame.
+         *
+         * Walks the input events ImGui processed in the last NewFrame(), in the order they
+         * arrived, instead of polling every key.
+         */
+        template<typename F>
+        void for_each_key_press(F &&fn) {
+            for (const ImGuiInputEvent &e: GImGui->InputEventsTrail) {
+                if (e.Type != ImGuiInputEventType_Key || !e.Key.Down) continue;
+                if (!ImGui::IsNamedKey(e.Key.Key) || is_modifier_key(e.Key.Key)) continue;
+                fn(e.Key.Key);
+            }
+        }
+
+        // Last frame on which a key_binding_editor of a context was capturing (hotkey dispatch stands down).
+        struct key_capture_state {
+            int frame = -2;
+        };
+
+        inline context_state<key_capture_state> &key_captures() {
+            static context_state<key_capture_state> states;
+            return states;
+        }
+
+        [[nodiscard]] inline int key_capture_frame(const ImGuiContext &ctx) noexcept {
+            const key_capture_state *s = key_captures().find(ctx);
+            return s != nullptr ? s->frame : -2;
+        }
+
         [[nodiscard]] inline ImGuiKeyChord current_modifiers() noexcept {
             const auto   &io   = ImGui::GetIO();
             ImGuiKeyChord mods = ImGuiMod_None;
@@ -120,22 +151,22 @@ namespace imgui_util {
                 *capturing = 0;
             }
 
+            detail::key_captures().get(*GImGui).frame = ImGui::GetFrameCount();
+
             // Check for Escape to cancel
             if (ImGui::IsKeyPressed(ImGuiKey_Escape)) {
                 *capturing = 0;
             } else {
-                // Scan for a non-modifier key press
-                for (int k = ImGuiKey_NamedKey_BEGIN; k < ImGuiKey_NamedKey_END; ++k) {
-                    const auto key = static_cast<ImGuiKey>(k);
-                    if (detail::is_modifier_key(key)) continue;
-
-                    if (ImGui::IsKeyPressed(key)) {
-                        combo->key  = key;
-                        combo->mods = detail::current_modifiers();
-                        *capturing  = 0;
-                        changed     = true;
-                        break;
-                    }
+                // First non-modifier key pressed this frame
+                ImGuiKey pressed = ImGuiKey_None;
+                detail::for_each_key_press([&pressed](const ImGuiKey key) {
+                    if (pressed == ImGuiKey_None) pressed = key;
+                });
+                if (pressed != ImGuiKey_None) {
+                    combo->key  = pressed;
+                    combo->mods = detail::current_modifiers();
+                    *capturing  = 0;
+                    changed     = true;
                 }
             }
         } else {
@@ -76,7 +76,7 @@ namespace imgui_util {
             update_filter();
 
             // --- Scrolling child region ---
-            if (const child child_scope{"##entries", ImVec2(0, 0), ImGuiChildFlags_Borders}) {
+            if (const child child_scope{"##entries"_id, ImVec2(0, 0), ImGuiChildFlags_Borders}) {
                 ImGuiListClipper clipper;
                 clipper.Begin(static_cast<int>(filtered_.size()));
                 while (clipper.Step()) {
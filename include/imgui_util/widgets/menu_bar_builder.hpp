@@ -20,6 +20,10 @@
 ///   imgui_util::menu_bar_builder()
 ///       .menu("File", [](auto& m) { ... })
 ///       .render_main();  // main/viewport menu bar
+///
+///   // Items for command_registry commands; build once, render every frame:
+///   menus.menu("Edit", [&](auto& m) { (void)m.item(commands, undo_id).item(commands, redo_id); });
+///   menus.render();
 /// @endcode
 #pragma once
 
@@ -73,6 +77,17 @@ namespace imgui_util {
             return *this;
         }
 
+        /**
+         * @brief Add a menu item for a registered command.
+         *
+         * Label, shortcut text and enable state are read from @p commands each frame, so the
+         * builder can be kept and re-rendered. @p commands must outlive the builder.
+         */
+        [[nodiscard]] menu_bar_builder &item(command_registry &commands, const command_id id) {
+            entries_.emplace_back(detail::menu_command{.commands = &commands, .id = id});
+            return *this;
+        }
+
         /// @brief Add a visual separator line.
         [[nodiscard]] menu_bar_builder &separator() {
             entries_.emplace_back(detail::menu_separator{});
@@ -229,7 +229,7 @@ namespace imgui_util::notification_center {
             ImGui::Separator();
 
             // Scrollable list (newest first)
-            if (const child child_scope{"##notif_list"}) {
+            if (const child child_scope{"##notif_list"_id}) {
                 const int                count = static_cast<int>(entries.size());
                 std::vector<std::size_t> to_dismiss;
 
@@ -2,7 +2,14 @@
 /// @brief Drag-to-reorder list widget.
 ///
 /// Renders each item with a drag handle grip icon. Full drag & drop reordering
-/// with visual insertion indicator. Uses std::ranges::rotate for efficient moves.
+/// with visual insertion indicator.
+///
+/// reorder_list() mutates a std::vector in place and suits short lists.
+/// reorder_list_view is the virtualized form for large ones: only visible rows are
+/// submitted (fixed row height, or measured heights cached per row), the list
+/// auto-scrolls while dragging near its edges, a multi-row selection drags as one block,
+/// and drops are reported as reorder_move records that callers apply to their own
+/// containers (or index permutations) instead of having the widget move elements.
 ///
 /// Usage:
 /// @code
@@ -12,12 +19,26 @@
 ///   })) {
 ///       // order changed
 ///   }
+///
+///   // 50k rows, rendered by index, applied to the caller's own storage
+///   static imgui_util::reorder_list_view view{{.item_height = 20.0f}};
+///   if (const imgui_util::child c{"##playlist"}) {
+///       if (auto mv = view.render("##tracks", track_count, [&](int i) { draw_track(order[i]); }))
+///           imgui_util::apply_move(order, *mv);
+///   }
 /// @endcode
 #pragma once
 
 #include <algorithm>
 #include <concepts>
+#include <cstddef>
+#include <functional>
 #include <imgui.h>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "imgui_util/core/raii.hpp"
@@ -25,6 +46,92 @@
 
 namespace imgui_util {
 
+    /**
+     * @brief One drag & drop reorder: move the rows @c from so they end up, in their
+     *        current relative order, just before the row that was at index @c to.
+     *
+     * Indices refer to the order before the move; @c to == size means "at the end".
+     */
+    struct reorder_move {
+        std::vector<int> from;   ///< Moved indices, sorted ascending and unique.
+        int              to = 0; ///< Insertion point in the pre-move order.
+
+        /// @brief Index of the first moved row after the move.
+        [[nodiscard]] int destination() const noexcept {
+            return to - static_cast<int>(std::ranges::lower_bound(from, to) - from.begin());
+        }
+
+        /// @brief True if the move leaves the order unchanged.
+        [[nodiscard]] bool is_noop() const noexcept {
+            if (from.empty()) return true;
+            const bool contiguous = from.back() - from.front() + 1 == static_cast<int>(from.size());
+            return contiguous && from.front() == destination();
+        }
+
+        /// @brief Pre-move index of each row after the move (new order), for @p count rows.
+        [[nodiscard]] std::vector<int> permutation(const int count) const {
+            std::vector<int> order;
+            order.reserve(static_cast<std::size_t>(std::max(count, 0)));
+            auto       sel  = from.begin();
+            const auto keep = [&](const int i) {
+                if (sel != from.end() && *sel == i) ++sel;
+                else order.push_back(i);
+            };
+            for (int i = 0; i < std::min(to, count); ++i) keep(i);
+            order.insert(order.end(), from.begin(), from.end());
+            for (int i = std::max(to, 0); i < count; ++i) keep(i);
+            return order;
+        }
+    };
+
+    /**
+     * @brief Apply @p move to a random-access range.
+     *
+     * Touches only the span between the moved rows and the insertion point: every element in
+     * it is moved at most once, plus the moved rows themselves twice (via a small buffer).
+     * @return False (and no change) for a no-op or out-of-range move.
+     */
+    template<std::ranges::random_access_range R>
+        requires std::ranges::sized_range<R> && std::movable<std::ranges::range_value_t<R>>
+    bool apply_move(R &&items, const reorder_move &move) {
+        const auto n = static_cast<int>(std::ranges::size(items));
+        if (move.is_noop() || move.from.front() < 0 || move.from.back() >= n || move.to < 0 || move.to > n)
+            return false;
+        if (std::ranges::adjacent_find(move.from, std::greater_equal{}) != move.from.end()) return false;
+
+        const auto it = std::ranges::begin(items);
+        std::vector<std::ranges::range_value_t<R>> moved;
+        moved.reserve(move.from.size());
+        for (const int i: move.from) moved.push_back(std::move(it[i]));
+
+        const int lo = std::min(move.from.front(), move.to);
+        const int hi = std::max(move.from.back() + 1, move.to);
+
+        // Close the gaps left of the insertion point towards lo, right of it towards hi;
+        // what remains between the two is exactly the moved block.
+        int  w   = lo;
+        auto sel = move.from.begin();
+        for (int i = lo; i < move.to; ++i) {
+            if (sel != move.from.end() && *sel == i) {
+                ++sel;
+                continue;
+            }
+            if (w != i) it[w] = std::move(it[i]);
+            ++w;
+        }
+        int  r    = hi;
+        auto rsel = move.from.rbegin();
+        for (int i = hi - 1; i >= move.to; --i) {
+            if (rsel != move.from.rend() && *rsel == i) {
+                ++rsel;
+                continue;
+            }
+            if (--r != i) it[r] = std::move(it[i]);
+        }
+        std::ranges::move(moved, it + w);
+        return true;
+    }
+
     namespace detail {
 
         inline void draw_grip_icon(ImDrawList *dl, const ImVec2 pos, const float height, const ImU32 color) noexcept {
@@ -39,14 +146,14 @@ namespace imgui_util {
             }
         }
 
-        template<typename T, typename RenderFn>
-        void render_item_auto_height(const T &item, RenderFn &render_item, const float grip_w, const float avail_w,
+        template<std::invocable DrawFn>
+        void render_item_auto_height(const DrawFn &draw, const float grip_w, const float avail_w,
                                      const ImU32 grip_color) {
             const ImVec2 cursor_before = ImGui::GetCursorPos();
             {
                 const group grp{};
                 ImGui::SetCursorPosX(cursor_before.x + grip_w);
-                render_item(item);
+                draw();
             }
             const float row_h = ImGui::GetItemRectSize().y;
 
@@ -58,34 +165,19 @@ namespace imgui_util {
             ImGui::InvisibleButton("##drag_handle", {avail_w, row_h});
         }
 
-        template<typename T, typename RenderFn>
-        void render_item_fixed_height(const T &item, RenderFn &render_item, const float grip_w, const float avail_w,
-                                      const float row_h, const ImU32 grip_color) {
+        template<std::invocable DrawFn>
+        void render_item_fixed_height(const DrawFn &draw, const float grip_w, const float avail_w, const float row_h,
+                                      const ImU32 grip_color) {
             const ImVec2 cursor_before = ImGui::GetCursorPos();
-            ImGui::InvisibleButton("##drag_handle", {avail_w, row_h});
-            const ImVec2 item_min = ImGui::GetItemRectMin();
-
-            auto *const dl = ImGui::GetWindowDrawList();
-            draw_grip_icon(dl, item_min, row_h, grip_color);
+            draw_grip_icon(ImGui::GetWindowDrawList(), ImGui::GetCursorScreenPos(), row_h, grip_color);
 
             ImGui::SetCursorPos({cursor_before.x + grip_w, cursor_before.y});
-            render_item(item);
-            ImGui::SetCursorPos({cursor_before.x, cursor_before.y + row_h});
-        }
+            draw();
 
-        template<typename T>
-        bool apply_reorder(std::vector<T> &items, const int from, int to) {
-            const int count = static_cast<int>(items.size());
-            if (from == to || from < 0 || from >= count) return false;
-            if (from < to) --to;
-            if (to == from || to < 0 || to > count - 1) return false;
-
-            if (from < to) {
-                std::ranges::rotate(items.begin() + from, items.begin() + from + 1, items.begin() + to + 1);
-            } else {
-                std::ranges::rotate(items.begin() + to, items.begin() + from, items.begin() + from + 1);
-            }
-            return true;
+            // Submitted last so the handle is the item the caller's drag source and drop target see
+            ImGui::SetCursorPos(cursor_before);
+            ImGui::InvisibleButton("##drag_handle", {avail_w, row_h});
+            ImGui::SetCursorPos({cursor_before.x, cursor_before.y + row_h});
         }
 
         inline void draw_insertion_indicator(const ImU32 insert_color, bool &above) {
@@ -104,6 +196,9 @@ namespace imgui_util {
 
     /**
      * @brief Drag-to-reorder list with grip handles and visual insertion indicator.
+     *
+     * With a fixed @p item_height only visible rows are submitted (ImGuiListClipper); the row
+     * being dragged is always submitted so the drag survives scrolling it out of view.
      * @tparam T         Element type.
      * @tparam RenderFn  Callable taking `const T&` to render each item.
      * @param str_id       ImGui string ID.
@@ -130,17 +225,17 @@ namespace imgui_util {
         const ImU32 grip_color   = ImGui::GetColorU32(ImGuiCol_TextDisabled);
         const ImU32 insert_color = ImGui::GetColorU32(ImGuiCol_DragDropTarget);
 
-        const auto count = static_cast<int>(items.size());
-        for (int i = 0; i < count; ++i) {
+        const auto count    = static_cast<int>(items.size());
+        const auto draw_row = [&](const int i) {
             constexpr float grip_w = 20.0f;
             const id        id_scope{i};
+            const T        &item = items[static_cast<std::size_t>(i)];
 
             if (item_height <= 0.0f) {
-                detail::render_item_auto_height(items[static_cast<std::size_t>(i)], render_item, grip_w, avail_w,
-                                                grip_color);
+                detail::render_item_auto_height([&] { render_item(item); }, grip_w, avail_w, grip_color);
             } else {
-                detail::render_item_fixed_height(items[static_cast<std::size_t>(i)], render_item, grip_w, avail_w,
-                                                 item_height, grip_color);
+                detail::render_item_fixed_height([&] { render_item(item); }, grip_w, avail_w, item_height,
+                                                 grip_color);
             }
 
             // Drag source
@@ -158,11 +253,23 @@ namespace imgui_util {
 
                 if (const auto from_opt = drag_drop::accept_payload<int>("REORDER_ITEM")) {
                     const int to = above ? i : i + 1;
-                    changed      = detail::apply_reorder(items, *from_opt, to) || changed;
+                    changed      = apply_move(items, reorder_move{{*from_opt}, to}) || changed;
                     storage->SetInt(src_key, -1);
                     storage->SetBool(active_key, false);
                 }
             }
+        };
+
+        if (item_height <= 0.0f) {
+            for (int i = 0; i < count; ++i) draw_row(i);
+        } else {
+            ImGuiListClipper clipper;
+            clipper.Begin(count, item_height);
+            if (const int src = storage->GetInt(src_key, -1); dragging && src >= 0 && src < count)
+                clipper.IncludeItemByIndex(src);
+            while (clipper.Step()) {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) draw_row(i);
+            }
         }
 
         // Clear drag state when not dragging
@@ -174,4 +281,258 @@ namespace imgui_util {
         return changed;
     }
 
+    /**
+     * @brief Virtualized drag-to-reorder list for large item counts.
+     *
+     * Rows are addressed by index and rendered by a callback; only rows inside the window's
+     * clip rect (plus the row being dragged) are submitted. Rows are either a fixed height
+     * or measured as they are drawn, with heights cached per row (unmeasured rows use an
+     * estimate). Click, Ctrl+click and Shift+click select rows; dragging a selected row drags
+     * the whole selection. Dragging near the top or bottom edge of the window scrolls it.
+     *
+     * Put the list in a scrolling child window: visibility and auto-scroll use the current
+     * window's clip rect, so padding, scrollbars and an enclosing clip region are honoured.
+     */
+    class reorder_list_view {
+    public:
+        struct options {
+            float item_height       = 0.0f;   ///< Fixed row height, or <= 0 to measure and cache heights.
+            float edge_scroll_zone  = 24.0f;  ///< Distance from the window edge where dragging scrolls (px).
+            float edge_scroll_speed = 900.0f; ///< Scroll speed at the very edge (px/s).
+        };
+
+        reorder_list_view() = default;
+        explicit reorder_list_view(const options &opts) : opts_(opts) {}
+
+        /**
+         * @brief Render @p count rows; call once per frame.
+         * @param str_id       ImGui string ID.
+         * @param count        Number of rows.
+         * @param render_item  Callback taking the row index.
+         * @return The move dropped this frame, if any. Rows are not moved by the widget; the
+         *         selection and height cache already follow the move.
+         */
+        template<std::invocable<int> RenderFn>
+        [[nodiscard]] std::optional<reorder_move> render(const char *str_id, const int count,
+                                                         const RenderFn &render_item) {
+            const id scope{str_id};
+            sync(count);
+            if (count <= 0) return std::nullopt;
+
+            frame_.list_id      = ImGui::GetID("##reorder");
+            frame_.origin       = ImGui::GetCursorScreenPos();
+            frame_.avail_w      = ImGui::GetContentRegionAvail().x;
+            frame_.grip_color   = ImGui::GetColorU32(ImGuiCol_TextDisabled);
+            frame_.insert_color = ImGui::GetColorU32(ImGuiCol_DragDropTarget);
+            frame_.select_color = ImGui::GetColorU32(ImGuiCol_Header);
+            frame_.result.reset();
+
+            const std::optional<payload> active = drag_drop::peek_payload<payload>(payload_type);
+            frame_.dragging                     = active.has_value() && active->list == frame_.list_id;
+            if (!frame_.dragging) drag_src_ = -1;
+
+            const ImDrawList *dl       = ImGui::GetWindowDrawList();
+            const ImVec2      clip_min = dl->GetClipRectMin();
+            const ImVec2      clip_max = dl->GetClipRectMax();
+            const int         first    = row_at(clip_min.y - frame_.origin.y);
+            const int         last     = std::min(row_at(clip_max.y - frame_.origin.y) + 1, count);
+            for (int i = first; i < last; ++i) render_row(i, render_item);
+            if (drag_src_ >= 0 && drag_src_ < count && (drag_src_ < first || drag_src_ >= last))
+                render_row(drag_src_, render_item); // keeps the drag source alive while scrolled away
+
+            if (frame_.dragging) edge_scroll(clip_min, clip_max);
+
+            ImGui::SetCursorScreenPos({frame_.origin.x, frame_.origin.y + row_offset(count) - row_spacing()});
+            ImGui::Dummy({0.0f, 0.0f});
+            return std::move(frame_.result);
+        }
+
+        /**
+         * @brief Render a vector and apply the dropped move to it.
+         * @return True if the order changed this frame.
+         */
+        template<typename T, std::invocable<const T &> RenderFn>
+        [[nodiscard]] bool render(const char *str_id, std::vector<T> &items, const RenderFn &render_item) {
+            const auto mv = render(str_id, static_cast<int>(items.size()),
+                                   [&](const int i) { render_item(items[static_cast<std::size_t>(i)]); });
+            return mv.has_value() && apply_move(items, *mv);
+        }
+
+        /// @brief Selected row indices, sorted ascending.
+        [[nodiscard]] std::span<const int> selection() const noexcept { return selection_; }
+        [[nodiscard]] bool is_selected(const int index) const noexcept {
+            return std::ranges::binary_search(selection_, index);
+        }
+        /// @brief Select @p index alone, or add it to the selection.
+        void select(const int index, const bool add = false) {
+            if (!add) selection_.clear();
+            if (const auto it = std::ranges::lower_bound(selection_, index); it == selection_.end() || *it != index)
+                selection_.insert(it, index);
+            anchor_ = index;
+        }
+        void clear_selection() noexcept { selection_.clear(); }
+
+        /// @brief Forget measured heights (e.g. after a font or content change).
+        void invalidate_heights() noexcept {
+            heights_.clear();
+            offsets_valid_ = 0;
+        }
+
+    private:
+        static constexpr const char *payload_type = "REORDER_ROWS";
+        static constexpr float       grip_w       = 20.0f;
+
+        struct payload {
+            ImGuiID list  = 0;
+            int     index = -1;
+        };
+
+        // Per-frame values shared by render_row()
+        struct frame_state {
+            ImGuiID                     list_id = 0;
+            ImVec2                      origin;
+            float                       avail_w      = 0.0f;
+            ImU32                       grip_color   = 0;
+            ImU32                       insert_color = 0;
+            ImU32                       select_color = 0;
+            bool                        dragging     = false;
+            std::optional<reorder_move> result;
+        };
+
+        options            opts_;
+        frame_state        frame_;
+        std::vector<int>   selection_;
+        int                anchor_        = -1;
+        int                pending_click_ = -1; // selected row pressed without modifiers; collapses on release
+        int                drag_src_      = -1;
+        std::vector<float> heights_;            // measured row pitch (cached mode)
+        std::vector<float> offsets_;            // prefix sums of heights_, size count + 1
+        std::size_t        offsets_valid_ = 0;  // offsets_[0..offsets_valid_] are up to date
+
+        [[nodiscard]] bool  fixed() const noexcept { return opts_.item_height > 0.0f; }
+        [[nodiscard]] float row_spacing() const noexcept { return fixed() ? 0.0f : ImGui::GetStyle().ItemSpacing.y; }
+
+        void sync(const int count) {
+            const auto n = static_cast<std::size_t>(std::max(count, 0));
+            while (!selection_.empty() && selection_.back() >= count) selection_.pop_back();
+            if (fixed()) return;
+            if (heights_.size() != n) {
+                stale_from(std::min(heights_.size(), n));
+                heights_.resize(n, ImGui::GetTextLineHeightWithSpacing());
+            }
+            if (offsets_valid_ >= n && offsets_.size() == n + 1) return;
+            offsets_.resize(n + 1);
+            offsets_[0] = 0.0f;
+            for (std::size_t i = std::min(offsets_valid_, n); i < n; ++i) offsets_[i + 1] = offsets_[i] + heights_[i];
+            offsets_valid_ = n;
+        }
+
+        // Row @p i changed height (or moved): offsets after it are stale.
+        void stale_from(const std::size_t i) noexcept { offsets_valid_ = std::min(offsets_valid_, i); }
+
+        [[nodiscard]] float row_offset(const int i) const noexcept {
+            return fixed() ? static_cast<float>(i) * opts_.item_height : offsets_[static_cast<std::size_t>(i)];
+        }
+
+        // Row containing local y (clamped to the valid range).
+        [[nodiscard]] int row_at(const float y) const noexcept {
+            if (fixed()) return std::max(static_cast<int>(y / opts_.item_height), 0);
+            const auto it = std::ranges::upper_bound(offsets_, y);
+            return std::max(static_cast<int>(it - offsets_.begin()) - 1, 0);
+        }
+
+        template<typename RenderFn>
+        void render_row(const int i, const RenderFn &render_item) {
+            const id    row_scope{i};
+            const float y = frame_.origin.y + row_offset(i);
+            ImGui::SetCursorScreenPos({frame_.origin.x, y});
+
+            if (is_selected(i)) {
+                const float h = fixed() ? opts_.item_height : heights_[static_cast<std::size_t>(i)] - row_spacing();
+                const ImVec2 max{frame_.origin.x + frame_.avail_w, y + h};
+                ImGui::GetWindowDrawList()->AddRectFilled({frame_.origin.x, y}, max, frame_.select_color);
+            }
+            if (fixed()) {
+                detail::render_item_fixed_height([&] { render_item(i); }, grip_w, frame_.avail_w, opts_.item_height,
+                                                 frame_.grip_color);
+            } else {
+                detail::render_item_auto_height([&] { render_item(i); }, grip_w, frame_.avail_w, frame_.grip_color);
+                const float measured = ImGui::GetItemRectSize().y + row_spacing();
+                if (float &h = heights_[static_cast<std::size_t>(i)]; h != measured) {
+                    h = measured;
+                    stale_from(static_cast<std::size_t>(i));
+                }
+            }
+
+            handle_click(i);
+
+            if (const drag_drop_source src{ImGuiDragDropFlags_SourceNoPreviewTooltip}) {
+                drag_drop::set_payload(payload_type, payload{frame_.list_id, i});
+                drag_src_      = i;
+                pending_click_ = -1;
+            }
+
+            if (!frame_.dragging) return;
+            if (const drag_drop_target tgt{}) {
+                bool above = false;
+                detail::draw_insertion_indicator(frame_.insert_color, above);
+                if (const auto p = drag_drop::accept_payload<payload>(payload_type)) drop(*p, above ? i : i + 1);
+            }
+        }
+
+        void handle_click(const int i) {
+            if (ImGui::IsItemClicked(ImGuiMouseButton_Left)) {
+                const ImGuiIO &io = ImGui::GetIO();
+                if (io.KeyShift && anchor_ >= 0) {
+                    selection_.clear();
+                    for (int k = std::min(anchor_, i); k <= std::max(anchor_, i); ++k) selection_.push_back(k);
+                } else if (io.KeyCtrl) {
+                    if (const auto it = std::ranges::lower_bound(selection_, i); it != selection_.end() && *it == i)
+                        selection_.erase(it);
+                    else
+                        select(i, true);
+                } else if (is_selected(i)) {
+                    pending_click_ = i; // may be the start of a drag of the whole selection
+                } else {
+                    select(i);
+                }
+            }
+            if (ImGui::IsItemDeactivated() && pending_click_ == i) {
+                select(i);
+                pending_click_ = -1;
+            }
+        }
+
+        void drop(const payload &p, const int to) {
+            if (p.list != frame_.list_id) return;
+            reorder_move mv;
+            if (selection_.size() > 1 && is_selected(p.index)) mv.from = selection_;
+            else mv.from = {p.index};
+            mv.to     = to;
+            drag_src_ = -1;
+            if (mv.is_noop()) return;
+
+            if (!fixed()) {
+                apply_move(heights_, mv);
+                stale_from(static_cast<std::size_t>(std::min(mv.from.front(), mv.to)));
+            }
+            const int dest = mv.destination();
+            selection_.clear();
+            for (int k = 0; k < static_cast<int>(mv.from.size()); ++k) selection_.push_back(dest + k);
+            anchor_       = dest;
+            frame_.result = std::move(mv);
+        }
+
+        void edge_scroll(const ImVec2 clip_min, const ImVec2 clip_max) const {
+            const ImGuiIO &io = ImGui::GetIO();
+            if (io.MousePos.x < clip_min.x || io.MousePos.x > clip_max.x) return;
+            const float zone = std::max(opts_.edge_scroll_zone, 1.0f);
+            const float my   = io.MousePos.y;
+            float       dir  = 0.0f;
+            if (my < clip_min.y + zone) dir = -std::min((clip_min.y + zone - my) / zone, 1.0f);
+            else if (my > clip_max.y - zone) dir = std::min((my - (clip_max.y - zone)) / zone, 1.0f);
+            if (dir != 0.0f) ImGui::SetScrollY(ImGui::GetScrollY() + dir * opts_.edge_scroll_speed * io.DeltaTime);
+        }
+    };
+
 } // namespace imgui_util
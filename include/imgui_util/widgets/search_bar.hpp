@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstdint>
 #include <imgui.h>
 #include <optional>
 #include <string_view>
@@ -49,6 +50,53 @@ namespace imgui_util::search {
         return (contains_ignore_case(fields, query) || ...);
     }
 
+    /**
+     * @brief Fuzzy subsequence match: every char of @p query appears in order in @p candidate (case-insensitive).
+     * @param score Set on success; higher for consecutive matches and matches near the start.
+     */
+    [[nodiscard]] constexpr bool fuzzy_match(const std::string_view query, const std::string_view candidate,
+                                             int &score) noexcept {
+        score                  = 0;
+        std::size_t ci         = 0;
+        int         last_match = -1;
+
+        for (const char qc: query) {
+            bool found = false;
+            while (ci < candidate.size()) {
+                if (char_equal_ignore_case(qc, candidate[ci])) {
+                    // Bonus for consecutive matches
+                    if (last_match >= 0 && static_cast<int>(ci) == last_match + 1) score += 5;
+                    // Bonus for early matches
+                    score += std::max(0, 10 - static_cast<int>(ci));
+                    last_match = static_cast<int>(ci);
+                    ++ci;
+                    found = true;
+                    break;
+                }
+                ++ci;
+            }
+            if (!found) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Case-folded character-set bitmask for rejecting fuzzy candidates without scanning them.
+     *
+     * Letters and digits get one bit each, other bytes share the remaining bits. If
+     * (char_mask(query) & ~char_mask(candidate)) != 0, fuzzy_match(query, candidate) is false.
+     */
+    [[nodiscard]] constexpr std::uint64_t char_mask(const std::string_view text) noexcept {
+        std::uint64_t m = 0;
+        for (const char ch: text) {
+            const auto c = static_cast<unsigned char>(ch >= 'A' && ch <= 'Z' ? ch + ('a' - 'A') : ch);
+            if (c >= 'a' && c <= 'z') m |= std::uint64_t{1} << (c - 'a');
+            else if (c >= '0' && c <= '9') m |= std::uint64_t{1} << (26 + c - '0');
+            else m |= std::uint64_t{1} << (36 + c % 28);
+        }
+        return m;
+    }
+
     /**
      * @brief Search bar widget with InputText, clear button, and case-insensitive matching.
      * @tparam BufferSize Size of the internal character buffer.
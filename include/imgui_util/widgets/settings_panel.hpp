@@ -1,9 +1,18 @@
 /// @file settings_panel.hpp
-/// @brief Tree-navigated settings panel.
+/// @brief Tree-navigated, searchable settings panel.
 ///
-/// Left pane shows a navigable tree of sections. Right pane renders the
+/// Left pane shows a search box above a navigable tree of sections. Right pane renders the
 /// selected section's content. Remembers selection across frames.
 ///
+/// The section tree is linked when section() is called and flattened into visible rows only
+/// when it changes (registration, expand/collapse); rows are drawn through ImGuiListClipper,
+/// so a frame costs the same with 10 sections or 1,000. Re-registering a name replaces its
+/// callback, which makes calling section() every frame cheap.
+///
+/// The search box matches section names and setting labels registered with setting(). A
+/// setting result selects its section and, if the section calls anchor() after drawing that
+/// setting's widget, scrolls the widget into view and flashes a highlight around it.
+///
 /// Usage:
 /// @code
 ///   static imgui_util::settings_panel panel;
@@ -12,16 +21,22 @@
 ///   })
 ///   .section("Appearance", [] {
 ///       ImGui::ColorEdit3("Accent", &color.x);
+///       panel.anchor("Accent");
 ///   })
+///   .setting("Accent")
 ///   .section("Fonts", "Appearance", [] {
 ///       ImGui::Text("Font settings under Appearance...");
 ///   });
-///   panel.render("##settings", &open);
+///   panel.render("##settings");
 /// @endcode
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <imgui.h>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -29,6 +44,7 @@
 #include <vector>
 
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/widgets/search_bar.hpp"
 
 namespace imgui_util {
 
@@ -39,19 +55,28 @@ namespace imgui_util {
      */
     class settings_panel {
     public:
+        /// @brief One search hit: a section name or a registered setting label.
+        struct search_result {
+            std::string_view text;       ///< Matched section name or setting label.
+            std::string_view section;    ///< Section the hit belongs to (== text for section hits).
+            bool             is_setting; ///< True for a setting label, false for a section name.
+            int              score;      ///< search::fuzzy_match score; results are sorted by it.
+        };
+
         /**
-         * @brief Add a top-level section.
+         * @brief Add a top-level section, or replace the callback of an existing one.
          * @param name      Section display name (must be unique).
          * @param render_fn Callback that renders the section content.
          * @return Reference to this panel for chaining.
          */
         [[nodiscard]] settings_panel &section(const std::string_view name, std::move_only_function<void()> render_fn) {
-            sections_.push_back({.name = std::string(name), .parent = {}, .render_fn = std::move(render_fn)});
-            return *this;
+            return section(name, {}, std::move(render_fn));
         }
 
         /**
-         * @brief Add a section nested under an existing parent.
+         * @brief Add a section nested under a parent, or replace an existing one's callback and parent.
+         *
+         * The parent does not need to be registered yet; the section appears once it is.
          * @param name      Section display name (must be unique).
          * @param parent    Name of the parent section.
          * @param render_fn Callback that renders the section content.
@@ -59,13 +84,133 @@ namespace imgui_util {
          */
         [[nodiscard]] settings_panel &section(const std::string_view name, const std::string_view parent,
                                               std::move_only_function<void()> render_fn) {
-            sections_.push_back(
-                {.name = std::string(name), .parent = std::string(parent), .render_fn = std::move(render_fn)});
+            if (const auto it = by_name_.find(name); it != by_name_.end()) {
+                last_ = it->second;
+                sections_[static_cast<std::size_t>(last_)].render_fn = std::move(render_fn);
+                if (sections_[static_cast<std::size_t>(last_)].parent != parent) reparent(last_, parent);
+                return *this;
+            }
+
+            last_ = static_cast<int>(sections_.size());
+            sections_.push_back({.name      = std::string(name),
+                                 .parent    = {},
+                                 .render_fn = std::move(render_fn),
+                                 .children  = {},
+                                 .settings  = {}});
+            by_name_.emplace(sections_.back().name, last_);
+            add_search_entry(sections_.back().name, last_, false);
+
+            // Adopt children registered before this section
+            if (const auto it = orphans_.find(name); it != orphans_.end()) {
+                sections_[static_cast<std::size_t>(last_)].children = std::move(it->second);
+                orphans_.erase(it);
+            }
+            link(last_, parent);
             return *this;
         }
 
         /**
-         * @brief Render the settings panel (tree navigation + content area).
+         * @brief Register a searchable setting label under the section added or updated last.
+         *
+         * Registering the same label again is a no-op.
+         * @return Reference to this panel for chaining.
+         */
+        [[nodiscard]] settings_panel &setting(const std::string_view label) {
+            if (last_ < 0 || label.empty()) return *this;
+            auto &labels = sections_[static_cast<std::size_t>(last_)].settings;
+            if (std::ranges::any_of(labels, [&](const std::size_t e) { return index_[e].text == label; }))
+                return *this;
+            labels.push_back(index_.size());
+            add_search_entry(label, last_, true);
+            return *this;
+        }
+
+        /**
+         * @brief Mark the widget just submitted as the setting @p label.
+         *
+         * Call from a section callback right after the setting's widget. If a search result
+         * jumped to this label, the widget is scrolled into view and outlined briefly.
+         * Costs one comparison otherwise.
+         */
+        void anchor(const std::string_view label) noexcept {
+            if (jump_label_.empty() || label != jump_label_) return;
+            const float t = static_cast<float>(ImGui::GetTime() - jump_time_) / highlight_seconds;
+            if (t >= 1.0f) {
+                jump_label_.clear();
+                return;
+            }
+            if (jump_scroll_) {
+                ImGui::SetScrollHereY(0.5f);
+                jump_scroll_ = false;
+            }
+            const auto  &style = ImGui::GetStyle();
+            const ImVec2 pad{style.FramePadding.x, style.ItemSpacing.y * 0.5f};
+            const ImVec2 min = ImGui::GetItemRectMin();
+            const ImVec2 max = ImGui::GetItemRectMax();
+            ImGui::GetWindowDrawList()->AddRect({min.x - pad.x, min.y - pad.y}, {max.x + pad.x, max.y + pad.y},
+                                                ImGui::GetColorU32(ImGuiCol_DragDropTarget, 1.0f - t),
+                                                style.FrameRounding, 0, 2.0f);
+        }
+
+        /**
+         * @brief Select @p section and, if @p label is given, highlight its anchor() as a search result would.
+         * @return False if no section has that name.
+         */
+        bool jump_to(const std::string_view section, const std::string_view label = {}) {
+            const auto it = by_name_.find(section);
+            if (it == by_name_.end()) return false;
+            select(it->second);
+            jump_label_.assign(label);
+            jump_time_   = ImGui::GetTime();
+            jump_scroll_ = !label.empty();
+            return true;
+        }
+
+        /// @brief Indices of @p name's child sections in registration order ("" = top-level sections).
+        [[nodiscard]] std::span<const int> children(const std::string_view name) const noexcept {
+            if (name.empty()) return roots_;
+            const auto it = by_name_.find(name);
+            if (it == by_name_.end()) return {};
+            return sections_[static_cast<std::size_t>(it->second)].children;
+        }
+
+        [[nodiscard]] std::string_view name(const int idx) const noexcept {
+            return idx >= 0 && std::cmp_less(idx, sections_.size())
+                       ? std::string_view{sections_[static_cast<std::size_t>(idx)].name}
+                       : std::string_view{};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return sections_.size(); }
+
+        /**
+         * @brief Sections and settings matching @p query, best first.
+         *
+         * Results are recomputed only when the query or the index changes; the returned span
+         * is valid until the next call or registration.
+         */
+        [[nodiscard]] std::span<const search_result> search(const std::string_view query) {
+            if (results_valid_ && query == results_query_) return results_;
+            results_query_.assign(query);
+            results_valid_ = true;
+            results_.clear();
+            if (query.empty()) return results_;
+
+            const std::uint64_t qmask = search::char_mask(query);
+            for (const search_entry &e: index_) {
+                if ((qmask & ~e.mask) != 0) continue;
+                if (int score = 0; search::fuzzy_match(query, e.text, score)) {
+                    results_.push_back({.text       = e.text,
+                                        .section    = sections_[static_cast<std::size_t>(e.section)].name,
+                                        .is_setting = e.is_setting,
+                                        .score      = score});
+                }
+            }
+            std::ranges::stable_sort(results_, std::ranges::greater{}, &search_result::score);
+            return results_;
+        }
+
+        /**
+         * @brief Render the settings panel (search box, tree navigation and content area).
          * @param str_id ImGui ID string for the panel scope.
          */
         void render(const char *str_id) noexcept {
@@ -74,8 +219,9 @@ namespace imgui_util {
             if (sections_.empty()) return;
 
             if (selected_idx_ < 0 || static_cast<std::size_t>(selected_idx_) >= sections_.size()) {
-                selected_idx_ = 0;
+                selected_idx_ = roots_.empty() ? 0 : roots_.front();
             }
+            if (!jump_label_.empty() && ImGui::GetTime() - jump_time_ >= highlight_seconds) jump_label_.clear();
 
             const auto      avail      = ImGui::GetContentRegionAvail();
             constexpr float left_ratio = 0.3f;
@@ -83,14 +229,28 @@ namespace imgui_util {
             const auto      right_w    = avail.x - left_w - 8.0f; // 8px gap
 
             {
-                const child left_child{"##settings_nav", ImVec2(left_w, 0), ImGuiChildFlags_Borders};
-                render_tree();
+                const group left;
+                const auto &style   = ImGui::GetStyle();
+                const float clear_w = ImGui::CalcTextSize("x").x + style.FramePadding.x * 2.0f + style.ItemSpacing.x;
+                (void)search_.render("Search settings...", search_.empty() ? left_w : left_w - clear_w,
+                                     "##settings_search");
+
+                const child left_child{"##settings_nav"_id, ImVec2(left_w, 0), ImGuiChildFlags_Borders};
+                if (search_.empty()) {
+                    render_tree();
+                } else {
+                    render_results();
+                }
             }
 
             ImGui::SameLine();
 
             {
-                const child right_child{"##settings_content", ImVec2(right_w, 0), ImGuiChildFlags_Borders};
+                const child right_child{"##settings_content"_id, ImVec2(right_w, 0), ImGuiChildFlags_Borders};
+                if (reset_scroll_) {
+                    ImGui::SetScrollY(0.0f);
+                    reset_scroll_ = false;
+                }
                 if (auto &sec = sections_[static_cast<std::size_t>(selected_idx_)]; sec.render_fn) {
                     ImGui::TextUnformatted(sec.name.c_str(), sec.name.c_str() + sec.name.size());
                     ImGui::Separator();
@@ -101,48 +261,168 @@ namespace imgui_util {
         }
 
     private:
+        static constexpr float highlight_seconds = 1.5f;
+
         struct section_entry {
             std::string                     name;
             std::string                     parent;
             std::move_only_function<void()> render_fn;
+            std::vector<int>                children;
+            std::vector<std::size_t>        settings; // index_ entries of this section's setting labels
+            bool                            open = true;
         };
 
-        std::vector<section_entry> sections_;
-        int                        selected_idx_ = -1;
+        struct search_entry {
+            std::string   text;
+            std::uint64_t mask;
+            int           section;
+            bool          is_setting;
+        };
 
-        void render_tree() noexcept {
-            std::unordered_map<std::string_view, std::vector<int>> children_of;
-            for (int i = 0; std::cmp_less(i, sections_.size()); ++i) {
-                children_of[sections_[static_cast<std::size_t>(i)].parent].push_back(i);
+        /// @brief Visible tree row: section index and nesting depth.
+        struct tree_row {
+            int idx;
+            int depth;
+        };
+
+        struct name_hash {
+            using is_transparent = void;
+            std::size_t operator()(const std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+        };
+
+        template<typename V>
+        using name_map = std::unordered_map<std::string, V, name_hash, std::equal_to<>>;
+
+        std::vector<section_entry>    sections_;
+        name_map<int>                 by_name_;
+        name_map<std::vector<int>>    orphans_; // parent name -> sections waiting for it
+        std::vector<int>              roots_;
+        std::vector<tree_row>         rows_; // flattened open tree, rebuilt when rows_dirty_
+        std::vector<search_entry>     index_;
+        std::vector<search_result>    results_;
+        std::string                   results_query_;
+        std::string                   jump_label_;
+        search::search_bar<128>       search_;
+        double                        jump_time_     = 0.0;
+        int                           selected_idx_  = -1;
+        int                           last_          = -1; // target of setting()
+        bool                          rows_dirty_    = true;
+        bool                          results_valid_ = false;
+        bool                          jump_scroll_   = false;
+        bool                          reset_scroll_  = false;
+
+        void add_search_entry(const std::string_view text, const int section, const bool is_setting) {
+            index_.push_back({.text       = std::string(text),
+                              .mask       = search::char_mask(text),
+                              .section    = section,
+                              .is_setting = is_setting});
+            results_valid_ = false;
+        }
+
+        void link(const int idx, const std::string_view parent) {
+            auto &sec = sections_[static_cast<std::size_t>(idx)];
+            sec.parent.assign(parent);
+            if (parent.empty()) {
+                roots_.push_back(idx);
+            } else if (const auto it = by_name_.find(parent); it != by_name_.end()) {
+                sections_[static_cast<std::size_t>(it->second)].children.push_back(idx);
+            } else if (const auto ot = orphans_.find(parent); ot != orphans_.end()) {
+                ot->second.push_back(idx);
+            } else {
+                orphans_.emplace(std::string(parent), std::vector{idx});
+            }
+            rows_dirty_ = true;
+        }
+
+        void reparent(const int idx, const std::string_view parent) {
+            const std::string_view old = sections_[static_cast<std::size_t>(idx)].parent;
+            if (old.empty()) {
+                std::erase(roots_, idx);
+            } else if (const auto it = by_name_.find(old); it != by_name_.end()) {
+                std::erase(sections_[static_cast<std::size_t>(it->second)].children, idx);
+            } else if (const auto ot = orphans_.find(old); ot != orphans_.end()) {
+                std::erase(ot->second, idx);
+                if (ot->second.empty()) orphans_.erase(ot);
             }
+            link(idx, parent);
+        }
 
-            for (const int i: children_of[""]) {
-                render_tree_node(sections_[static_cast<std::size_t>(i)], i, children_of);
+        void select(const int idx) {
+            if (idx != selected_idx_) reset_scroll_ = true;
+            selected_idx_ = idx;
+            jump_label_.clear();
+        }
+
+        // Depth-first walk over open sections; sections in a parent cycle are unreachable and skipped.
+        void rebuild_rows() {
+            rows_.clear();
+            std::vector<tree_row> stack;
+            for (const int r: roots_ | std::views::reverse) stack.push_back({r, 0});
+            while (!stack.empty()) {
+                const tree_row row = stack.back();
+                stack.pop_back();
+                rows_.push_back(row);
+                if (const auto &sec = sections_[static_cast<std::size_t>(row.idx)]; sec.open) {
+                    for (const int c: sec.children | std::views::reverse) stack.push_back({c, row.depth + 1});
+                }
             }
+            rows_dirty_ = false;
         }
 
-        void render_tree_node(const section_entry &entry, const int idx, // NOLINT(misc-no-recursion)
-                              const std::unordered_map<std::string_view, std::vector<int>> &children_of) noexcept {
-            if (const auto it = children_of.find(entry.name); it != children_of.end() && !it->second.empty()) {
-                constexpr ImGuiTreeNodeFlags base_flags =
-                    ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_DefaultOpen;
-                const ImGuiTreeNodeFlags flags = base_flags | (selected_idx_ == idx ? ImGuiTreeNodeFlags_Selected : 0);
+        void render_tree() noexcept {
+            if (rows_dirty_) rebuild_rows();
+            const float indent = ImGui::GetStyle().IndentSpacing;
 
-                if (const tree_node tn{entry.name.c_str(), flags}) {
-                    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
-                        selected_idx_ = idx;
-                    }
-                    for (const int ci: it->second) {
-                        render_tree_node(sections_[static_cast<std::size_t>(ci)], ci, children_of);
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(rows_.size()));
+            while (clipper.Step()) {
+                for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r) {
+                    const auto [idx, depth] = rows_[static_cast<std::size_t>(r)];
+                    auto      &sec          = sections_[static_cast<std::size_t>(idx)];
+
+                    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanAvailWidth |
+                                               (selected_idx_ == idx ? ImGuiTreeNodeFlags_Selected : 0);
+                    if (sec.children.empty()) {
+                        flags |= ImGuiTreeNodeFlags_Leaf;
+                    } else {
+                        flags |= ImGuiTreeNodeFlags_OpenOnArrow;
+                        ImGui::SetNextItemOpen(sec.open);
                     }
-                } else {
-                    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
-                        selected_idx_ = idx;
+
+                    ImGui::SetCursorPosX(ImGui::GetCursorPosX() + static_cast<float>(depth) * indent);
+                    const bool open = ImGui::TreeNodeEx(reinterpret_cast<const void *>(static_cast<std::intptr_t>(idx)),
+                                                        flags, "%s", sec.name.c_str());
+                    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) select(idx);
+                    if (!sec.children.empty() && open != sec.open) {
+                        sec.open    = open;
+                        rows_dirty_ = true;
                     }
                 }
-            } else {
-                if (ImGui::Selectable(entry.name.c_str(), selected_idx_ == idx)) {
-                    selected_idx_ = idx;
+            }
+        }
+
+        void render_results() noexcept {
+            const auto results = search(search_.query());
+            if (results.empty()) {
+                ImGui::TextDisabled("No matching settings");
+                return;
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(results.size()));
+            while (clipper.Step()) {
+                for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r) {
+                    const search_result &res = results[static_cast<std::size_t>(r)];
+                    const id             row{r};
+                    if (ImGui::Selectable("##result")) {
+                        (void)jump_to(res.section, res.is_setting ? res.text : std::string_view{});
+                    }
+                    ImGui::SameLine(0.0f, 0.0f);
+                    ImGui::TextUnformatted(res.text.data(), res.text.data() + res.text.size());
+                    if (res.is_setting) {
+                        ImGui::SameLine();
+                        ImGui::TextDisabled("%.*s", static_cast<int>(res.section.size()), res.section.data());
+                    }
                 }
             }
         }
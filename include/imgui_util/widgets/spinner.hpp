@@ -1,7 +1,11 @@
 /// @file spinner.hpp
-/// @brief Spinning arc indicator and overlay variant.
+/// @brief Spinning arc indicator, batched spinners and overlay variant.
 ///
-/// Uses ImDrawList PathArcTo + PathStroke for arc rendering.
+/// The spinning arc is tessellated once per (radius, thickness, segment count, AA mode) into a
+/// vertex/index template; each spinner then only rotates and translates the template's
+/// vertices into the draw list, instead of running PathArcTo + PathStroke. spinner_batch goes
+/// further for lists of busy rows: it queues every visible spinner of a scope and writes them
+/// all through a single vertex reservation in one draw command.
 /// Spins continuously using ImGui's time.
 ///
 /// Usage:
@@ -9,15 +13,26 @@
 ///   imgui_util::spinner("loading");                             // default size/color
 ///   imgui_util::spinner("sync", 12.0f, 3.0f, colors::teal);    // custom size/color
 ///
+///   // One spinner per running job, drawn together when the batch goes out of scope:
+///   {
+///       imgui_util::spinner_batch busy;
+///       for (auto &job : jobs) { if (job.running) busy.add(); ImGui::SameLine(); ImGui::Text(...); }
+///   }
+///
 ///   // Full-area overlay with spinner and optional message:
 ///   imgui_util::spinner_overlay("Loading data...");
 /// @endcode
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <deque>
 #include <imgui.h>
 #include <numbers>
 #include <string_view>
+#include <vector>
 
 #include "imgui_util/widgets/text.hpp"
 
@@ -27,6 +42,117 @@ namespace imgui_util {
 
         constexpr float spinner_pi       = std::numbers::pi_v<float>;
         constexpr int   spinner_segments = 24;
+        constexpr float spinner_sweep    = spinner_pi * 1.2f; // ~216 degree arc
+
+        /**
+         * @brief Stroke of the spinner arc from angle 0 to spinner_sweep, tessellated like PathStroke.
+         *
+         * Offsets are relative to the arc center; an instance rotates them by its start angle.
+         * Anti-aliased strokes use four vertices per point (fringe, edge, edge, fringe) with
+         * transparent fringes, plain strokes two.
+         */
+        struct spinner_mesh {
+            float                  radius       = 0.0f;
+            float                  thickness    = 0.0f;
+            float                  fringe       = 0.0f;
+            int                    segments     = 0;
+            bool                   anti_aliased = false;
+            std::vector<ImVec2>    offsets      = {}; // per vertex, relative to the center
+            std::vector<ImDrawIdx> indices      = {}; // relative to the instance's first vertex
+
+            [[nodiscard]] int  vtx_count() const noexcept { return static_cast<int>(offsets.size()); }
+            [[nodiscard]] int  idx_count() const noexcept { return static_cast<int>(indices.size()); }
+            [[nodiscard]] int  ring_count() const noexcept { return anti_aliased ? 4 : 2; }
+            [[nodiscard]] bool opaque(const std::size_t v) const noexcept {
+                const std::size_t ring = v % static_cast<std::size_t>(ring_count());
+                return !anti_aliased || ring == 1 || ring == 2;
+            }
+
+            [[nodiscard]] bool matches(const float r, const float t, const int segs, const bool aa,
+                                       const float f) const noexcept {
+                return radius == r && thickness == t && segments == segs && anti_aliased == aa && fringe == f;
+            }
+
+            [[nodiscard]] static spinner_mesh build(const float r, const float t, const int segs, const bool aa,
+                                                    const float f) {
+                spinner_mesh m{.radius = r, .thickness = t, .fringe = f, .segments = segs, .anti_aliased = aa};
+                const int   points = segs + 1;
+                const int   rings  = m.ring_count();
+                const float step   = spinner_sweep / static_cast<float>(segs);
+
+                // Signed distances from the center line, outermost first (PathStroke's layout)
+                const float                half  = aa ? std::max(0.0f, (t - f) * 0.5f) : t * 0.5f;
+                const float                outer = half + f;
+                const std::array<float, 4> ring_offsets =
+                    aa ? std::array{outer, half, -half, -outer} : std::array{half, -half, 0.0f, 0.0f};
+
+                m.offsets.reserve(static_cast<std::size_t>(points * rings));
+                for (int i = 0; i < points; ++i) {
+                    const float  a = static_cast<float>(i) * step;
+                    const ImVec2 p{std::cos(a) * r, std::sin(a) * r};
+                    // Joints use the averaged (mitered) segment normal; end points the end segment's normal.
+                    float na = a, scale = 1.0f / std::cos(step * 0.5f);
+                    if (i == 0 || i == segs) {
+                        na    = i == 0 ? a + step * 0.5f : a - step * 0.5f;
+                        scale = 1.0f;
+                    }
+                    const ImVec2 n{std::cos(na) * scale, std::sin(na) * scale};
+                    for (int k = 0; k < rings; ++k) {
+                        const float d = ring_offsets[static_cast<std::size_t>(k)];
+                        m.offsets.push_back({p.x + n.x * d, p.y + n.y * d});
+                    }
+                }
+
+                m.indices.reserve(static_cast<std::size_t>(segs * (aa ? 18 : 6)));
+                const auto quad = [&m](const int a0, const int a1, const int b0, const int b1) {
+                    for (const int v: {b1, a1, a0, a0, b0, b1}) m.indices.push_back(static_cast<ImDrawIdx>(v));
+                };
+                for (int i = 0; i < segs; ++i) {
+                    const int i1 = i * rings;
+                    const int i2 = i1 + rings;
+                    for (int k = 0; k + 1 < rings; ++k) quad(i1 + k, i1 + k + 1, i2 + k, i2 + k + 1);
+                }
+                return m;
+            }
+        };
+
+        /**
+         * @brief Cached template for the given stroke in @p dl's AA mode; built on first use.
+         *
+         * The cache keeps the 32 most recently built strokes; a returned reference stays valid
+         * until 31 other strokes have been built after it.
+         */
+        [[nodiscard]] inline const spinner_mesh &spinner_mesh_for(const ImDrawList *dl, const float radius,
+                                                                  const float thickness,
+                                                                  const int   segments = spinner_segments) {
+            static std::deque<spinner_mesh> cache; // growth never moves existing entries
+            const bool  aa     = (dl->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+            const float fringe = dl->_FringeScale;
+            for (const spinner_mesh &m: cache)
+                if (m.matches(radius, thickness, segments, aa, fringe)) return m;
+            if (cache.size() >= 32) cache.pop_front(); // sizes are few; bound pathological callers
+            return cache.emplace_back(spinner_mesh::build(radius, thickness, segments, aa, fringe));
+        }
+
+        /// @brief (cos, sin) of this frame's spinner start angle.
+        [[nodiscard]] inline ImVec2 spinner_rotation() noexcept {
+            const float start = std::fmod(static_cast<float>(ImGui::GetTime()) * 5.0f, spinner_pi * 2.0f);
+            return {std::cos(start), std::sin(start)};
+        }
+
+        /// @brief Write one instance into space already reserved with PrimReserve().
+        inline void write_spinner(ImDrawList *dl, const spinner_mesh &m, const ImVec2 center, const ImVec2 rot,
+                                  const ImU32 col) noexcept {
+            const auto   base   = static_cast<ImDrawIdx>(dl->_VtxCurrentIdx);
+            const ImU32  clear  = col & ~IM_COL32_A_MASK;
+            const ImVec2 uv     = ImGui::GetFontTexUvWhitePixel();
+            for (const ImDrawIdx i: m.indices) dl->PrimWriteIdx(static_cast<ImDrawIdx>(base + i));
+            for (std::size_t v = 0; v < m.offsets.size(); ++v) {
+                const ImVec2 o = m.offsets[v];
+                dl->PrimWriteVtx({center.x + o.x * rot.x - o.y * rot.y, center.y + o.x * rot.y + o.y * rot.x}, uv,
+                                 m.opaque(v) ? col : clear);
+            }
+        }
 
         // Resolve transparent-alpha sentinel to theme's ButtonActive color
         [[nodiscard]] inline ImVec4 resolve_spinner_color(const ImVec4 &color) noexcept {
@@ -68,16 +194,114 @@ namespace imgui_util {
     inline void spinner(const char *label, const float radius = 8.0f, const float thickness = 2.0f,
                         const ImVec4 &color = {}) noexcept {
         const auto [dl, center, col] = detail::spinner_begin(label, radius, color);
-        const ImU32 col32 = ImGui::ColorConvertFloat4ToU32(col);
-
-        const float start = std::fmod(static_cast<float>(ImGui::GetTime()) * 5.0f, detail::spinner_pi * 2.0f);
-        const float end   = start + detail::spinner_pi * 1.2f; // ~216 degree arc
+        if (!ImGui::IsItemVisible()) return;
 
-        dl->PathClear();
-        dl->PathArcTo(center, radius, start, end, detail::spinner_segments);
-        dl->PathStroke(col32, 0, thickness);
+        const detail::spinner_mesh &mesh = detail::spinner_mesh_for(dl, radius, thickness);
+        dl->PrimReserve(mesh.idx_count(), mesh.vtx_count());
+        detail::write_spinner(dl, mesh, center, detail::spinner_rotation(), ImGui::ColorConvertFloat4ToU32(col));
     }
 
+    /**
+     * @brief Queues spinners and draws them together through one vertex reservation.
+     *
+     * add() lays out a spinner-sized item at the cursor like spinner() and records it, with the
+     * current clip rect, if visible. flush() (or the destructor) writes the queued spinners
+     * through one PrimReserve per run of spinners added under the same clip rect, so a batch
+     * filled inside a single clip scope is one draw command and one block of the vertex buffer,
+     * and one spanning table cells or child clip regions is still clipped like spinner().
+     * Flush into the draw list (and draw list channel) the spinners were added in, or pass a
+     * foreground list to draw them unclipped by their window as an overlay. All spinners of a
+     * batch share radius and thickness.
+     */
+    class spinner_batch {
+    public:
+        /**
+         * @param radius    Radius of the arcs in pixels.
+         * @param thickness Stroke thickness in pixels.
+         * @param color     Default arc color ({0,0,0,0} = theme default).
+         */
+        explicit spinner_batch(const float radius = 8.0f, const float thickness = 2.0f,
+                               const ImVec4 &color = {}) noexcept :
+            radius_(radius), thickness_(thickness),
+            col_(ImGui::ColorConvertFloat4ToU32(detail::resolve_spinner_color(color))) {}
+
+        spinner_batch(const spinner_batch &)            = delete;
+        spinner_batch &operator=(const spinner_batch &) = delete;
+
+        ~spinner_batch() { flush(); }
+
+        /// @brief Reserve a spinner item at the cursor and queue it in the batch color.
+        void add() { add(col_); }
+
+        /// @brief Reserve a spinner item at the cursor and queue it in @p col.
+        void add(const ImU32 col) {
+            const float  diameter = radius_ * 2.0f;
+            const ImVec2 pos      = ImGui::GetCursorScreenPos();
+            ImGui::Dummy({diameter, diameter});
+            if (!ImGui::IsItemVisible()) return;
+            const ImDrawList *dl = ImGui::GetWindowDrawList();
+            pending_.push_back({.center   = {pos.x + radius_, pos.y + radius_},
+                                .clip_min = dl->GetClipRectMin(),
+                                .clip_max = dl->GetClipRectMax(),
+                                .col      = col});
+        }
+
+        /**
+         * @brief Draw the queued spinners and clear the queue.
+         * @param dl Target draw list (nullptr = current window's, under each spinner's recorded
+         *           clip rect; otherwise @p dl's current clip rect).
+         */
+        void flush(ImDrawList *dl = nullptr) {
+            if (pending_.empty()) return;
+            const bool own_clip = dl == nullptr;
+            if (dl == nullptr) dl = ImGui::GetWindowDrawList();
+            const detail::spinner_mesh &mesh = detail::spinner_mesh_for(dl, radius_, thickness_);
+            const ImVec2                rot  = detail::spinner_rotation();
+
+            // 16-bit indices address at most 64k vertices per draw command
+            const std::size_t per_run =
+                sizeof(ImDrawIdx) == 2 ? std::max<std::size_t>(1, 0xFFFFu / static_cast<std::size_t>(mesh.vtx_count()))
+                                       : pending_.size();
+            for (std::size_t first = 0; first < pending_.size();) {
+                const instance &head = pending_[first];
+                std::size_t     last = first + 1;
+                while (last < pending_.size() && last - first < per_run
+                       && (!own_clip || same_clip(pending_[last], head)))
+                    ++last;
+
+                // Re-pushing the clip rect already current adds no draw command
+                if (own_clip) dl->PushClipRect(head.clip_min, head.clip_max);
+                const auto n = static_cast<int>(last - first);
+                dl->PrimReserve(n * mesh.idx_count(), n * mesh.vtx_count());
+                for (std::size_t i = first; i < last; ++i)
+                    detail::write_spinner(dl, mesh, pending_[i].center, rot, pending_[i].col);
+                if (own_clip) dl->PopClipRect();
+                first = last;
+            }
+            pending_.clear();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return pending_.size(); }
+
+    private:
+        struct instance {
+            ImVec2 center;
+            ImVec2 clip_min; // clip rect current at add()
+            ImVec2 clip_max;
+            ImU32  col;
+        };
+
+        [[nodiscard]] static bool same_clip(const instance &a, const instance &b) noexcept {
+            return a.clip_min.x == b.clip_min.x && a.clip_min.y == b.clip_min.y && a.clip_max.x == b.clip_max.x
+                && a.clip_max.y == b.clip_max.y;
+        }
+
+        std::vector<instance> pending_;
+        float                 radius_;
+        float                 thickness_;
+        ImU32                 col_;
+    };
+
     /**
      * @brief Spinner overlay that fills the available content region with a dimmed background
      *        and centers a spinner with an optional label below it.
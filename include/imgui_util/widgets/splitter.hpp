@@ -109,7 +109,7 @@ namespace imgui_util {
 
         {
             const ImVec2 first_child_size = is_h ? ImVec2(first_size, avail.y) : ImVec2(avail.x, first_size);
-            if (const child first{"##split_first", first_child_size, ImGuiChildFlags_None}) {
+            if (const child first{"##split_first"_id, first_child_size, ImGuiChildFlags_None}) {
                 std::forward<Left>(left)();
             }
         }
@@ -122,7 +122,7 @@ namespace imgui_util {
 
         {
             const ImVec2 second_child_size = is_h ? ImVec2(second_size, avail.y) : ImVec2(avail.x, second_size);
-            if (const child second{"##split_second", second_child_size, ImGuiChildFlags_None}) {
+            if (const child second{"##split_second"_id, second_child_size, ImGuiChildFlags_None}) {
                 std::forward<Right>(right)();
             }
         }
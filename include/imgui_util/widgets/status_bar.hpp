@@ -2,21 +2,25 @@
 /// @brief Bottom-anchored status bar.
 ///
 /// Uses the main viewport to position at the very bottom of the screen.
-/// right_section() moves the cursor to a right-aligned zone.
+/// right_section() moves the cursor to a right-aligned zone; right_text() aligns a label by
+/// its cached width.
 ///
 /// Usage:
 /// @code
 ///   if (const imgui_util::status_bar sb{}) {
 ///       ImGui::Text("Ready");
-///       sb.right_section();
+///       sb.right_section(120.0f);
 ///       ImGui::Text("Line 42, Col 8");
+///       sb.right_text("UTF-8");  // width measured once, then cached
 ///   }
 /// @endcode
 #pragma once
 
 #include <imgui.h>
+#include <string_view>
 
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/core/text_metrics.hpp"
 
 namespace imgui_util {
 
@@ -67,6 +71,17 @@ namespace imgui_util {
             ImGui::SameLine(width_ - padding * 2.0f - offset);
         }
 
+        /**
+         * @brief Draw @p text flush against the right edge, measured through the shared text metrics cache.
+         * @param text    Text to draw.
+         * @param offset  Extra distance from the right edge (for stacking right-aligned sections).
+         */
+        void right_text(const std::string_view text, const float offset = 0.0f) const {
+            const float padding = ImGui::GetStyle().WindowPadding.x;
+            ImGui::SameLine(width_ - padding - offset - calc_text_size(text).x);
+            text_unformatted_cached(text);
+        }
+
     private:
         float  height_;
         float  width_;
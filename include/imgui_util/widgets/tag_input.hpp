@@ -10,153 +10,299 @@
 ///
 ///   // With max tag limit:
 ///   if (imgui_util::tag_input("Labels", tags, 5)) { ... }
+///
+///   // With autocomplete from a shared vocabulary (see tag_vocabulary.hpp):
+///   static const imgui_util::tag_vocabulary vocab{terms};
+///   if (imgui_util::tag_input("Assets", tags, vocab)) { ... }
 /// @endcode
 ///
 /// Renders each tag as a colored pill with an X button. An InputText at the end
 /// allows adding new tags on Enter. Uses ImDrawList for pill rendering.
+/// With a vocabulary, suggestions for the typed text are listed in a clipped popup below
+/// the input: Up/Down select, Tab completes, Enter or a click adds the selected one.
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <imgui.h>
-#include <new>
 #include <imgui_internal.h>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "imgui_util/core/context_state.hpp"
 #include "imgui_util/core/fmt_buf.hpp"
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/core/text_metrics.hpp"
+#include "imgui_util/widgets/tag_vocabulary.hpp"
 #include "imgui_util/widgets/text.hpp"
 
 namespace imgui_util {
 
-    /**
-     * @brief Tag/chip input widget with pill rendering and inline editing.
-     *
-     * Renders each tag as a colored pill with an X button for removal.
-     * An InputText at the end allows adding new tags on Enter.
-     * @param label    Widget label (used as ImGui ID scope).
-     * @param tags     Vector of tag strings (in/out).
-     * @param max_tags Maximum number of tags allowed (0 = unlimited).
-     * @return True if the tag list changed this frame (added or removed).
-     */
-    [[nodiscard]] inline bool tag_input(const char *label, std::vector<std::string> &tags, const std::size_t max_tags = 0) {
-        if (const auto *const win = ImGui::GetCurrentWindow(); win->SkipItems) return false;
+    namespace detail {
 
-        const id scope{label};
+        // Per-instance input buffer and suggestion state.
+        struct tag_input_state {
+            std::array<char, 128>       buf{};
+            std::string                 query; // buf contents the suggestions belong to
+            std::vector<tag_suggestion> suggestions;
+            int                         selected           = -1;
+            bool                        stale              = true;
+            bool                        scroll_to_selected = false;
+            bool                        popup_hovered      = false;
+            bool                        refocus            = false;
+        };
 
-        const auto &style = ImGui::GetStyle();
-        auto *const dl    = ImGui::GetWindowDrawList();
+        // States of every tag_input in a context by input ID; freed when the context shuts down.
+        using tag_input_states = std::unordered_map<ImGuiID, tag_input_state>;
 
-        const float     line_height      = ImGui::GetFrameHeight();
-        const float     pill_height      = line_height - 2.0f;
-        const float     pill_rounding    = pill_height * 0.5f;
-        constexpr float pill_pad_x       = 6.0f;
-        const float     cached_x_glyph_w = ImGui::CalcTextSize("x").x;
-        const float     x_btn_width      = cached_x_glyph_w + pill_pad_x;
-
-        const auto  region     = ImGui::GetContentRegionAvail();
-        const float wrap_width = region.x > 0.0f ? region.x : 200.0f;
+        inline tag_input_states &tag_input_states_of(ImGuiContext &ctx) {
+            static context_state<tag_input_states> states;
+            return states.get(ctx);
+        }
 
-        bool changed = false;
+        // Up/Down move the suggestion selection, Tab completes the input to it.
+        inline int tag_input_callback(ImGuiInputTextCallbackData *data) noexcept {
+            auto     &st = *static_cast<tag_input_state *>(data->UserData);
+            const int n  = static_cast<int>(st.suggestions.size());
+            if (n == 0) return 0;
+            if (data->EventFlag == ImGuiInputTextFlags_CallbackHistory) {
+                if (data->EventKey == ImGuiKey_DownArrow) st.selected = st.selected + 1 < n ? st.selected + 1 : 0;
+                if (data->EventKey == ImGuiKey_UpArrow) st.selected = st.selected > 0 ? st.selected - 1 : n - 1;
+                st.scroll_to_selected = true;
+            } else if (data->EventFlag == ImGuiInputTextFlags_CallbackCompletion) {
+                const std::string_view text = st.suggestions[static_cast<std::size_t>(std::max(st.selected, 0))].text;
+                data->DeleteChars(0, data->BufTextLen);
+                data->InsertChars(0, text.data(), text.data() + text.size());
+            }
+            return 0;
+        }
 
-        const auto origin   = ImGui::GetCursorScreenPos();
-        float      cursor_x = 0.0f;
-        float      cursor_y = 0.0f;
+        /// @brief Suggestion list below the input rect; returns the clicked suggestion index or -1.
+        inline int render_tag_suggestions(tag_input_state &st, const ImGuiID owner, const ImVec2 &input_min,
+                                          const ImVec2 &input_max, const int visible_rows) {
+            constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove
+                | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav
+                | ImGuiWindowFlags_NoDocking;
 
-        int remove_idx = -1;
+            const int   count = static_cast<int>(st.suggestions.size());
+            const float row_h = ImGui::GetTextLineHeightWithSpacing();
+            const float pad_y = ImGui::GetStyle().WindowPadding.y;
+            ImGui::SetNextWindowPos({input_min.x, input_max.y});
+            ImGui::SetNextWindowSize(
+                {input_max.x - input_min.x, static_cast<float>(std::min(count, visible_rows)) * row_h + pad_y * 2.0f});
 
-        for (int i = 0; std::cmp_less(i, tags.size()); ++i) {
-            const auto &tag        = tags[i];
-            const auto  text_size  = ImGui::CalcTextSize(tag.c_str());
-            const float pill_width = text_size.x + x_btn_width + pill_pad_x * 3.0f;
+            int               clicked = -1;
+            const fmt_buf<32> name{"##tag_suggest_{:08X}", owner};
+            if (const window w{name.c_str(), nullptr, flags}) {
+                ImGui::BringWindowToDisplayFront(ImGui::GetCurrentWindow());
+                st.popup_hovered = ImGui::IsWindowHovered();
 
-            if (cursor_x + pill_width > wrap_width && cursor_x > 0.0f) {
-                cursor_x = 0.0f;
-                cursor_y += line_height + style.ItemSpacing.y;
+                // Only visible rows are submitted, so long suggestion lists cost nothing extra
+                ImGuiListClipper clipper;
+                clipper.Begin(count, row_h);
+                if (st.selected >= 0) clipper.IncludeItemByIndex(st.selected);
+                while (clipper.Step()) {
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                        const tag_suggestion &s = st.suggestions[static_cast<std::size_t>(i)];
+                        const id              row{i};
+                        if (ImGui::Selectable("##s", i == st.selected)) clicked = i;
+                        const ImVec4 color = s.fuzzy ? colors::text_secondary : ImGui::GetStyleColorVec4(ImGuiCol_Text);
+                        ImGui::GetWindowDrawList()->AddText(ImGui::GetItemRectMin(),
+                                                            ImGui::ColorConvertFloat4ToU32(color), s.text.data(),
+                                                            s.text.data() + s.text.size());
+                        if (i == st.selected && st.scroll_to_selected) {
+                            ImGui::SetScrollHereY();
+                            st.scroll_to_selected = false;
+                        }
+                    }
+                }
+            } else {
+                st.popup_hovered = false;
             }
+            return clicked;
+        }
 
-            const ImVec2 pill_min{origin.x + cursor_x, origin.y + cursor_y + 1.0f};
-            const ImVec2 pill_max{pill_min.x + pill_width, pill_min.y + pill_height};
+        inline bool tag_input_impl(const char *label, std::vector<std::string> &tags, const std::size_t max_tags,
+                                   const tag_vocabulary *vocab, const std::size_t max_suggestions) {
+            if (const auto *const win = ImGui::GetCurrentWindow(); win->SkipItems) return false;
 
-            dl->AddRectFilled(pill_min, pill_max, ImGui::GetColorU32(ImGuiCol_FrameBg), pill_rounding);
+            const id scope{label};
 
-            const float text_y = pill_min.y + (pill_height - text_size.y) * 0.5f;
-            dl->AddText({pill_min.x + pill_pad_x, text_y}, ImGui::GetColorU32(ImGuiCol_Text), tag.c_str());
+            const auto &style = ImGui::GetStyle();
+            auto *const dl    = ImGui::GetWindowDrawList();
 
-            const float  x_start = pill_max.x - x_btn_width - pill_pad_x;
-            const ImVec2 x_min{x_start, pill_min.y};
-            const ImVec2 x_max{pill_max.x, pill_max.y};
+            const float     line_height      = ImGui::GetFrameHeight();
+            const float     pill_height      = line_height - 2.0f;
+            const float     pill_rounding    = pill_height * 0.5f;
+            constexpr float pill_pad_x       = 6.0f;
+            const float     cached_x_glyph_w = calc_text_size("x").x;
+            const float     x_btn_width      = cached_x_glyph_w + pill_pad_x;
 
-            const fmt_buf<32> x_id{"##tag_x_{}", i};
-            ImGui::SetCursorScreenPos(x_min);
-            if (ImGui::InvisibleButton(x_id.c_str(), {x_max.x - x_min.x, x_max.y - x_min.y})) {
-                remove_idx = i;
-            }
+            const auto  region     = ImGui::GetContentRegionAvail();
+            const float wrap_width = region.x > 0.0f ? region.x : 200.0f;
 
-            // X glyph (hover turns error-red)
-            const auto  x_color   = ImGui::IsItemHovered() ? colors::error : colors::text_secondary;
-            const float x_glyph_w = cached_x_glyph_w;
-            const float x_text_x  = x_start + (x_btn_width - x_glyph_w) * 0.5f + pill_pad_x * 0.5f;
-            const float x_text_y  = pill_min.y + (pill_height - ImGui::GetTextLineHeight()) * 0.5f;
-            dl->AddText({x_text_x, x_text_y}, ImGui::ColorConvertFloat4ToU32(x_color), "x");
+            bool changed = false;
 
-            cursor_x += pill_width + style.ItemSpacing.x;
-        }
+            const auto origin   = ImGui::GetCursorScreenPos();
+            float      cursor_x = 0.0f;
+            float      cursor_y = 0.0f;
 
-        // Remove tag if X was clicked
-        if (remove_idx >= 0) {
-            tags.erase(tags.begin() + remove_idx);
-            changed = true;
-        }
+            int remove_idx = -1;
+
+            for (int i = 0; std::cmp_less(i, tags.size()); ++i) {
+                const auto &tag        = tags[i];
+                const auto  text_size  = calc_text_size(tag); // cached across frames
+                const float pill_width = text_size.x + x_btn_width + pill_pad_x * 3.0f;
+
+                if (cursor_x + pill_width > wrap_width && cursor_x > 0.0f) {
+                    cursor_x = 0.0f;
+                    cursor_y += line_height + style.ItemSpacing.y;
+                }
+
+                const ImVec2 pill_min{origin.x + cursor_x, origin.y + cursor_y + 1.0f};
+                const ImVec2 pill_max{pill_min.x + pill_width, pill_min.y + pill_height};
+
+                dl->AddRectFilled(pill_min, pill_max, ImGui::GetColorU32(ImGuiCol_FrameBg), pill_rounding);
+
+                const float text_y = pill_min.y + (pill_height - text_size.y) * 0.5f;
+                dl->AddText({pill_min.x + pill_pad_x, text_y}, ImGui::GetColorU32(ImGuiCol_Text), tag.data(),
+                            tag.data() + tag.size());
+
+                const float  x_start = pill_max.x - x_btn_width - pill_pad_x;
+                const ImVec2 x_min{x_start, pill_min.y};
+                const ImVec2 x_max{pill_max.x, pill_max.y};
+
+                const fmt_buf<32> x_id{"##tag_x_{}", i};
+                ImGui::SetCursorScreenPos(x_min);
+                if (ImGui::InvisibleButton(x_id.c_str(), {x_max.x - x_min.x, x_max.y - x_min.y})) {
+                    remove_idx = i;
+                }
 
-        // Input text for new tags
-        if (const bool at_limit = max_tags > 0 && tags.size() >= max_tags; !at_limit) {
-            // Wrap input to next line if not enough space
-            if (constexpr float input_min_w = 80.0f; cursor_x + input_min_w > wrap_width && cursor_x > 0.0f) {
-                cursor_x = 0.0f;
-                cursor_y += line_height + style.ItemSpacing.y;
+                // X glyph (hover turns error-red)
+                const auto  x_color   = ImGui::IsItemHovered() ? colors::error : colors::text_secondary;
+                const float x_glyph_w = cached_x_glyph_w;
+                const float x_text_x  = x_start + (x_btn_width - x_glyph_w) * 0.5f + pill_pad_x * 0.5f;
+                const float x_text_y  = pill_min.y + (pill_height - ImGui::GetTextLineHeight()) * 0.5f;
+                dl->AddText({x_text_x, x_text_y}, ImGui::ColorConvertFloat4ToU32(x_color), "x");
+
+                cursor_x += pill_width + style.ItemSpacing.x;
             }
 
-            const float input_w = wrap_width - cursor_x;
-            ImGui::SetCursorScreenPos({origin.x + cursor_x, origin.y + cursor_y});
-
-            // Per-instance buffer stored in ImGui state storage to support multiple tag_input widgets.
-            const ImGuiID buf_id  = ImGui::GetID("##tag_buf");
-            auto *const   storage = ImGui::GetStateStorage();
-            // Store pointer to heap-allocated buffer in state storage
-            using tag_buf_t = std::array<char, 128>;
-            auto *buf_ptr   = static_cast<tag_buf_t *>(storage->GetVoidPtr(buf_id));
-            if (buf_ptr == nullptr) {
-                buf_ptr = new (std::nothrow) tag_buf_t; // NOLINT(cppcoreguidelines-owning-memory)
-                if (buf_ptr == nullptr) return false;
-                (*buf_ptr)[0] = '\0';
-                storage->SetVoidPtr(buf_id, buf_ptr);
+            // Remove tag if X was clicked
+            if (remove_idx >= 0) {
+                tags.erase(tags.begin() + remove_idx);
+                changed = true;
             }
-            auto &input_buf = *buf_ptr;
-
-            const item_width iw{input_w > 0.0f ? input_w : -1.0f};
-            if (ImGui::InputTextWithHint("##tag_add", "Add tag...", input_buf.data(), input_buf.size(),
-                                         ImGuiInputTextFlags_EnterReturnsTrue)) {
-                if (const std::string new_tag(input_buf.data()); !new_tag.empty()) {
-                    tags.push_back(new_tag);
-                    delete buf_ptr; // NOLINT(cppcoreguidelines-owning-memory)
-                    storage->SetVoidPtr(buf_id, nullptr);
-                    changed = true;
-                    ImGui::SetKeyboardFocusHere(-1);
+
+            // Input text for new tags
+            if (const bool at_limit = max_tags > 0 && tags.size() >= max_tags; !at_limit) {
+                // Wrap input to next line if not enough space
+                if (constexpr float input_min_w = 80.0f; cursor_x + input_min_w > wrap_width && cursor_x > 0.0f) {
+                    cursor_x = 0.0f;
+                    cursor_y += line_height + style.ItemSpacing.y;
+                }
+
+                const float input_w = wrap_width - cursor_x;
+                ImGui::SetCursorScreenPos({origin.x + cursor_x, origin.y + cursor_y});
+
+                // Per-instance state, owned by the context to support multiple tag_input widgets
+                const ImGuiID buf_id    = ImGui::GetID("##tag_buf");
+                auto *const   st        = &tag_input_states_of(*ImGui::GetCurrentContext())[buf_id];
+                auto         &input_buf = st->buf;
+
+                ImGuiInputTextFlags flags = ImGuiInputTextFlags_EnterReturnsTrue;
+                if (vocab != nullptr)
+                    flags |= ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackCompletion;
+                if (st->refocus) {
+                    ImGui::SetKeyboardFocusHere();
+                    st->refocus = false;
                 }
+
+                const item_width iw{input_w > 0.0f ? input_w : -1.0f};
+                const bool       entered   = ImGui::InputTextWithHint("##tag_add", "Add tag...", input_buf.data(),
+                                                                      input_buf.size(), flags, tag_input_callback, st);
+                const bool       active    = ImGui::IsItemActive();
+                const ImVec2     input_min = ImGui::GetItemRectMin();
+                const ImVec2     input_max = ImGui::GetItemRectMax();
+
+                int picked = -1; // suggestion chosen by Enter or click
+                if (vocab != nullptr) {
+                    if (const std::string_view typed{input_buf.data()}; st->stale || typed != st->query) {
+                        st->query.assign(typed);
+                        vocab->suggest(typed, max_suggestions, st->suggestions);
+                        st->selected = -1;
+                        st->stale    = false;
+                    }
+                    if (entered && st->selected >= 0) picked = st->selected;
+                    if ((active || st->popup_hovered) && !st->suggestions.empty()) {
+                        constexpr int visible_rows = 8;
+                        if (const int clicked =
+                                render_tag_suggestions(*st, buf_id, input_min, input_max, visible_rows);
+                            clicked >= 0) {
+                            picked      = clicked;
+                            st->refocus = true;
+                        }
+                    } else {
+                        st->popup_hovered = false;
+                    }
+                }
+
+                if (entered || picked >= 0) {
+                    std::string new_tag =
+                        picked >= 0 ? std::string(st->suggestions[static_cast<std::size_t>(picked)].text)
+                                    : std::string(input_buf.data());
+                    if (!new_tag.empty()) {
+                        tags.push_back(std::move(new_tag));
+                        input_buf[0] = '\0';
+                        st->stale    = true;
+                        changed      = true;
+                        if (entered) ImGui::SetKeyboardFocusHere(-1);
+                    }
+                }
+
+                cursor_y += line_height;
+            } else {
+                cursor_y += line_height;
             }
 
-            cursor_y += line_height;
-        } else {
-            cursor_y += line_height;
+            // Reserve item space for the whole widget
+            ImGui::SetCursorScreenPos(origin);
+            ImGui::ItemSize({wrap_width, cursor_y});
+
+            return changed;
         }
 
-        // Reserve item space for the whole widget
-        ImGui::SetCursorScreenPos(origin);
-        ImGui::ItemSize({wrap_width, cursor_y});
+    } // namespace detail
 
-        return changed;
+    /**
+     * @brief Tag/chip input widget with pill rendering and inline editing.
+     *
+     * Renders each tag as a colored pill with an X button for removal.
+     * An InputText at the end allows adding new tags on Enter.
+     * @param label    Widget label (used as ImGui ID scope).
+     * @param tags     Vector of tag strings (in/out).
+     * @param max_tags Maximum number of tags allowed (0 = unlimited).
+     * @return True if the tag list changed this frame (added or removed).
+     */
+    [[nodiscard]] inline bool tag_input(const char *label, std::vector<std::string> &tags, const std::size_t max_tags = 0) {
+        return detail::tag_input_impl(label, tags, max_tags, nullptr, 0);
+    }
+
+    /**
+     * @brief tag_input() with autocomplete suggestions from @p vocab.
+     * @param label           Widget label (used as ImGui ID scope).
+     * @param tags            Vector of tag strings (in/out).
+     * @param vocab           Shared suggestion index; must outlive the call.
+     * @param max_tags        Maximum number of tags allowed (0 = unlimited).
+     * @param max_suggestions Suggestions computed per query (the popup scrolls through them).
+     * @return True if the tag list changed this frame (added or removed).
+     */
+    [[nodiscard]] inline bool tag_input(const char *label, std::vector<std::string> &tags, const tag_vocabulary &vocab,
+                                        const std::size_t max_tags = 0, const std::size_t max_suggestions = 50) {
+        return detail::tag_input_impl(label, tags, max_tags, &vocab, max_suggestions);
     }
 
 } // namespace imgui_util
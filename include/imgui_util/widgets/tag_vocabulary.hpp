@@ -0,0 +1,288 @@
+/// @file tag_vocabulary.hpp
+/// @brief Immutable autocomplete index for tag_input: top-K completions by prefix and frequency.
+///
+/// Terms are stored case-folded-sorted in one contiguous pool, so the terms starting with a
+/// prefix form one contiguous range found with two binary searches. A range-max structure
+/// over the frequencies (per-64-term monotonic-stack bitmasks plus a sparse table over the
+/// blocks) answers "most frequent term in [l, r]" in O(1), so the K most frequent
+/// completions are extracted in O(log N + K log K) no matter how wide the range is. When
+/// fewer than K terms share the prefix, the rest is filled by search::fuzzy_match over the
+/// vocabulary, with a per-term character-set mask rejecting most terms without scanning them.
+///
+/// Build once and share (the index is immutable and safe to query from several widgets):
+/// @code
+///   std::vector<imgui_util::tag_frequency> terms = load_vocabulary(); // {text, frequency}
+///   static const imgui_util::tag_vocabulary vocab{terms};
+///   std::vector<imgui_util::tag_suggestion> hits;
+///   vocab.suggest("anim", 8, hits);
+///   if (imgui_util::tag_input("Tags", tags, vocab)) { ... }
+/// @endcode
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/widgets/search_bar.hpp"
+
+namespace imgui_util {
+
+    /// @brief One vocabulary term and its weight (higher is suggested first).
+    struct tag_frequency {
+        std::string_view text;
+        std::uint32_t    frequency = 1;
+    };
+
+    /// @brief One completion returned by tag_vocabulary::suggest().
+    struct tag_suggestion {
+        std::uint32_t    index = 0; ///< Term index in the vocabulary (sorted order).
+        std::string_view text;      ///< Null-terminated; points into the vocabulary.
+        std::uint32_t    frequency = 0;
+        bool             fuzzy     = false; ///< From the fuzzy fallback rather than a prefix match.
+    };
+
+    /**
+     * @brief Sorted, deduplicated (case-insensitively) term list with frequency-ranked prefix queries.
+     *
+     * Duplicate terms differing only in ASCII case are merged: frequencies are summed and the
+     * first spelling is kept.
+     */
+    class tag_vocabulary {
+    public:
+        tag_vocabulary() = default;
+
+        explicit tag_vocabulary(const std::span<const tag_frequency> terms) { build(terms); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return frequency_.size(); }
+        [[nodiscard]] bool        empty() const noexcept { return frequency_.empty(); }
+
+        /// @brief Term @p i (null-terminated view into the pool).
+        [[nodiscard]] std::string_view term(const std::size_t i) const noexcept {
+            return {pool_.data() + offsets_[i], offsets_[i + 1] - offsets_[i] - 1};
+        }
+
+        [[nodiscard]] std::uint32_t frequency(const std::size_t i) const noexcept { return frequency_[i]; }
+
+        /// @brief Half-open index range of the terms starting with @p prefix (case-insensitive).
+        [[nodiscard]] std::pair<std::size_t, std::size_t> prefix_range(const std::string_view prefix) const noexcept {
+            const auto first = partition(size(), [&](const std::size_t i) { return cmp_prefix(term(i), prefix) < 0; });
+            const auto last  = partition(size(), [&](const std::size_t i) { return cmp_prefix(term(i), prefix) <= 0; });
+            return {first, last};
+        }
+
+        /**
+         * @brief The @p k best completions of @p query.
+         *
+         * Prefix matches come first, most frequent first (ties in sorted order). If fewer than
+         * @p k terms start with @p query and @p fuzzy is set, fuzzy matches follow, ranked by
+         * fuzzy score, then frequency. An empty query yields the most frequent terms.
+         * @param out Replaced with the results (reused to avoid allocation).
+         */
+        void suggest(const std::string_view query, const std::size_t k, std::vector<tag_suggestion> &out,
+                     const bool fuzzy = true) const {
+            out.clear();
+            if (k == 0 || empty()) return;
+            const auto [first, last] = prefix_range(query);
+            top_frequent(first, last, k, out);
+            if (fuzzy && out.size() < k && !query.empty()) fuzzy_fill(query, first, last, k, out);
+        }
+
+    private:
+        static constexpr std::size_t block = 64; // range-max block size (one bitmask word)
+
+        [[nodiscard]] static constexpr unsigned char fold(const char c) noexcept {
+            return static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+        }
+
+        // Case-folded compare of the first prefix.size() bytes of term against prefix
+        [[nodiscard]] static constexpr int cmp_prefix(const std::string_view term,
+                                                      const std::string_view prefix) noexcept {
+            const std::size_t n = std::min(term.size(), prefix.size());
+            for (std::size_t i = 0; i < n; ++i) {
+                if (fold(term[i]) != fold(prefix[i])) return fold(term[i]) < fold(prefix[i]) ? -1 : 1;
+            }
+            return term.size() < prefix.size() ? -1 : 0;
+        }
+
+        [[nodiscard]] static constexpr int cmp_folded(const std::string_view a, const std::string_view b) noexcept {
+            if (const int c = cmp_prefix(a, b.substr(0, std::min(a.size(), b.size()))); c != 0) return c;
+            return a.size() < b.size() ? -1 : a.size() > b.size() ? 1 : 0;
+        }
+
+        // First index in [0, n) for which pred is false (pred must be true on a prefix)
+        template<typename Pred>
+        [[nodiscard]] static std::size_t partition(const std::size_t n, Pred pred) noexcept {
+            std::size_t lo = 0;
+            std::size_t hi = n;
+            while (lo < hi) {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                if (pred(mid)) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo;
+        }
+
+        // Higher frequency wins; ties go to the earlier (lexicographically smaller) term
+        [[nodiscard]] bool better(const std::uint32_t a, const std::uint32_t b) const noexcept {
+            return frequency_[a] > frequency_[b] || (frequency_[a] == frequency_[b] && a < b);
+        }
+
+        [[nodiscard]] std::uint32_t pick(const std::uint32_t a, const std::uint32_t b) const noexcept {
+            return better(a, b) ? a : b;
+        }
+
+        void build(const std::span<const tag_frequency> terms) {
+            std::vector<std::uint32_t> order(terms.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::ranges::stable_sort(order, [&](const std::uint32_t a, const std::uint32_t b) {
+                return cmp_folded(terms[a].text, terms[b].text) < 0;
+            });
+
+            offsets_.clear();
+            offsets_.push_back(0);
+            for (std::size_t i = 0; i < order.size();) {
+                const tag_frequency &t    = terms[order[i]];
+                std::uint64_t        freq = 0;
+                for (; i < order.size() && cmp_folded(terms[order[i]].text, t.text) == 0; ++i)
+                    freq += terms[order[i]].frequency;
+                if (t.text.empty()) continue;
+                pool_.append(t.text);
+                pool_.push_back('\0');
+                offsets_.push_back(static_cast<std::uint32_t>(pool_.size()));
+                frequency_.push_back(static_cast<std::uint32_t>(std::min<std::uint64_t>(freq, UINT32_MAX)));
+                masks_.push_back(search::char_mask(t.text));
+            }
+            build_range_max();
+        }
+
+        void build_range_max() {
+            const std::size_t n = size();
+            in_block_.assign(n, 0);
+            for (std::size_t start = 0; start < n; start += block) {
+                std::uint64_t stack = 0; // bit j: start + j is on the monotonic stack
+                for (std::size_t i = start; i < std::min(n, start + block); ++i) {
+                    while (stack != 0) {
+                        const std::size_t top = start + 63 - static_cast<std::size_t>(std::countl_zero(stack));
+                        if (frequency_[top] >= frequency_[i]) break;
+                        stack &= ~(std::uint64_t{1} << (top - start));
+                    }
+                    stack |= std::uint64_t{1} << (i - start);
+                    in_block_[i] = stack;
+                }
+            }
+
+            blocks_ = (n + block - 1) / block;
+            levels_ = blocks_ == 0 ? 0 : static_cast<std::size_t>(std::bit_width(blocks_));
+            sparse_.assign(levels_ * blocks_, 0);
+            for (std::size_t b = 0; b < blocks_; ++b)
+                sparse_[b] = in_block_max(b * block, std::min(n, (b + 1) * block) - 1);
+            for (std::size_t k = 1; k < levels_; ++k) {
+                const std::size_t half = std::size_t{1} << (k - 1);
+                const std::uint32_t *prev = sparse_.data() + (k - 1) * blocks_;
+                for (std::size_t b = 0; b + (std::size_t{1} << k) <= blocks_; ++b)
+                    sparse_[k * blocks_ + b] = pick(prev[b], prev[b + half]);
+            }
+        }
+
+        // Argmax over [l, r] within one block: lowest stack entry at or after l
+        [[nodiscard]] std::uint32_t in_block_max(const std::size_t l, const std::size_t r) const noexcept {
+            const std::size_t   start = r - r % block;
+            const std::uint64_t m     = in_block_[r] & (~std::uint64_t{0} << (l - start));
+            return static_cast<std::uint32_t>(start + static_cast<std::size_t>(std::countr_zero(m)));
+        }
+
+        // Argmax over the inclusive range [l, r] in O(1)
+        [[nodiscard]] std::uint32_t range_max(const std::size_t l, const std::size_t r) const noexcept {
+            const std::size_t bl = l / block;
+            const std::size_t br = r / block;
+            if (bl == br) return in_block_max(l, r);
+            std::uint32_t best = pick(in_block_max(l, bl * block + block - 1), in_block_max(br * block, r));
+            if (bl + 1 < br) {
+                const std::size_t lo = bl + 1;
+                const std::size_t k  = static_cast<std::size_t>(std::bit_width(br - lo)) - 1;
+                best                 = pick(best, sparse_[k * blocks_ + lo]);
+                best                 = pick(best, sparse_[k * blocks_ + br - (std::size_t{1} << k)]);
+            }
+            return best;
+        }
+
+        // k most frequent terms in [first, last): best-first split around each range maximum
+        void top_frequent(const std::size_t first, const std::size_t last, const std::size_t k,
+                          std::vector<tag_suggestion> &out) const {
+            if (first >= last) return;
+            struct span_max {
+                std::size_t   l, r;
+                std::uint32_t arg;
+            };
+            const auto worse = [this](const span_max &a, const span_max &b) { return better(b.arg, a.arg); };
+            std::vector<span_max> heap;
+            heap.reserve(2 * k + 1);
+            heap.push_back({first, last - 1, range_max(first, last - 1)});
+            while (!heap.empty() && out.size() < k) {
+                std::ranges::pop_heap(heap, worse);
+                const span_max s = heap.back();
+                heap.pop_back();
+                out.push_back({s.arg, term(s.arg), frequency_[s.arg], false});
+                if (s.arg > s.l) {
+                    heap.push_back({s.l, s.arg - 1, range_max(s.l, s.arg - 1)});
+                    std::ranges::push_heap(heap, worse);
+                }
+                if (s.arg < s.r) {
+                    heap.push_back({s.arg + 1, s.r, range_max(s.arg + 1, s.r)});
+                    std::ranges::push_heap(heap, worse);
+                }
+            }
+        }
+
+        // Fill out up to k with fuzzy matches outside the prefix range [first, last)
+        void fuzzy_fill(const std::string_view query, const std::size_t first, const std::size_t last,
+                        const std::size_t k, std::vector<tag_suggestion> &out) const {
+            struct candidate {
+                int           score;
+                std::uint32_t index;
+            };
+            const auto ranks_before = [this](const candidate &a, const candidate &b) {
+                if (a.score != b.score) return a.score > b.score;
+                return better(a.index, b.index);
+            };
+            const std::size_t      need = k - out.size();
+            const std::uint64_t    qm   = search::char_mask(query);
+            std::vector<candidate> best; // heap with the worst kept candidate on top
+            best.reserve(need + 1);
+            for (std::size_t i = 0; i < size(); ++i) {
+                if (i == first) i = last; // already suggested as prefix matches
+                if (i >= size()) break;
+                if ((qm & ~masks_[i]) != 0) continue;
+                int score = 0;
+                if (!search::fuzzy_match(query, term(i), score)) continue;
+                const candidate c{score, static_cast<std::uint32_t>(i)};
+                if (best.size() == need && !ranks_before(c, best.front())) continue;
+                best.push_back(c);
+                std::ranges::push_heap(best, ranks_before);
+                if (best.size() > need) {
+                    std::ranges::pop_heap(best, ranks_before);
+                    best.pop_back();
+                }
+            }
+            std::ranges::sort_heap(best, ranks_before);
+            for (const candidate &c: best) out.push_back({c.index, term(c.index), frequency_[c.index], true});
+        }
+
+        std::string                pool_;      // terms, each null-terminated, in folded sort order
+        std::vector<std::uint32_t> offsets_;   // size() + 1 term starts in pool_
+        std::vector<std::uint32_t> frequency_;
+        std::vector<std::uint64_t> masks_;     // search::char_mask per term
+        std::vector<std::uint64_t> in_block_;  // monotonic-stack bitmask per term
+        std::vector<std::uint32_t> sparse_;    // levels_ x blocks_ block argmax table
+        std::size_t                blocks_ = 0;
+        std::size_t                levels_ = 0;
+    };
+
+} // namespace imgui_util
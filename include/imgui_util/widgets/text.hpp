@@ -8,6 +8,7 @@
 ///   imgui_util::fmt_text("FPS: {:.1f}", fps);
 ///   imgui_util::right_aligned_text(x, w, y, "100%", colors::success);
 ///   auto t = imgui_util::truncate_to_width(long_text, 200.0f);
+///   imgui_util::text_clipped(cell_text, column_width);  // no allocation
 /// @endcode
 ///
 /// colors:: provides a consistent semantic palette (accent, warning, error, etc.).
@@ -15,6 +16,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <format>
 #include <imgui.h>
 #include <span>
@@ -119,49 +122,208 @@ namespace imgui_util {
     }
 
     /**
-     * @brief Result of truncate_to_width.
+     * @brief Glyph advances of one font at one size, as ImFont::CalcTextSizeA accumulates them.
      *
-     * Holds the original string_view when no truncation is needed, or an owned
-     * string with a "..." suffix when truncated (avoids allocation in the common case).
+     * The ASCII range is copied into a flat pre-scaled table so the common case is a single
+     * load per byte; other codepoints go through the font's IndexAdvanceX.
+     */
+    class glyph_advances {
+    public:
+        glyph_advances(const ImFont &font, const float size) noexcept : font_(&font) { rebuild(font, size); }
+
+        /// @brief Advance of @p codepoint in pixels (the font's fallback advance for missing glyphs).
+        [[nodiscard]] float operator()(const unsigned int codepoint) const noexcept {
+            if (codepoint < ascii_.size()) return ascii_[codepoint];
+            const auto &index = font_->IndexAdvanceX;
+            return (static_cast<int>(codepoint) < index.Size ? index.Data[codepoint] : font_->FallbackAdvanceX) *
+                   scale_;
+        }
+
+        /**
+         * @brief Table for the current context's font and font size; rebuilt at most once per frame per font.
+         *
+         * Each ImGui context keeps its own tables, freed when it shuts down. UI thread only.
+         */
+        [[nodiscard]] static const glyph_advances &current();
+
+    private:
+        struct cache; // per-context tables behind current(), in text.cpp
+
+        glyph_advances() noexcept = default;
+
+        void rebuild(const ImFont &font, const float size) noexcept {
+            font_                     = &font;
+            scale_                    = size / font.FontSize;
+            const ImVector<float> &ix = font.IndexAdvanceX;
+            for (int c = 0; c < static_cast<int>(ascii_.size()); ++c)
+                ascii_[static_cast<std::size_t>(c)] = (c < ix.Size ? ix.Data[c] : font.FallbackAdvanceX) * scale_;
+        }
+
+        const ImFont          *font_  = nullptr;
+        float                  scale_ = 1.0f;
+        std::array<float, 128> ascii_{};
+    };
+
+    namespace detail {
+
+        // ImGui::CalcTextSize rounds widths up to whole pixels.
+        [[nodiscard]] inline float round_text_width(const float w) noexcept {
+            return static_cast<float>(static_cast<int>(w + 0.99999f));
+        }
+
+        // Decode one UTF-8 sequence like ImTextCharFromUtf8; returns the bytes consumed (>= 1).
+        [[nodiscard]] inline std::size_t decode_utf8(const std::string_view s, const std::size_t i,
+                                                     unsigned int &out) noexcept {
+            const auto        b0  = static_cast<unsigned char>(s[i]);
+            const std::size_t len = b0 < 0xC0 ? 0 : b0 < 0xE0 ? 2 : b0 < 0xF0 ? 3 : b0 < 0xF8 ? 4 : 0;
+            out                   = IM_UNICODE_CODEPOINT_INVALID;
+            if (len == 0) return 1;
+            std::size_t n = 1; // an invalid sequence still swallows the following non-NUL bytes, up to len
+            while (n < len && i + n < s.size() && s[i + n] != '\0') ++n;
+            if (n < len) return n;
+            unsigned int cp = b0 & (0xFFu >> (len + 1));
+            for (std::size_t k = 1; k < len; ++k) {
+                const auto b = static_cast<unsigned char>(s[i + k]);
+                if ((b & 0xC0u) != 0x80u) return len;
+                cp = (cp << 6) | (b & 0x3Fu);
+            }
+            constexpr unsigned int min_cp[] = {0, 0, 0x80, 0x800, 0x10000};
+            if (cp >= min_cp[len] && cp <= IM_UNICODE_CODEPOINT_MAX && (cp < 0xD800 || cp > 0xDFFF)) out = cp;
+            return len;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Number of leading bytes of @p text to keep so it fits in @p max_width pixels followed by "...".
+     *
+     * One pass over the text, stopping as soon as the full width is known to overflow. Cuts only
+     * at UTF-8 character boundaries and measures exactly like ImGui::CalcTextSize.
+     * @return text.size() if the whole text fits (no ellipsis needed).
+     */
+    [[nodiscard]] inline std::size_t truncate_length(const glyph_advances &advances, const std::string_view text,
+                                                     const float max_width) noexcept {
+        const float ellipsis_w = detail::round_text_width(3.0f * advances('.'));
+        float       widest     = 0.0f; // widest finished line
+        float       line       = 0.0f;
+        std::size_t keep       = 0;
+        bool        prefix_fit = true; // widths only grow, so once a prefix overflows all longer ones do
+        for (std::size_t i = 0; i < text.size();) {
+            const float w = detail::round_text_width(std::max(widest, line));
+            if (w > max_width) return keep;
+            if (prefix_fit && w + ellipsis_w <= max_width) keep = i;
+            else prefix_fit = false;
+
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c < 0x80) {
+                ++i;
+                if (c == '\n') {
+                    widest = std::max(widest, line);
+                    line   = 0.0f;
+                } else if (c == 0) {
+                    break; // CalcTextSize stops at a NUL
+                } else if (c != '\r') {
+                    line += advances(c);
+                }
+            } else {
+                unsigned int cp = 0;
+                i += detail::decode_utf8(text, i, cp);
+                line += advances(cp);
+            }
+        }
+        return detail::round_text_width(std::max(widest, line)) <= max_width ? text.size() : keep;
+    }
+
+    /// @brief truncate_length() with the current font.
+    [[nodiscard]] inline std::size_t truncate_length(const std::string_view text, const float max_width) noexcept {
+        return truncate_length(glyph_advances::current(), text, max_width);
+    }
+
+    /**
+     * @brief Result of truncate_to_width / truncate_to_width_view.
+     *
+     * Holds the original string_view when no truncation is needed. When truncated, it either
+     * owns a string with a "..." suffix, or (non-owning form) refers to the kept prefix of the
+     * original and reports the ellipsis separately, so nothing is allocated.
      */
     class truncated_text {
     public:
-        explicit truncated_text(std::string_view original) : data_(original) {}
+        explicit truncated_text(std::string_view original) : data_(original), kept_(original.size()) {}
         explicit truncated_text(std::string truncated) : data_(std::move(truncated)) {}
 
+        /// @brief Non-owning form: the first @p kept bytes of @p original, then "..." if anything was cut.
+        truncated_text(const std::string_view original, const std::size_t kept) noexcept :
+            data_(original), kept_(std::min(kept, original.size())) {}
+
+        /// @brief Contiguous text; for the non-owning form only the kept prefix (see suffix()).
         [[nodiscard]] std::string_view view() const noexcept {
-            if (const auto *sv = std::get_if<std::string_view>(&data_)) return *sv;
+            if (const auto *sv = std::get_if<std::string_view>(&data_)) return sv->substr(0, kept_);
             return std::get<std::string>(data_);
         }
 
-        [[nodiscard]] bool was_truncated() const noexcept { return std::holds_alternative<std::string>(data_); }
+        /// @brief Text drawn after view(): "..." for a non-owning truncation, otherwise empty.
+        [[nodiscard]] std::string_view suffix() const noexcept {
+            const auto *sv = std::get_if<std::string_view>(&data_);
+            return sv != nullptr && kept_ < sv->size() ? std::string_view{"..."} : std::string_view{};
+        }
+
+        /// @brief Bytes of the original text that are shown.
+        [[nodiscard]] std::size_t kept() const noexcept {
+            if (std::holds_alternative<std::string_view>(data_)) return kept_;
+            return std::get<std::string>(data_).size() - 3;
+        }
+
+        [[nodiscard]] bool was_truncated() const noexcept {
+            if (const auto *sv = std::get_if<std::string_view>(&data_)) return kept_ < sv->size();
+            return true;
+        }
+
+        /// @brief Display text as one string (allocates).
+        [[nodiscard]] std::string str() const {
+            std::string out{view()};
+            out += suffix();
+            return out;
+        }
 
     private:
         std::variant<std::string_view, std::string> data_;
+        std::size_t                                 kept_ = 0;
     };
 
-    /// @brief Truncate text to fit within @p max_width pixels, appending "..." if needed.
+    /// @brief Truncate text to fit within @p max_width pixels; the truncated form owns "text...".
     [[nodiscard]] inline truncated_text truncate_to_width(const std::string_view text, const float max_width) {
-        if (ImGui::CalcTextSize(text.data(), text.data() + text.size()).x <= max_width) {
-            return truncated_text{text};
-        }
-        constexpr std::string_view ellipsis = "...";
-        const float ellipsis_w              = ImGui::CalcTextSize(ellipsis.data(), ellipsis.data() + ellipsis.size()).x;
-        std::size_t lo                      = 0;
-        std::size_t hi                      = text.size();
-        while (lo < hi) {
-            const std::size_t mid = lo + (hi - lo + 1) / 2;
-            if (const float w = ImGui::CalcTextSize(text.data(), text.data() + mid).x + ellipsis_w; w <= max_width) {
-                lo = mid;
-            } else {
-                hi = mid - 1;
-            }
-        }
-        std::string result(text.data(), lo); // NOLINT(bugprone-suspicious-stringview-data-usage) -- size-bounded
-        result += ellipsis;
+        const std::size_t n = truncate_length(text, max_width);
+        if (n == text.size()) return truncated_text{text};
+        std::string result(text.substr(0, n));
+        result += "...";
         return truncated_text{std::move(result)};
     }
 
+    /// @brief Non-allocating truncate_to_width(): a view of the kept prefix plus suffix().
+    [[nodiscard]] inline truncated_text truncate_to_width_view(const std::string_view text,
+                                                               const float max_width) noexcept {
+        return truncated_text{text, truncate_length(text, max_width)};
+    }
+
+    /// @brief Render a truncated_text as one item (prefix and ellipsis are grouped when not contiguous).
+    inline void text_unformatted(const truncated_text &t) noexcept {
+        const std::string_view head = t.view();
+        const std::string_view tail = t.suffix();
+        if (tail.empty()) {
+            ImGui::TextUnformatted(head.data(), head.data() + head.size());
+            return;
+        }
+        const group g;
+        ImGui::TextUnformatted(head.data(), head.data() + head.size());
+        ImGui::SameLine(0.0f, 0.0f);
+        ImGui::TextUnformatted(tail.data(), tail.data() + tail.size());
+    }
+
+    /// @brief Render @p text truncated to @p max_width pixels, without allocating.
+    inline void text_clipped(const std::string_view text, const float max_width) noexcept {
+        text_unformatted(truncate_to_width_view(text, max_width));
+    }
+
     /// @brief Draw vertical grid lines at the given X positions.
     inline void draw_vertical_grid_lines(ImDrawList *dl, const float y, const float h, const std::span<const float> xs,
                                          const ImU32 color) noexcept {
@@ -177,18 +339,16 @@ namespace imgui_util {
 
     /// @brief Format and render text in one call (stack-allocated, no heap alloc for small strings).
     template<std::size_t N = 64, typename... Args>
-    void fmt_text(std::format_string<Args...> fmt, Args &&...args) {
+    void fmt_text(fmt_string<Args...> fmt, Args &&...args) {
         const fmt_buf<N> buf(fmt, std::forward<Args>(args)...);
         ImGui::TextUnformatted(buf.c_str(), buf.end());
     }
 
     /// @brief Format, truncate to @p max_width pixels, and render text in one call.
     template<std::size_t N = 128, typename... Args>
-    void fmt_text_clipped(const float max_width, std::format_string<Args...> fmt, Args &&...args) {
+    void fmt_text_clipped(const float max_width, fmt_string<Args...> fmt, Args &&...args) {
         const fmt_buf<N> buf(fmt, std::forward<Args>(args)...);
-        const auto       t  = truncate_to_width(buf.sv(), max_width);
-        const auto       sv = t.view();
-        ImGui::TextUnformatted(sv.data(), sv.data() + sv.size());
+        text_clipped(buf.sv(), max_width);
     }
 
     /// @brief Render a status message colored by severity. No-op when @p text is empty.
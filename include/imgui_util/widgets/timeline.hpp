@@ -31,6 +31,7 @@
 
 #include "imgui_util/core/fmt_buf.hpp"
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/core/text_metrics.hpp"
 
 namespace imgui_util {
 
@@ -294,10 +295,13 @@ namespace imgui_util {
             ctx.dl->AddRect({x0, y0}, {x1, y1}, IM_COL32(255, 255, 255, 60), 3.0f);
 
             if (!ev.label.empty() && x1 - x0 > 20.0f) {
-                ctx.dl->PushClipRect({x0, y0}, {x1, y1}, true);
+                // Clip only labels that overflow: each clip rect push/pop splits the draw command
+                const ImVec2 text_size = calc_text_size(ev.label);
+                const bool   clip      = x0 + 4.0f + text_size.x > x1 || y0 + 2.0f + text_size.y > y1;
+                if (clip) ctx.dl->PushClipRect({x0, y0}, {x1, y1}, true);
                 ctx.dl->AddText({x0 + 4.0f, y0 + 2.0f}, IM_COL32(255, 255, 255, 220), ev.label.data(),
                                 ev.label.data() + ev.label.size());
-                ctx.dl->PopClipRect();
+                if (clip) ctx.dl->PopClipRect();
             }
         }
 
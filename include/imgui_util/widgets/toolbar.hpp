@@ -15,6 +15,10 @@
 ///       .button("A", [&]{ action_a(); })
 ///       .button("B", [&]{ action_b(); })
 ///       .render();
+///
+///   // Buttons for command_registry commands; build once, render every frame:
+///   (void)bar.button(commands, save_id).button(commands, undo_id);
+///   bar.render();
 /// @endcode
 ///
 /// Renders a row (or column) of buttons with optional tooltips and toggle state.
@@ -27,6 +31,8 @@
 #include <vector>
 
 #include "imgui_util/core/raii.hpp"
+#include "imgui_util/core/text_metrics.hpp"
+#include "imgui_util/widgets/command_registry.hpp"
 #include "imgui_util/widgets/direction.hpp"
 
 namespace imgui_util {
@@ -57,6 +63,17 @@ namespace imgui_util {
             return *this;
         }
 
+        /**
+         * @brief Add a button for a registered command.
+         *
+         * Label, enable state and tooltip (description and shortcut) are read from @p commands
+         * each frame, so the toolbar can be kept and re-rendered. @p commands must outlive it.
+         */
+        [[nodiscard]] toolbar &button(command_registry &commands, const command_id id) {
+            entries_.push_back({.type = entry_type::command, .commands = &commands, .command = id});
+            return *this;
+        }
+
         /**
          * @brief Add an image button.
          * @param str_id   ImGui string ID.
@@ -105,8 +122,7 @@ namespace imgui_util {
         /// @brief Render all toolbar entries. Call once per frame.
         void render() {
             for (std::size_t i = 0; i < entries_.size(); ++i) {
-                auto &[type, lbl, action, tip, icon, value, enabled] = entries_[i]; // NOLINT(misc-const-correctness)
-                render_entry(type, lbl, action, tip, icon, value, enabled);
+                render_entry(entries_[i]);
 
                 if (dir_ == direction::horizontal && i + 1 < entries_.size()
                     && entries_[i + 1].type != entry_type::separator) {
@@ -116,7 +132,7 @@ namespace imgui_util {
         }
 
     private:
-        enum class entry_type : std::uint8_t { button, icon_button, toggle, separator, label };
+        enum class entry_type : std::uint8_t { button, icon_button, toggle, separator, label, command };
 
         struct icon_data {
             ImTextureID texture = {};
@@ -125,25 +141,35 @@ namespace imgui_util {
 
         struct toolbar_entry {
             entry_type                      type;
-            const char                     *label   = nullptr;
-            std::move_only_function<void()> action  = {};
-            const char                     *tooltip = nullptr;
-            icon_data                       icon    = {};
-            bool                           *value   = nullptr;
-            bool                            enabled = true;
+            const char                     *label    = nullptr;
+            std::move_only_function<void()> action   = {};
+            const char                     *tooltip  = nullptr;
+            icon_data                       icon     = {};
+            bool                           *value    = nullptr;
+            bool                            enabled  = true;
+            command_registry               *commands = nullptr;
+            command_id                      command  = command_registry::invalid_id;
         };
 
-        void render_entry(const entry_type type, const char *lbl, std::move_only_function<void()> &action, // NOLINT(*-non-const-parameter)
-                          const char *tip, const icon_data &icon, bool *value, const bool enabled) const {
+        void render_entry(toolbar_entry &e) const {
+            const auto &[type, lbl, action, tip, icon, value, enabled, commands, command] = e;
             switch (type) {
                 case entry_type::button: {
                     const disabled guard{!enabled};
-                    if (ImGui::Button(lbl) && action) action();
+                    if (ImGui::Button(lbl) && action) e.action();
+                    break;
+                }
+                case entry_type::command: {
+                    {
+                        const disabled guard{!commands->enabled(command)};
+                        if (ImGui::Button(commands->label(command))) (void)commands->execute(command);
+                    }
+                    render_command_tooltip(*commands, command);
                     break;
                 }
                 case entry_type::icon_button: {
                     const disabled guard{!enabled};
-                    if (ImGui::ImageButton(lbl, icon.texture, icon.size) && action) action();
+                    if (ImGui::ImageButton(lbl, icon.texture, icon.size) && action) e.action();
                     break;
                 }
                 case entry_type::toggle: {
@@ -157,7 +183,7 @@ namespace imgui_util {
                 }
                 case entry_type::label: {
                     ImGui::AlignTextToFramePadding();
-                    ImGui::TextUnformatted(lbl);
+                    text_unformatted_cached(lbl);
                     break;
                 }
                 case entry_type::separator:
@@ -177,6 +203,16 @@ namespace imgui_util {
             }
         }
 
+        static void render_command_tooltip(const command_registry &commands, const command_id id) {
+            const std::string_view desc     = commands.description(id);
+            const char            *shortcut = commands.shortcut(id);
+            if (desc.empty() && shortcut == nullptr) return;
+            if (const item_tooltip tt{}) {
+                if (!desc.empty()) ImGui::TextUnformatted(desc.data(), desc.data() + desc.size());
+                if (shortcut != nullptr) ImGui::TextDisabled("%s", shortcut);
+            }
+        }
+
         direction                  dir_;
         std::vector<toolbar_entry> entries_;
     };
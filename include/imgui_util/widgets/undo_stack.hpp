@@ -157,7 +157,7 @@ namespace imgui_util {
 
         [[nodiscard]] bool render_history_list() noexcept {
             const auto prev = current_index_;
-            if (const child list{"##undo_list"}; !list) return false;
+            if (const child list{"##undo_list"_id}; !list) return false;
 
             for (std::size_t i = 0; i < stack_.size(); ++i) {
                 const auto &[description, state] = stack_[i];
@@ -0,0 +1,119 @@
+#include "imgui_util/plot/binning.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define IMGUI_UTIL_BINNING_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMGUI_UTIL_BINNING_SSE2 1
+#endif
+
+namespace imgui_util::implot {
+
+    namespace {
+
+        // ============================================================================
+        // ISA wrappers - samples are widened to double so results match bin_axis::index()
+        // ============================================================================
+
+#if defined(IMGUI_UTIL_BINNING_AVX2)
+        struct simd_ops {
+            using vd                               = __m256d;
+            static constexpr std::size_t      width = 4;
+            static constexpr std::string_view name  = "avx2";
+
+            static vd   load(const double *p) noexcept { return _mm256_loadu_pd(p); }
+            static vd   load(const float *p) noexcept { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+            static vd   set(const double d) noexcept { return _mm256_set1_pd(d); }
+            static vd   sub(const vd a, const vd b) noexcept { return _mm256_sub_pd(a, b); }
+            static vd   mul(const vd a, const vd b) noexcept { return _mm256_mul_pd(a, b); }
+            static vd   min(const vd a, const vd b) noexcept { return _mm256_min_pd(a, b); }
+            static vd   in_range(const vd x, const vd lo, const vd hi) noexcept {
+                return _mm256_and_pd(_mm256_cmp_pd(x, lo, _CMP_GE_OQ), _mm256_cmp_pd(x, hi, _CMP_LE_OQ));
+            }
+            static vd   select(const vd m, const vd a, const vd b) noexcept { return _mm256_blendv_pd(b, a, m); }
+            static void store_trunc(std::int32_t *p, const vd v) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_cvttpd_epi32(v)); // NOLINT
+            }
+        };
+#elif defined(IMGUI_UTIL_BINNING_SSE2)
+        struct simd_ops {
+            using vd                               = __m128d;
+            static constexpr std::size_t      width = 2;
+            static constexpr std::string_view name  = "sse2";
+
+            static vd load(const double *p) noexcept { return _mm_loadu_pd(p); }
+            static vd load(const float *p) noexcept {
+                return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)))); // NOLINT
+            }
+            static vd set(const double d) noexcept { return _mm_set1_pd(d); }
+            static vd sub(const vd a, const vd b) noexcept { return _mm_sub_pd(a, b); }
+            static vd mul(const vd a, const vd b) noexcept { return _mm_mul_pd(a, b); }
+            static vd min(const vd a, const vd b) noexcept { return _mm_min_pd(a, b); }
+            static vd in_range(const vd x, const vd lo, const vd hi) noexcept {
+                return _mm_and_pd(_mm_cmpge_pd(x, lo), _mm_cmple_pd(x, hi));
+            }
+            // SSE2 has no blendv: (m & a) | (~m & b)
+            static vd select(const vd m, const vd a, const vd b) noexcept {
+                return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+            }
+            static void store_trunc(std::int32_t *p, const vd v) noexcept {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm_cvttpd_epi32(v)); // NOLINT
+            }
+        };
+#endif
+
+        // ============================================================================
+        // Driver - full SIMD blocks, then the scalar reference for the tail
+        // ============================================================================
+
+        // Lane-for-lane bin_axis::index(): clamp (x - min) * scale to bins - 1, truncate,
+        // and force -1 where x is outside [min, max] (NaN compares false, so it is rejected too).
+        template<typename T>
+        void bin_indices_impl(const std::span<const T> in, const bin_axis &axis,
+                              const std::span<std::int32_t> out) noexcept {
+            const std::size_t n = std::min(in.size(), out.size());
+            std::size_t       i = 0;
+#if defined(IMGUI_UTIL_BINNING_AVX2) || defined(IMGUI_UTIL_BINNING_SSE2)
+            using O            = simd_ops;
+            const auto lo      = O::set(axis.min);
+            const auto hi      = O::set(axis.max);
+            const auto scale   = O::set(axis.scale());
+            const auto last    = O::set(axis.bins - 1.0);
+            const auto outside = O::set(-1.0);
+            for (; i + O::width <= n; i += O::width) {
+                const auto x = O::load(&in[i]);
+                const auto t = O::min(O::mul(O::sub(x, lo), scale), last);
+                O::store_trunc(&out[i], O::select(O::in_range(x, lo, hi), t, outside));
+            }
+#endif
+            for (; i < n; i++)
+                out[i] = axis.index(static_cast<double>(in[i]));
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // Public entry points
+    // ============================================================================
+
+    std::string_view binning_backend() noexcept {
+#if defined(IMGUI_UTIL_BINNING_AVX2) || defined(IMGUI_UTIL_BINNING_SSE2)
+        return simd_ops::name;
+#else
+        return "scalar";
+#endif
+    }
+
+    void bin_indices(const std::span<const float> in, const bin_axis &axis, const std::span<std::int32_t> out) noexcept {
+        bin_indices_impl(in, axis, out);
+    }
+
+    void bin_indices(const std::span<const double> in, const bin_axis &axis,
+                     const std::span<std::int32_t> out) noexcept {
+        bin_indices_impl(in, axis, out);
+    }
+
+} // namespace imgui_util::implot
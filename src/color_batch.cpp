@@ -0,0 +1,487 @@
+#include "imgui_util/theme/color_batch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numbers>
+
+#include "imgui_util/theme/color_math.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define IMGUI_UTIL_COLOR_BATCH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMGUI_UTIL_COLOR_BATCH_SSE2 1
+#endif
+
+namespace imgui_util::color {
+
+    namespace {
+
+        // ============================================================================
+        // ISA wrappers - the kernels below are written once against this interface
+        // ============================================================================
+
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2)
+        struct simd_ops {
+            using vf                              = __m256;
+            using vi                              = __m256i;
+            static constexpr std::size_t     width = 8;
+            static constexpr std::string_view name = "avx2";
+
+            static vf load(const float *p) noexcept { return _mm256_loadu_ps(p); }
+            static void store(float *p, const vf v) noexcept { _mm256_storeu_ps(p, v); }
+            static vi   load_u32(const ImU32 *p) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); // NOLINT
+            }
+            static void store_u32(ImU32 *p, const vi v) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); // NOLINT
+            }
+
+            static vf set(const float f) noexcept { return _mm256_set1_ps(f); }
+            static vf add(const vf a, const vf b) noexcept { return _mm256_add_ps(a, b); }
+            static vf sub(const vf a, const vf b) noexcept { return _mm256_sub_ps(a, b); }
+            static vf mul(const vf a, const vf b) noexcept { return _mm256_mul_ps(a, b); }
+            static vf div(const vf a, const vf b) noexcept { return _mm256_div_ps(a, b); }
+            static vf min(const vf a, const vf b) noexcept { return _mm256_min_ps(a, b); }
+            static vf max(const vf a, const vf b) noexcept { return _mm256_max_ps(a, b); }
+            static vf sqrt(const vf a) noexcept { return _mm256_sqrt_ps(a); }
+
+            static vf lt(const vf a, const vf b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static vf le(const vf a, const vf b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+            static vf gt(const vf a, const vf b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static vf ge(const vf a, const vf b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+            static vf eq(const vf a, const vf b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+            static vf select(const vf m, const vf a, const vf b) noexcept { return _mm256_blendv_ps(b, a, m); }
+            static vf bit_and(const vf a, const vf b) noexcept { return _mm256_and_ps(a, b); }
+            static vf bit_or(const vf a, const vf b) noexcept { return _mm256_or_ps(a, b); }
+            static vf bit_andnot(const vf a, const vf b) noexcept { return _mm256_andnot_ps(a, b); }
+
+            static vi   iset(const std::uint32_t i) noexcept { return _mm256_set1_epi32(static_cast<int>(i)); }
+            static vi   iand(const vi a, const vi b) noexcept { return _mm256_and_si256(a, b); }
+            static vi   ior(const vi a, const vi b) noexcept { return _mm256_or_si256(a, b); }
+            static vi   iadd(const vi a, const vi b) noexcept { return _mm256_add_epi32(a, b); }
+            static vi   isub(const vi a, const vi b) noexcept { return _mm256_sub_epi32(a, b); }
+            template<int N>
+            static vi shr(const vi a) noexcept {
+                return _mm256_srli_epi32(a, N);
+            }
+            template<int N>
+            static vi shl(const vi a) noexcept {
+                return _mm256_slli_epi32(a, N);
+            }
+            static vi as_int(const vf a) noexcept { return _mm256_castps_si256(a); }
+            static vf as_float(const vi a) noexcept { return _mm256_castsi256_ps(a); }
+            static vf to_float(const vi a) noexcept { return _mm256_cvtepi32_ps(a); }
+            static vi round_to_int(const vf a) noexcept { return _mm256_cvtps_epi32(a); }
+            static vi trunc_to_int(const vf a) noexcept { return _mm256_cvttps_epi32(a); }
+        };
+#elif defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+        struct simd_ops {
+            using vf                              = __m128;
+            using vi                              = __m128i;
+            static constexpr std::size_t     width = 4;
+            static constexpr std::string_view name = "sse2";
+
+            static vf load(const float *p) noexcept { return _mm_loadu_ps(p); }
+            static void store(float *p, const vf v) noexcept { _mm_storeu_ps(p, v); }
+            static vi   load_u32(const ImU32 *p) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); // NOLINT
+            }
+            static void store_u32(ImU32 *p, const vi v) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); // NOLINT
+            }
+
+            static vf set(const float f) noexcept { return _mm_set1_ps(f); }
+            static vf add(const vf a, const vf b) noexcept { return _mm_add_ps(a, b); }
+            static vf sub(const vf a, const vf b) noexcept { return _mm_sub_ps(a, b); }
+            static vf mul(const vf a, const vf b) noexcept { return _mm_mul_ps(a, b); }
+            static vf div(const vf a, const vf b) noexcept { return _mm_div_ps(a, b); }
+            static vf min(const vf a, const vf b) noexcept { return _mm_min_ps(a, b); }
+            static vf max(const vf a, const vf b) noexcept { return _mm_max_ps(a, b); }
+            static vf sqrt(const vf a) noexcept { return _mm_sqrt_ps(a); }
+
+            static vf lt(const vf a, const vf b) noexcept { return _mm_cmplt_ps(a, b); }
+            static vf le(const vf a, const vf b) noexcept { return _mm_cmple_ps(a, b); }
+            static vf gt(const vf a, const vf b) noexcept { return _mm_cmpgt_ps(a, b); }
+            static vf ge(const vf a, const vf b) noexcept { return _mm_cmpge_ps(a, b); }
+            static vf eq(const vf a, const vf b) noexcept { return _mm_cmpeq_ps(a, b); }
+            // SSE2 has no blendv: (m & a) | (~m & b)
+            static vf select(const vf m, const vf a, const vf b) noexcept {
+                return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+            }
+            static vf bit_and(const vf a, const vf b) noexcept { return _mm_and_ps(a, b); }
+            static vf bit_or(const vf a, const vf b) noexcept { return _mm_or_ps(a, b); }
+            static vf bit_andnot(const vf a, const vf b) noexcept { return _mm_andnot_ps(a, b); }
+
+            static vi   iset(const std::uint32_t i) noexcept { return _mm_set1_epi32(static_cast<int>(i)); }
+            static vi   iand(const vi a, const vi b) noexcept { return _mm_and_si128(a, b); }
+            static vi   ior(const vi a, const vi b) noexcept { return _mm_or_si128(a, b); }
+            static vi   iadd(const vi a, const vi b) noexcept { return _mm_add_epi32(a, b); }
+            static vi   isub(const vi a, const vi b) noexcept { return _mm_sub_epi32(a, b); }
+            template<int N>
+            static vi shr(const vi a) noexcept {
+                return _mm_srli_epi32(a, N);
+            }
+            template<int N>
+            static vi shl(const vi a) noexcept {
+                return _mm_slli_epi32(a, N);
+            }
+            static vi as_int(const vf a) noexcept { return _mm_castps_si128(a); }
+            static vf as_float(const vi a) noexcept { return _mm_castsi128_ps(a); }
+            static vf to_float(const vi a) noexcept { return _mm_cvtepi32_ps(a); }
+            static vi round_to_int(const vf a) noexcept { return _mm_cvtps_epi32(a); }
+            static vi trunc_to_int(const vf a) noexcept { return _mm_cvttps_epi32(a); }
+        };
+#endif
+
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+
+        // ============================================================================
+        // Vector kernels - lane-for-lane transcriptions of the color_math.hpp reference
+        // ============================================================================
+
+        template<typename O>
+        struct kernels {
+            using vf = typename O::vf;
+            using vi = typename O::vi;
+
+            static vf k(const float f) noexcept { return O::set(f); }
+            static vf abs(const vf a) noexcept { return O::bit_andnot(k(-0.0f), a); }
+            static vf clamp01(const vf a) noexcept { return O::min(O::max(a, k(0.0f)), k(1.0f)); }
+            static vf madd(const vf a, const vf b, const vf c) noexcept { return O::add(O::mul(a, b), c); }
+
+            static vf log2(const vf x) noexcept {
+                const vi bits = O::as_int(x);
+                vf       e    = O::to_float(O::isub(O::iand(O::template shr<23>(bits), O::iset(0xFF)), O::iset(127)));
+                vf       m    = O::as_float(O::ior(O::iand(bits, O::iset(0x007FFFFFu)), O::iset(0x3F800000u)));
+                const vf hi   = O::gt(m, k(std::numbers::sqrt2_v<float>));
+                m             = O::select(hi, O::mul(m, k(0.5f)), m);
+                e             = O::select(hi, O::add(e, k(1.0f)), e);
+                const vf t    = O::div(O::sub(m, k(1.0f)), O::add(m, k(1.0f)));
+                const vf t2   = O::mul(t, t);
+                vf       p    = k(2.0f / 9.0f);
+                p             = madd(t2, p, k(2.0f / 7.0f));
+                p             = madd(t2, p, k(2.0f / 5.0f));
+                p             = madd(t2, p, k(2.0f / 3.0f));
+                p             = madd(t2, p, k(2.0f));
+                return madd(O::mul(t, p), k(std::numbers::log2e_v<float>), e);
+            }
+
+            static vf exp2(vf y) noexcept {
+                y           = O::min(O::max(y, k(-126.0f)), k(126.0f));
+                const vi n  = O::round_to_int(y);
+                const vf f  = O::mul(O::sub(y, O::to_float(n)), k(std::numbers::ln2_v<float>));
+                vf       p  = k(1.0f / 5040.0f);
+                p           = madd(f, p, k(1.0f / 720.0f));
+                p           = madd(f, p, k(1.0f / 120.0f));
+                p           = madd(f, p, k(1.0f / 24.0f));
+                p           = madd(f, p, k(1.0f / 6.0f));
+                p           = madd(f, p, k(1.0f / 2.0f));
+                p           = madd(f, p, k(1.0f));
+                p           = madd(f, p, k(1.0f));
+                const vf sc = O::as_float(O::template shl<23>(O::iadd(n, O::iset(127))));
+                return O::mul(p, sc);
+            }
+
+            static vf pow(const vf x, const float y) noexcept {
+                return O::select(O::gt(x, k(0.0f)), exp2(O::mul(k(y), log2(x))), k(0.0f));
+            }
+
+            static vf cbrt(const vf x) noexcept {
+                const vf sign = O::bit_and(x, k(-0.0f));
+                const vf r    = exp2(O::mul(log2(abs(x)), k(1.0f / 3.0f)));
+                return O::select(O::eq(x, k(0.0f)), k(0.0f), O::bit_or(r, sign));
+            }
+
+            static vf atan_unit(const vf z) noexcept {
+                const vf z2 = O::mul(z, z);
+                vf       p  = k(-0.01172120f);
+                p           = madd(z2, p, k(0.05265332f));
+                p           = madd(z2, p, k(-0.11643287f));
+                p           = madd(z2, p, k(0.19354346f));
+                p           = madd(z2, p, k(-0.33262347f));
+                p           = madd(z2, p, k(0.99997726f));
+                return O::mul(z, p);
+            }
+
+            static vf atan2_turns(const vf y, const vf x) noexcept {
+                constexpr float pi = std::numbers::pi_v<float>;
+                const vf        ax = abs(x);
+                const vf        ay = abs(y);
+                const vf        mx = O::max(ax, ay);
+                const vf        mn = O::min(ax, ay);
+                const vf        nz = O::gt(mx, k(0.0f));
+                vf              a  = atan_unit(O::select(nz, O::div(mn, O::select(nz, mx, k(1.0f))), k(0.0f)));
+                a                  = O::select(O::gt(ay, ax), O::sub(k(pi * 0.5f), a), a);
+                a                  = O::select(O::lt(x, k(0.0f)), O::sub(k(pi), a), a);
+                a                  = O::select(O::lt(y, k(0.0f)), O::sub(k(0.0f), a), a);
+                const vf turns     = O::mul(a, k(0.5f / pi));
+                return O::select(O::lt(turns, k(0.0f)), O::add(turns, k(1.0f)), turns);
+            }
+
+            static vf sin_turns(vf u) noexcept {
+                u           = O::sub(u, O::to_float(O::round_to_int(u)));
+                u           = O::select(O::gt(u, k(0.25f)), O::sub(k(0.5f), u), u);
+                u           = O::select(O::lt(u, k(-0.25f)), O::sub(k(-0.5f), u), u);
+                const vf x  = O::mul(u, k(2.0f * std::numbers::pi_v<float>));
+                const vf x2 = O::mul(x, x);
+                vf       p  = k(-1.0f / 39916800.0f);
+                p           = madd(x2, p, k(1.0f / 362880.0f));
+                p           = madd(x2, p, k(-1.0f / 5040.0f));
+                p           = madd(x2, p, k(1.0f / 120.0f));
+                p           = madd(x2, p, k(-1.0f / 6.0f));
+                p           = madd(x2, p, k(1.0f));
+                return O::mul(x, p);
+            }
+
+            static vf srgb_to_linear(const vf c) noexcept {
+                const vf lo = O::mul(c, k(1.0f / 12.92f));
+                const vf hi = pow(O::mul(O::add(c, k(0.055f)), k(1.0f / 1.055f)), 2.4f);
+                return O::select(O::le(c, k(0.04045f)), lo, hi);
+            }
+
+            static vf linear_to_srgb(const vf c) noexcept {
+                const vf lo = O::mul(c, k(12.92f));
+                const vf hi = O::sub(O::mul(k(1.055f), pow(c, 1.0f / 2.4f)), k(0.055f));
+                return O::select(O::le(c, k(0.0031308f)), lo, hi);
+            }
+
+            static void rgb_to_hsv(vf &x, vf &y, vf &z) noexcept {
+                const vf mx = O::max(O::max(x, y), z);
+                const vf mn = O::min(O::min(x, y), z);
+                const vf d  = O::sub(mx, mn);
+                const vf nz = O::gt(d, k(0.0f));
+                const vf id = O::div(k(1.0f), O::select(nz, d, k(1.0f)));
+                const vf hr = O::mul(O::sub(y, z), id);
+                const vf hg = O::add(O::mul(O::sub(z, x), id), k(2.0f));
+                const vf hb = O::add(O::mul(O::sub(x, y), id), k(4.0f));
+                vf       h  = O::select(O::eq(mx, x), hr, O::select(O::eq(mx, y), hg, hb));
+                h           = O::mul(h, k(1.0f / 6.0f));
+                h           = O::select(O::lt(h, k(0.0f)), O::add(h, k(1.0f)), h);
+                const vf pv = O::gt(mx, k(0.0f));
+                x           = O::select(nz, h, k(0.0f));
+                y           = O::select(pv, O::div(d, O::select(pv, mx, k(1.0f))), k(0.0f));
+                z           = mx;
+            }
+
+            static void hsv_to_rgb(vf &x, vf &y, vf &z) noexcept {
+                const vf h6 = O::mul(clamp01(x), k(6.0f));
+                const vf vs = O::mul(z, y);
+                auto     f  = [&](const float n) {
+                    vf kk = O::add(k(n), h6);
+                    kk    = O::select(O::ge(kk, k(6.0f)), O::sub(kk, k(6.0f)), kk);
+                    return O::sub(z, O::mul(vs, clamp01(O::min(kk, O::sub(k(4.0f), kk)))));
+                };
+                const vf r = f(5.0f);
+                const vf g = f(3.0f);
+                const vf b = f(1.0f);
+                x          = r;
+                y          = g;
+                z          = b;
+            }
+
+            // out = m0 * a + m1 * b + m2 * c
+            static vf dot3(const float m0, const float m1, const float m2, const vf a, const vf b, const vf c) noexcept {
+                return O::add(O::add(O::mul(k(m0), a), O::mul(k(m1), b)), O::mul(k(m2), c));
+            }
+
+            static void linear_to_oklab(vf &x, vf &y, vf &z) noexcept {
+                const vf l = cbrt(dot3(0.4122214708f, 0.5363325363f, 0.0514459929f, x, y, z));
+                const vf m = cbrt(dot3(0.2119034982f, 0.6806995451f, 0.1073969566f, x, y, z));
+                const vf s = cbrt(dot3(0.0883024619f, 0.2817188376f, 0.6299787005f, x, y, z));
+                x          = dot3(0.2104542553f, 0.7936177850f, -0.0040720468f, l, m, s);
+                y          = dot3(1.9779984951f, -2.4285922050f, 0.4505937099f, l, m, s);
+                z          = dot3(0.0259040371f, 0.7827717662f, -0.8086757660f, l, m, s);
+            }
+
+            static void oklab_to_linear(vf &x, vf &y, vf &z) noexcept {
+                const vf l_ = dot3(1.0f, 0.3963377774f, 0.2158037573f, x, y, z);
+                const vf m_ = dot3(1.0f, -0.1055613458f, -0.0638541728f, x, y, z);
+                const vf s_ = dot3(1.0f, -0.0894841775f, -1.2914855480f, x, y, z);
+                const vf l  = O::mul(O::mul(l_, l_), l_);
+                const vf m  = O::mul(O::mul(m_, m_), m_);
+                const vf s  = O::mul(O::mul(s_, s_), s_);
+                x           = dot3(4.0767416621f, -3.3077115913f, 0.2309699292f, l, m, s);
+                y           = dot3(-1.2684380046f, 2.6097574011f, -0.3413193965f, l, m, s);
+                z           = dot3(-0.0041960863f, -0.7034186147f, 1.7076147010f, l, m, s);
+            }
+
+            static void oklab_to_oklch(vf & /*x*/, vf &y, vf &z) noexcept {
+                const vf sq = madd(y, y, O::mul(z, z));
+                const vf c  = O::select(O::gt(sq, k(0.0f)), O::sqrt(sq), k(0.0f));
+                z           = atan2_turns(z, y);
+                y           = c;
+            }
+
+            static void oklch_to_oklab(vf & /*x*/, vf &y, vf &z) noexcept {
+                const vf c = y;
+                y          = O::mul(c, sin_turns(O::add(z, k(0.25f))));
+                z          = O::mul(c, sin_turns(z));
+            }
+        };
+
+        using batch = kernels<simd_ops>;
+
+        constexpr std::size_t simd_width = simd_ops::width;
+#else
+        constexpr std::size_t simd_width = 0;
+#endif
+
+        // ============================================================================
+        // Drivers - full SIMD blocks, then the scalar reference for the tail
+        // ============================================================================
+
+        // Apply a three-channel in-place kernel over x/y/z; alpha is never touched.
+        template<typename VecFn, typename ScalarFn>
+        void for_each_xyz(const float4_soa &c, [[maybe_unused]] VecFn &&vec, ScalarFn &&scalar) noexcept {
+            const std::size_t n = std::min({c.x.size(), c.y.size(), c.z.size()});
+            std::size_t       i = 0;
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+            for (; i + simd_width <= n; i += simd_width) {
+                auto x = simd_ops::load(&c.x[i]);
+                auto y = simd_ops::load(&c.y[i]);
+                auto z = simd_ops::load(&c.z[i]);
+                vec(x, y, z);
+                simd_ops::store(&c.x[i], x);
+                simd_ops::store(&c.y[i], y);
+                simd_ops::store(&c.z[i], z);
+            }
+#endif
+            for (; i < n; i++) {
+                const ImVec4 out = scalar(ImVec4{c.x[i], c.y[i], c.z[i], 0.0f});
+                c.x[i]           = out.x;
+                c.y[i]           = out.y;
+                c.z[i]           = out.z;
+            }
+        }
+
+        // Apply a per-channel kernel over one span.
+        template<typename VecFn, typename ScalarFn>
+        void for_each_channel(const std::span<float> ch, [[maybe_unused]] VecFn &&vec, ScalarFn &&scalar) noexcept {
+            const std::size_t n = ch.size();
+            std::size_t       i = 0;
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+            for (; i + simd_width <= n; i += simd_width)
+                simd_ops::store(&ch[i], vec(simd_ops::load(&ch[i])));
+#endif
+            for (; i < n; i++)
+                ch[i] = scalar(ch[i]);
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // Public entry points
+    // ============================================================================
+
+    std::string_view batch_backend() noexcept {
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+        return simd_ops::name;
+#else
+        return "scalar";
+#endif
+    }
+
+    void unpack_u32(const std::span<const ImU32> in, const float4_soa &out) noexcept {
+        const std::size_t n = std::min({in.size(), out.x.size(), out.y.size(), out.z.size(), out.w.size()});
+        std::size_t       i = 0;
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+        using O              = simd_ops;
+        const auto inv       = O::set(1.0f / 255.0f);
+        const auto byte_mask = O::iset(0xFF);
+        for (; i + simd_width <= n; i += simd_width) {
+            const auto v = O::load_u32(&in[i]);
+            O::store(&out.x[i], O::mul(O::to_float(O::iand(O::template shr<IM_COL32_R_SHIFT>(v), byte_mask)), inv));
+            O::store(&out.y[i], O::mul(O::to_float(O::iand(O::template shr<IM_COL32_G_SHIFT>(v), byte_mask)), inv));
+            O::store(&out.z[i], O::mul(O::to_float(O::iand(O::template shr<IM_COL32_B_SHIFT>(v), byte_mask)), inv));
+            O::store(&out.w[i], O::mul(O::to_float(O::iand(O::template shr<IM_COL32_A_SHIFT>(v), byte_mask)), inv));
+        }
+#endif
+        for (; i < n; i++) {
+            const ImVec4 c = u32_to_float4(in[i]);
+            out.x[i]       = c.x;
+            out.y[i]       = c.y;
+            out.z[i]       = c.z;
+            out.w[i]       = c.w;
+        }
+    }
+
+    void pack_u32(const float4_soa &in, const std::span<ImU32> out) noexcept {
+        const std::size_t n = std::min({out.size(), in.x.size(), in.y.size(), in.z.size(), in.w.size()});
+        std::size_t       i = 0;
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+        using O       = simd_ops;
+        auto quantize = [](const O::vf v) {
+            return O::trunc_to_int(batch::madd(batch::clamp01(v), O::set(255.0f), O::set(0.5f)));
+        };
+        for (; i + simd_width <= n; i += simd_width) {
+            const auto r = O::template shl<IM_COL32_R_SHIFT>(quantize(O::load(&in.x[i])));
+            const auto g = O::template shl<IM_COL32_G_SHIFT>(quantize(O::load(&in.y[i])));
+            const auto b = O::template shl<IM_COL32_B_SHIFT>(quantize(O::load(&in.z[i])));
+            const auto a = O::template shl<IM_COL32_A_SHIFT>(quantize(O::load(&in.w[i])));
+            O::store_u32(&out[i], O::ior(O::ior(r, g), O::ior(b, a)));
+        }
+#endif
+        for (; i < n; i++)
+            out[i] = float4_to_u32(ImVec4{in.x[i], in.y[i], in.z[i], in.w[i]});
+    }
+
+#if defined(IMGUI_UTIL_COLOR_BATCH_AVX2) || defined(IMGUI_UTIL_COLOR_BATCH_SSE2)
+#define IMGUI_UTIL_BATCH_CH(fn) [](const auto v) { return batch::fn(v); }
+#define IMGUI_UTIL_BATCH_XYZ(fn) [](auto &x, auto &y, auto &z) { batch::fn(x, y, z); }
+#else
+#define IMGUI_UTIL_BATCH_CH(fn) [](const float v) { return v; }
+#define IMGUI_UTIL_BATCH_XYZ(fn) [](float &, float &, float &) {}
+#endif
+
+    void srgb_to_linear(const std::span<float> channel) noexcept {
+        for_each_channel(channel, IMGUI_UTIL_BATCH_CH(srgb_to_linear),
+                         [](const float v) { return srgb_to_linear(v); });
+    }
+
+    void linear_to_srgb(const std::span<float> channel) noexcept {
+        for_each_channel(channel, IMGUI_UTIL_BATCH_CH(linear_to_srgb),
+                         [](const float v) { return linear_to_srgb(v); });
+    }
+
+    void srgb_to_linear(const float4_soa &colors) noexcept {
+        srgb_to_linear(colors.x);
+        srgb_to_linear(colors.y);
+        srgb_to_linear(colors.z);
+    }
+
+    void linear_to_srgb(const float4_soa &colors) noexcept {
+        linear_to_srgb(colors.x);
+        linear_to_srgb(colors.y);
+        linear_to_srgb(colors.z);
+    }
+
+    void rgb_to_hsv(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(rgb_to_hsv), [](const ImVec4 &c) { return rgb_to_hsv(c); });
+    }
+
+    void hsv_to_rgb(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(hsv_to_rgb), [](const ImVec4 &c) { return hsv_to_rgb(c); });
+    }
+
+    void linear_to_oklab(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(linear_to_oklab), [](const ImVec4 &c) { return linear_to_oklab(c); });
+    }
+
+    void oklab_to_linear(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(oklab_to_linear), [](const ImVec4 &c) { return oklab_to_linear(c); });
+    }
+
+    void oklab_to_oklch(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(oklab_to_oklch), [](const ImVec4 &c) { return oklab_to_oklch(c); });
+    }
+
+    void oklch_to_oklab(const float4_soa &colors) noexcept {
+        for_each_xyz(colors, IMGUI_UTIL_BATCH_XYZ(oklch_to_oklab), [](const ImVec4 &c) { return oklch_to_oklab(c); });
+    }
+
+#undef IMGUI_UTIL_BATCH_CH
+#undef IMGUI_UTIL_BATCH_XYZ
+
+} // namespace imgui_util::color
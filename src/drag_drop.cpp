@@ -0,0 +1,38 @@
+#include "imgui_util/widgets/drag_drop.hpp"
+
+#include <cstring>
+#include <imgui_internal.h>
+
+#include "imgui_util/core/context_state.hpp"
+
+namespace imgui_util::drag_drop {
+
+    namespace {
+
+        // NewFramePost: ImGui has already cleared a delivered or abandoned drag, so anything
+        // not carried by the payload still active in ctx is released.
+        void sweep(ImGuiContext &ctx, payload_registry &registry) {
+            std::optional<payload_handle> keep;
+            if (const ImGuiPayload &p = ctx.DragDropPayload;
+                ctx.DragDropActive && p.Data != nullptr && p.DataSize == sizeof(payload_handle)) {
+                payload_handle h;
+                std::memcpy(&h, p.Data, sizeof(h));
+                if (registry.carried_by(h, p.DataType)) keep = h;
+            }
+            registry.release_except(keep);
+        }
+
+        detail::context_state<payload_registry> &registries() {
+            static detail::context_state<payload_registry> s{&sweep, ImGuiContextHookType_NewFramePost};
+            return s;
+        }
+
+    } // namespace
+
+    payload_registry &payload_registry::instance() {
+        if (ImGuiContext *ctx = ImGui::GetCurrentContext()) return registries().get(*ctx);
+        static payload_registry detached; // no context: never swept, nothing can be dragged anyway
+        return detached;
+    }
+
+} // namespace imgui_util::drag_drop
@@ -0,0 +1,319 @@
+#include "imgui_util/plot/heatmap_tiles.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include "imgui_util/theme/color_batch.hpp"
+
+namespace imgui_util::implot {
+
+    // ============================================================================
+    // Texture backends and colormap
+    // ============================================================================
+
+    namespace {
+
+        // ImTextureID is a pointer or an integer depending on the ImGui configuration.
+        template<typename Id>
+        Id texture_id(const std::uintptr_t id) noexcept {
+            if constexpr (std::is_pointer_v<Id>) return reinterpret_cast<Id>(id); // NOLINT
+            else return static_cast<Id>(id);
+        }
+
+    } // namespace
+
+    texture_backend null_texture_backend() {
+        auto next = std::make_shared<std::uintptr_t>(0);
+        return {
+            [next](const ImU32 *, int, int) { return texture_id<ImTextureID>(++*next); },
+            [](ImTextureID) {},
+        };
+    }
+
+    // Keys go through the batch kernels to OKLab, are interpolated there (perceptually even
+    // steps, no muddy midpoints), and come back the same way.
+    colormap_lut::colormap_lut(const std::span<const ImU32> keys) {
+        if (keys.empty()) return;
+        const std::size_t  n = keys.size();
+        std::vector<float> ch(4 * std::max(n, size));
+        const auto         soa = [&](const std::size_t count) {
+            return color::float4_soa{{ch.data(), count}, {ch.data() + count, count}, {ch.data() + 2 * count, count},
+                                     {ch.data() + 3 * count, count}};
+        };
+
+        const color::float4_soa k = soa(n);
+        color::unpack_u32(keys, k);
+        color::srgb_to_linear(k);
+        color::linear_to_oklab(k);
+        const std::vector<float> lab(ch.begin(), ch.begin() + static_cast<std::ptrdiff_t>(4 * n));
+
+        const color::float4_soa out = soa(size);
+        for (std::size_t i = 0; i < size; i++) {
+            const float       pos = static_cast<float>(i) * static_cast<float>(n - 1) / static_cast<float>(size - 1);
+            const std::size_t a   = std::min(static_cast<std::size_t>(pos), n - 1);
+            const std::size_t b   = std::min(a + 1, n - 1);
+            const float       f   = pos - static_cast<float>(a);
+            out.x[i]              = lab[a] + (lab[b] - lab[a]) * f;
+            out.y[i]              = lab[n + a] + (lab[n + b] - lab[n + a]) * f;
+            out.z[i]              = lab[2 * n + a] + (lab[2 * n + b] - lab[2 * n + a]) * f;
+            out.w[i]              = lab[3 * n + a] + (lab[3 * n + b] - lab[3 * n + a]) * f;
+        }
+        color::oklab_to_linear(out);
+        color::linear_to_srgb(out);
+        color::pack_u32(out, colors_);
+    }
+
+    // ============================================================================
+    // Rasterizer
+    // ============================================================================
+
+    std::pair<int, int> rasterize_tile(const heatmap_source &src, const tile_key &key, const int tile_px,
+                                       const colormap_lut &lut, std::vector<ImU32> &out) {
+        const int block = 1 << key.level;
+        const int span  = tile_px * block; // cells per tile side
+        const int c0    = key.tx * span;
+        const int r0    = key.ty * span;
+        const int c1    = std::min(src.cols, c0 + span);
+        const int r1    = std::min(src.rows, r0 + span);
+        if (c0 >= c1 || r0 >= r1) {
+            out.clear();
+            return {0, 0};
+        }
+        const int w = (c1 - c0 + block - 1) / block;
+        const int h = (r1 - r0 + block - 1) / block;
+        out.assign(static_cast<std::size_t>(w) * static_cast<std::size_t>(h), 0);
+
+        const double range = src.scale_max - src.scale_min;
+        const double inv   = range != 0.0 ? 1.0 / range : 0.0;
+        for (int py = 0; py < h; py++) {
+            const int y0 = r0 + py * block;
+            const int y1 = std::min(r1, y0 + block);
+            for (int px = 0; px < w; px++) {
+                const int x0  = c0 + px * block;
+                const int x1  = std::min(c1, x0 + block);
+                double    sum = 0.0;
+                int       n   = 0;
+                for (int y = y0; y < y1; y++) {
+                    const float *row = src.values.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(src.cols);
+                    for (int x = x0; x < x1; x++) {
+                        if (std::isnan(row[x])) continue;
+                        sum += row[x];
+                        n++;
+                    }
+                }
+                if (n == 0) continue; // transparent
+                const double t = (sum / n - src.scale_min) * inv;
+                out[static_cast<std::size_t>(py) * static_cast<std::size_t>(w) + static_cast<std::size_t>(px)] =
+                    lut(static_cast<float>(t));
+            }
+        }
+        return {w, h};
+    }
+
+    // ============================================================================
+    // tiled_heatmap
+    // ============================================================================
+
+    tiled_heatmap::tiled_heatmap(texture_backend backend, const colormap_lut &lut) :
+        tiled_heatmap(std::move(backend), lut, options{}) {}
+
+    tiled_heatmap::tiled_heatmap(texture_backend backend, const colormap_lut &lut, const options &opts) :
+        backend_(std::move(backend)), lut_(lut), opts_(opts) {
+        opts_.tile_px = std::max(opts_.tile_px, 1);
+        for (int i = 0; i < std::max(opts_.workers, 1); i++)
+            workers_.emplace_back([this](const std::stop_token &stop) { work(stop); });
+    }
+
+    tiled_heatmap::~tiled_heatmap() {
+        for (auto &w: workers_) w.request_stop();
+        workers_.clear(); // join before the textures and state go away
+        for (const auto &[key, t]: tiles_)
+            if (t.ready && backend_.destroy) backend_.destroy(t.texture);
+    }
+
+    void tiled_heatmap::set_data(const std::span<const float> values, const int rows, const int cols,
+                                 const double scale_min, const double scale_max, const ImPlotPoint &bounds_min,
+                                 const ImPlotPoint &bounds_max) {
+        {
+            std::unique_lock lock{mutex_};
+            queue_.clear();
+            done_.clear();
+            ++generation_;
+            idle_cv_.wait(lock, [&] { return busy_ == 0; }); // workers may still read the old grid
+            src_ = {values.first(std::min(values.size(), static_cast<std::size_t>(std::max(rows, 0)) *
+                                                             static_cast<std::size_t>(std::max(cols, 0)))),
+                    rows, cols, scale_min, scale_max};
+        }
+        bounds_min_ = bounds_min;
+        bounds_max_ = bounds_max;
+        for (const auto &[key, t]: tiles_)
+            if (t.ready && backend_.destroy) backend_.destroy(t.texture);
+        tiles_.clear();
+    }
+
+    int tiled_heatmap::max_level() const noexcept {
+        const int cells = std::max(src_.rows, src_.cols);
+        int       level = 0;
+        while ((opts_.tile_px << level) < cells) level++;
+        return level;
+    }
+
+    int tiled_heatmap::level_for(const heatmap_view &view) const noexcept {
+        if (src_.rows <= 0 || src_.cols <= 0) return 0;
+        const double cell_w = (bounds_max_.x - bounds_min_.x) / src_.cols;
+        const double cell_h = (bounds_max_.y - bounds_min_.y) / src_.rows;
+        const double per_px = std::max((view.x_max - view.x_min) / cell_w / std::max(view.pixel_width, 1),
+                                       (view.y_max - view.y_min) / cell_h / std::max(view.pixel_height, 1));
+        if (!(per_px >= 2.0)) return 0;
+        const int level = static_cast<int>(std::bit_width(static_cast<std::uint64_t>(per_px))) - 1;
+        return std::min(level, max_level());
+    }
+
+    std::pair<int, int> tiled_heatmap::tile_extent(const int level, const int tx, const int ty) const noexcept {
+        const int span = opts_.tile_px << level;
+        return {std::min(src_.cols, (tx + 1) * span) - tx * span, std::min(src_.rows, (ty + 1) * span) - ty * span};
+    }
+
+    tile_draw tiled_heatmap::placement(const tile_key &key, const ImTextureID texture) const noexcept {
+        const auto [cw, ch] = tile_extent(key.level, key.tx, key.ty);
+        const int    span   = opts_.tile_px << key.level;
+        const double cell_w = (bounds_max_.x - bounds_min_.x) / src_.cols;
+        const double cell_h = (bounds_max_.y - bounds_min_.y) / src_.rows;
+        const double x0     = bounds_min_.x + key.tx * span * cell_w;
+        const double y_top  = bounds_max_.y - key.ty * span * cell_h;
+        return {texture, ImPlotPoint(x0, y_top - ch * cell_h), ImPlotPoint(x0 + cw * cell_w, y_top)};
+    }
+
+    void tiled_heatmap::collect_finished() {
+        std::vector<result> finished;
+        {
+            const std::scoped_lock lock{mutex_};
+            finished.swap(done_);
+        }
+        for (result &r: finished) {
+            const auto it = tiles_.find(r.key);
+            if (it == tiles_.end() || it->second.ready) continue;
+            it->second.texture = backend_.create ? backend_.create(r.pixels.data(), r.width, r.height) : ImTextureID{};
+            it->second.ready   = true;
+            uploads_++;
+        }
+    }
+
+    std::span<const tile_draw> tiled_heatmap::prepare(const heatmap_view &view) {
+        frame_++;
+        draws_.clear();
+        collect_finished();
+        if (src_.rows <= 0 || src_.cols <= 0 || src_.values.empty()) return draws_;
+
+        const int    level  = level_for(view);
+        const int    span   = opts_.tile_px << level;
+        const double cell_w = (bounds_max_.x - bounds_min_.x) / src_.cols;
+        const double cell_h = (bounds_max_.y - bounds_min_.y) / src_.rows;
+        auto         cells  = [](const double v, const int n) { return std::clamp(static_cast<int>(std::floor(v)), 0, n); };
+        const int    c0     = cells((view.x_min - bounds_min_.x) / cell_w, src_.cols);
+        const int    c1     = cells(std::ceil((view.x_max - bounds_min_.x) / cell_w), src_.cols);
+        const int    r0     = cells((bounds_max_.y - view.y_max) / cell_h, src_.rows);
+        const int    r1     = cells(std::ceil((bounds_max_.y - view.y_min) / cell_h), src_.rows);
+        if (c0 >= c1 || r0 >= r1) return draws_;
+
+        std::vector<tile_key> ready;
+        std::vector<tile_key> stand_ins;
+        std::vector<job>      missing;
+        for (int ty = r0 / span; ty <= (r1 - 1) / span; ty++) {
+            for (int tx = c0 / span; tx <= (c1 - 1) / span; tx++) {
+                const tile_key key{level, tx, ty};
+                auto [it, inserted]  = tiles_.try_emplace(key);
+                it->second.last_used = frame_;
+                if (it->second.ready) {
+                    ready.push_back(key);
+                    continue;
+                }
+                if (inserted) missing.push_back({key, 0});
+                // Nearest finished ancestor covers this tile until it arrives.
+                for (tile_key up = key; up.level < max_level();) {
+                    up = {up.level + 1, up.tx / 2, up.ty / 2};
+                    if (const auto p = tiles_.find(up); p != tiles_.end() && p->second.ready) {
+                        p->second.last_used = frame_;
+                        stand_ins.push_back(up);
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!missing.empty()) {
+            {
+                const std::scoped_lock lock{mutex_};
+                for (job &j: missing) {
+                    j.generation = generation_;
+                    queue_.push_back(j);
+                }
+            }
+            work_cv_.notify_all();
+        }
+
+        std::ranges::sort(stand_ins);
+        const auto [first, last] = std::ranges::unique(stand_ins);
+        stand_ins.erase(first, last);
+        for (const tile_key &k: stand_ins) draws_.push_back(placement(k, tiles_.at(k).texture)); // underneath
+        for (const tile_key &k: ready) draws_.push_back(placement(k, tiles_.at(k).texture));
+        evict();
+        return draws_;
+    }
+
+    // Drop least recently used finished tiles beyond max_tiles; never ones used this frame.
+    void tiled_heatmap::evict() {
+        if (tiles_.size() <= opts_.max_tiles) return;
+        std::vector<std::pair<std::uint64_t, tile_key>> candidates;
+        for (const auto &[key, t]: tiles_)
+            if (t.ready && t.last_used != frame_) candidates.emplace_back(t.last_used, key);
+        std::ranges::sort(candidates);
+        for (const auto &[used, key]: candidates) {
+            if (tiles_.size() <= opts_.max_tiles) break;
+            if (backend_.destroy) backend_.destroy(tiles_.at(key).texture);
+            tiles_.erase(key);
+        }
+    }
+
+    void tiled_heatmap::wait_idle() {
+        std::unique_lock lock{mutex_};
+        idle_cv_.wait(lock, [&] { return queue_.empty() && busy_ == 0; });
+    }
+
+    // ============================================================================
+    // Worker thread
+    // ============================================================================
+
+    void tiled_heatmap::work(const std::stop_token &stop) {
+        std::vector<ImU32> pixels;
+        while (true) {
+            job            j;
+            heatmap_source src;
+            {
+                std::unique_lock lock{mutex_};
+                if (!work_cv_.wait(lock, stop, [&] { return !queue_.empty(); })) return;
+                j = queue_.front();
+                queue_.pop_front();
+                if (j.generation != generation_) {
+                    idle_cv_.notify_all();
+                    continue;
+                }
+                src = src_;
+                busy_++;
+            }
+
+            const auto [w, h] = rasterize_tile(src, j.key, opts_.tile_px, lut_, pixels);
+
+            {
+                const std::scoped_lock lock{mutex_};
+                busy_--;
+                if (j.generation == generation_) done_.push_back({j.key, j.generation, std::move(pixels), w, h});
+            }
+            idle_cv_.notify_all();
+        }
+    }
+
+} // namespace imgui_util::implot
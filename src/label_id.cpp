@@ -0,0 +1,34 @@
+#include "imgui_util/core/label_id.hpp"
+
+#include <imgui_internal.h>
+
+namespace imgui_util {
+
+    // Each function mirrors its ImGui string-label counterpart with window->GetID(label)
+    // replaced by the precomputed label_id::id(seed).
+
+    ImGuiID get_id(const label_id label) noexcept { return label.id(ImGui::GetCurrentWindowRead()->IDStack.back()); }
+
+    namespace detail {
+
+        void push_id(const label_id label) noexcept { ImGui::PushOverrideID(get_id(label)); }
+
+        bool begin_child(const label_id label, const ImVec2 &size, const ImGuiChildFlags child_flags,
+                         const ImGuiWindowFlags window_flags) noexcept {
+            return ImGui::BeginChildEx(label.c_str(), get_id(label), size, child_flags, window_flags);
+        }
+
+        bool tree_node(const label_id label, const ImGuiTreeNodeFlags flags) noexcept {
+            ImGuiWindow *window = ImGui::GetCurrentWindow();
+            if (window->SkipItems) return false;
+            return ImGui::TreeNodeBehavior(label.id(window->IDStack.back()), flags, label.c_str(), nullptr);
+        }
+
+        bool begin_table(const label_id label, const int columns, const ImGuiTableFlags flags,
+                         const ImVec2 &outer_size, const float inner_width) noexcept {
+            return ImGui::BeginTableEx(label.c_str(), get_id(label), columns, flags, outer_size, inner_width);
+        }
+
+    } // namespace detail
+
+} // namespace imgui_util
@@ -0,0 +1,135 @@
+#include "imgui_util/core/parse.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define IMGUI_UTIL_PARSE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMGUI_UTIL_PARSE_SSE2 1
+#endif
+
+namespace imgui_util::parse {
+
+    namespace {
+
+        // ============================================================================
+        // ISA wrappers - one 32-bit separator mask per 32 input bytes
+        // ============================================================================
+
+#if defined(IMGUI_UTIL_PARSE_AVX2)
+        struct simd_ops {
+            static constexpr std::string_view name = "avx2";
+
+            static __m256i eq(const __m256i v, const char c) noexcept { return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)); }
+
+            static std::uint32_t mask32(const char *p, const char delim) noexcept {
+                const __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); // NOLINT
+                const __m256i ws = _mm256_or_si256(_mm256_or_si256(eq(v, ' '), eq(v, '\t')),
+                                                   _mm256_or_si256(eq(v, '\r'), eq(v, '\n')));
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(ws, eq(v, delim))));
+            }
+            static void line_masks32(const char *p, std::uint32_t &nl, std::uint32_t &es) noexcept {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); // NOLINT
+                nl              = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq(v, '\n')));
+                es              = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq(v, '=')));
+            }
+        };
+#elif defined(IMGUI_UTIL_PARSE_SSE2)
+        struct simd_ops {
+            static constexpr std::string_view name = "sse2";
+
+            static __m128i eq(const __m128i v, const char c) noexcept { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+
+            static std::uint32_t mask16(const char *p, const char delim) noexcept {
+                const __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); // NOLINT
+                const __m128i ws = _mm_or_si128(_mm_or_si128(eq(v, ' '), eq(v, '\t')),
+                                                _mm_or_si128(eq(v, '\r'), eq(v, '\n')));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(ws, eq(v, delim))));
+            }
+            // Two 16-byte halves per 32-byte word
+            static std::uint32_t mask32(const char *p, const char delim) noexcept {
+                return mask16(p, delim) | mask16(p + 16, delim) << 16;
+            }
+            static std::uint32_t match32(const __m128i lo, const __m128i hi, const char c) noexcept {
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(eq(lo, c)))
+                       | static_cast<std::uint32_t>(_mm_movemask_epi8(eq(hi, c))) << 16;
+            }
+            static void line_masks32(const char *p, std::uint32_t &nl, std::uint32_t &es) noexcept {
+                const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));      // NOLINT
+                const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16)); // NOLINT
+                nl               = match32(lo, hi, '\n');
+                es               = match32(lo, hi, '=');
+            }
+        };
+#endif
+
+        // Scalar reference for one (possibly partial) word; missing bytes count as separators.
+        std::uint32_t mask_scalar(const std::string_view bytes, const char delim) noexcept {
+            std::uint32_t m = 0;
+            for (std::size_t i = 0; i < 32; ++i)
+                if (i >= bytes.size() || detail::is_separator(bytes[i], delim)) m |= 1u << i;
+            return m;
+        }
+
+        void line_masks_scalar(const std::string_view bytes, std::uint32_t &nl, std::uint32_t &es) noexcept {
+            nl = 0;
+            es = 0;
+            for (std::size_t i = 0; i < bytes.size() && i < 32; ++i) {
+                if (bytes[i] == '\n') nl |= 1u << i;
+                else if (bytes[i] == '=') es |= 1u << i;
+            }
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // Public entry points
+    // ============================================================================
+
+    std::string_view scan_backend() noexcept {
+#if defined(IMGUI_UTIL_PARSE_AVX2) || defined(IMGUI_UTIL_PARSE_SSE2)
+        return simd_ops::name;
+#else
+        return "scalar";
+#endif
+    }
+
+    void detail::separator_bits(const std::string_view block, const char delim,
+                                const std::span<std::uint32_t> out) noexcept {
+        const std::size_t n = std::min(block.size(), out.size() * 32);
+        std::size_t       w = 0;
+#if defined(IMGUI_UTIL_PARSE_AVX2) || defined(IMGUI_UTIL_PARSE_SSE2)
+        for (; 32 * w + 32 <= n; ++w) out[w] = simd_ops::mask32(block.data() + 32 * w, delim);
+#endif
+        for (; 32 * w < n; ++w) out[w] = mask_scalar(block.substr(32 * w, 32), delim);
+    }
+
+    void detail::line_bits(const std::string_view block, const std::span<std::uint32_t> newlines,
+                           const std::span<std::uint32_t> equals) noexcept {
+        const std::size_t n = std::min(block.size(), std::min(newlines.size(), equals.size()) * 32);
+        std::size_t       w = 0;
+#if defined(IMGUI_UTIL_PARSE_AVX2) || defined(IMGUI_UTIL_PARSE_SSE2)
+        for (; 32 * w + 32 <= n; ++w) simd_ops::line_masks32(block.data() + 32 * w, newlines[w], equals[w]);
+#endif
+        for (; 32 * w < n; ++w) line_masks_scalar(block.substr(32 * w, 32), newlines[w], equals[w]);
+    }
+
+    // ============================================================================
+    // Files
+    // ============================================================================
+
+    std::optional<std::string> read_text_file(const std::filesystem::path &path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return std::nullopt;
+        const std::streamoff size = file.tellg();
+        if (size < 0) return std::nullopt;
+        std::string text(static_cast<std::size_t>(size), '\0');
+        file.seekg(0);
+        if (!file.read(text.data(), size)) return std::nullopt;
+        return text;
+    }
+
+} // namespace imgui_util::parse
@@ -0,0 +1,45 @@
+#include "imgui_util/widgets/text.hpp"
+
+#include <imgui_internal.h>
+
+#include "imgui_util/core/context_state.hpp"
+
+namespace imgui_util {
+
+    // Tables of the fonts one context used recently; few are active per frame, so the slots
+    // are reused round-robin.
+    struct glyph_advances::cache {
+        struct slot {
+            ImFont        *font  = nullptr;
+            float          size  = 0.0f;
+            int            frame = -1;
+            glyph_advances advances{};
+        };
+
+        std::array<slot, 4> slots;
+        std::size_t         next = 0;
+    };
+
+    const glyph_advances &glyph_advances::current() {
+        static detail::context_state<cache> caches;
+        cache &c = caches.get(*ImGui::GetCurrentContext());
+
+        ImFont     *font  = ImGui::GetFont();
+        const float size  = ImGui::GetFontSize();
+        const int   frame = ImGui::GetFrameCount(); // fonts only change between frames
+        for (cache::slot &s: c.slots) {
+            if (s.font != font || s.size != size) continue;
+            if (s.frame != frame) s.advances.rebuild(*font, size);
+            s.frame = frame;
+            return s.advances;
+        }
+        cache::slot &s = c.slots[c.next];
+        c.next         = (c.next + 1) % c.slots.size();
+        s.font         = font;
+        s.size         = size;
+        s.frame        = frame;
+        s.advances     = glyph_advances{*font, size};
+        return s.advances;
+    }
+
+} // namespace imgui_util
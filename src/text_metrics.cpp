@@ -0,0 +1,198 @@
+#include "imgui_util/core/text_metrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <imgui_internal.h>
+
+#include "imgui_util/core/context_state.hpp"
+
+namespace imgui_util {
+
+    namespace {
+
+        constexpr std::uint64_t mix(std::uint64_t h, const std::uint64_t v) noexcept {
+            h ^= v + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+            return h;
+        }
+
+        std::uint64_t ptr_bits(const void *p) noexcept { return reinterpret_cast<std::uintptr_t>(p); }
+
+        // FNV-1a over the text, then folded with font and size
+        std::uint64_t entry_key(const ImFont *font, const float size, const std::string_view text) noexcept {
+            std::uint64_t h = 0xCBF29CE484222325ull;
+            for (const char c: text) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+            return mix(mix(h, ptr_bits(font)), std::bit_cast<std::uint32_t>(size));
+        }
+
+        // Everything a rebuild, font addition or removal changes; never 0 for a real atlas.
+        std::uint64_t atlas_fingerprint(const ImFontAtlas &atlas) noexcept {
+            std::uint64_t h = mix(ptr_bits(&atlas), (static_cast<std::uint64_t>(atlas.TexWidth) << 32) |
+                                                        static_cast<std::uint32_t>(atlas.TexHeight));
+            h = mix(h, ptr_bits(atlas.TexPixelsAlpha8) ^ ptr_bits(atlas.TexPixelsRGBA32));
+            h = mix(h, static_cast<std::uint64_t>(atlas.Fonts.Size));
+            for (const ImFont *f: atlas.Fonts) {
+                h = mix(h, ptr_bits(f));
+                h = mix(h, std::bit_cast<std::uint32_t>(f->FontSize));
+                h = mix(h, std::bit_cast<std::uint32_t>(f->FallbackAdvanceX));
+                h = mix(h, ptr_bits(f->IndexAdvanceX.Data) ^ static_cast<std::uint64_t>(f->IndexAdvanceX.Size));
+                h = mix(h, static_cast<std::uint64_t>(f->Glyphs.Size));
+            }
+            return h | 1u;
+        }
+
+        text_metrics_cache &shared_cache() {
+            static text_metrics_cache cache;
+            return cache;
+        }
+
+        // Fingerprint of the context's atlas when last seen. Each context tracks its own, so
+        // contexts with different atlases sharing the cache don't clear it on every switch.
+        struct atlas_seen {
+            std::uint64_t fingerprint = 0;
+        };
+
+        // NewFramePre: entries are keyed by ImFont*, whose glyphs a rebuild may change in place.
+        // First sight clears too, since a new context's fonts may reuse a destroyed one's addresses.
+        void sync_atlas(ImGuiContext &ctx, atlas_seen &seen) {
+            if (ctx.IO.Fonts == nullptr) return;
+            const std::uint64_t fp = atlas_fingerprint(*ctx.IO.Fonts);
+            if (fp == seen.fingerprint) return;
+            seen.fingerprint = fp;
+            shared_cache().clear();
+        }
+
+        detail::context_state<atlas_seen> &synced_contexts() {
+            static detail::context_state<atlas_seen> s{&sync_atlas};
+            return s;
+        }
+
+    } // namespace
+
+    // ========================================================================
+    // text_metrics_cache
+    // ========================================================================
+
+    text_metrics_cache::text_metrics_cache(const std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1)) {
+        entries_.reserve(std::min<std::size_t>(capacity_, 256));
+        index_.reserve(std::min<std::size_t>(capacity_, 256));
+    }
+
+    ImVec2 text_metrics_cache::measure(ImFont *font, const float size, const std::string_view text) {
+        const std::uint64_t key = entry_key(font, size, text);
+        const auto          it  = index_.find(key);
+        if (it != index_.end()) {
+            entry &e = entries_[it->second];
+            if (e.font == font && e.size == size && e.text == text) {
+                ++hits_;
+                if (head_ != it->second) {
+                    unlink(it->second);
+                    push_front(it->second);
+                }
+                return e.extent;
+            }
+        }
+        ++misses_;
+
+        // Same result as ImGui::CalcTextSize(text): CalcTextSizeA, width rounded up to whole pixels
+        ImVec2 extent = font->CalcTextSizeA(size, FLT_MAX, 0.0f, text.data(), text.data() + text.size());
+        extent.x      = IM_TRUNC(extent.x + 0.99999f);
+
+        std::uint32_t slot = none;
+        if (it != index_.end()) {
+            slot = it->second; // hash collision: the newer text takes the entry
+            unlink(slot);
+        } else {
+            if (entries_.size() >= capacity_) evict_back();
+            slot = static_cast<std::uint32_t>(entries_.size());
+            entries_.emplace_back();
+            index_.emplace(key, slot);
+        }
+        entry &e = entries_[slot];
+        e.font   = font;
+        e.size   = size;
+        e.key    = key;
+        e.text.assign(text);
+        e.extent = extent;
+        push_front(slot);
+        return extent;
+    }
+
+    ImVec2 text_metrics_cache::measure(const std::string_view text) {
+        return measure(ImGui::GetFont(), ImGui::GetFontSize(), text);
+    }
+
+    bool text_metrics_cache::sync(const ImFontAtlas &atlas) noexcept {
+        const std::uint64_t fp = atlas_fingerprint(atlas);
+        if (fp == fingerprint_) return false;
+        fingerprint_ = fp;
+        clear();
+        return true;
+    }
+
+    void text_metrics_cache::clear() noexcept {
+        entries_.clear();
+        index_.clear();
+        head_ = none;
+        tail_ = none;
+    }
+
+    void text_metrics_cache::set_capacity(const std::size_t capacity) {
+        capacity_ = std::max<std::size_t>(capacity, 1);
+        while (entries_.size() > capacity_) evict_back();
+    }
+
+    text_metrics_cache &text_metrics_cache::instance() {
+        if (ImGuiContext *ctx = ImGui::GetCurrentContext(); ctx != nullptr && synced_contexts().find(*ctx) == nullptr)
+            sync_atlas(*ctx, synced_contexts().get(*ctx));
+        return shared_cache();
+    }
+
+    void text_metrics_cache::unlink(const std::uint32_t i) noexcept {
+        entry &e = entries_[i];
+        (e.prev != none ? entries_[e.prev].next : head_) = e.next;
+        (e.next != none ? entries_[e.next].prev : tail_) = e.prev;
+        e.prev = e.next = none;
+    }
+
+    void text_metrics_cache::push_front(const std::uint32_t i) noexcept {
+        entry &e = entries_[i];
+        e.prev   = none;
+        e.next   = head_;
+        if (head_ != none) entries_[head_].prev = i;
+        head_ = i;
+        if (tail_ == none) tail_ = i;
+    }
+
+    // Drop the least recently used entry; the last vector slot moves into its place.
+    void text_metrics_cache::evict_back() {
+        const std::uint32_t victim = tail_;
+        unlink(victim);
+        index_.erase(entries_[victim].key);
+        const auto last = static_cast<std::uint32_t>(entries_.size() - 1);
+        if (victim != last) {
+            entry &moved = entries_[last];
+            (moved.prev != none ? entries_[moved.prev].next : head_) = victim;
+            (moved.next != none ? entries_[moved.next].prev : tail_) = victim;
+            index_[moved.key]                                         = victim;
+            entries_[victim]                                          = std::move(moved);
+        }
+        entries_.pop_back();
+    }
+
+    // ========================================================================
+    // Cached text item
+    // ========================================================================
+
+    // TextUnformatted() for short single-run text, with the measurement from the shared cache.
+    void text_unformatted_cached(const std::string_view text) {
+        ImGuiWindow *window = ImGui::GetCurrentWindow();
+        if (window->SkipItems) return;
+        const ImVec2 size = calc_text_size(text);
+        const ImVec2 pos{window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset};
+        ImGui::ItemSize(size, 0.0f);
+        if (!ImGui::ItemAdd({pos, {pos.x + size.x, pos.y + size.y}}, 0)) return;
+        ImGui::RenderText(pos, text.data(), text.data() + text.size(), false);
+    }
+
+} // namespace imgui_util
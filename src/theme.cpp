@@ -43,7 +43,7 @@ namespace imgui_util::theme {
         ImGuiStyle &style = ImGui::GetStyle();
 
         // Style values via shared field map
-        for (const auto &[t_name, tptr, sptr]: style_float_map)
+        for (const auto &[t_name, tptr, sptr, svar]: style_float_map)
             style.*sptr = this->*tptr;
 
         // Copy all colors
@@ -66,7 +66,7 @@ namespace imgui_util::theme {
 
         // Capture ImGui style floats via shared field map
         const ImGuiStyle &style = ImGui::GetStyle();
-        for (const auto &[t_name, tptr, sptr]: style_float_map)
+        for (const auto &[t_name, tptr, sptr, svar]: style_float_map)
             theme.*tptr = style.*sptr;
 
         std::ranges::copy(std::span(style.Colors, ImGuiCol_COUNT), theme.colors.begin());
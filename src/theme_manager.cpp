@@ -13,6 +13,7 @@
 #include "imgui_util/core/parse.hpp"
 #include "imgui_util/core/raii.hpp"
 #include "imgui_util/theme/color_math.hpp"
+#include "imgui_util/theme/palette.hpp"
 
 #include "imgui_internal.h"
 
@@ -353,16 +354,58 @@ namespace imgui_util::theme {
     // theme_manager implementation
     // ============================================================================
 
+    // Log a message read_file() or the hot-reload watcher thread queued; UI thread only.
+    static void log_notice(const watch_notice &n) {
+        if (n.severity == watch_notice::level::error) Log::error("Theme", n.text);
+        else Log::warning("Theme", n.text);
+    }
+
     theme_manager::theme_manager() :
         current_theme_(theme_config::from_preset(theme_presets.at(0))), editing_theme_(current_theme_) {}
 
     void theme_manager::set_theme(theme_config theme) {
+        transition_.cancel();
         current_theme_ = std::move(theme);
         current_theme_.apply();
+        editing_theme_ = current_theme_;
         Log::info("Theme", "applied '", current_theme_.name, "'");
         if (on_theme_changed_) on_theme_changed_(current_theme_);
     }
 
+    void theme_manager::transition_to(theme_config theme, const float duration, const easing curve) {
+        if (duration <= 0.0f) {
+            set_theme(std::move(theme));
+            return;
+        }
+        // Retargeting mid-flight: start from what is on screen right now, not from current_theme_.
+        if (transition_.active()) {
+            current_theme_ = lerp(current_theme_, transition_target_, transition_.eased_progress());
+        }
+        transition_target_ = std::move(theme);
+        editing_theme_     = transition_target_; // the editor edits (and applies) where the style is heading
+        transition_.start(current_theme_, transition_target_, duration, curve);
+    }
+
+    void theme_manager::update(const float dt) {
+        if (watcher_) {
+            for (const watch_notice &n: watcher_->take_notices()) log_notice(n);
+            if (const std::shared_ptr<theme_config> reloaded = watcher_->take()) {
+                adopt_loaded(std::move(*reloaded));
+                Log::info("Theme", "reloaded '", current_theme_.name, "' from ", watcher_->path().c_str());
+            }
+        }
+        if (transition_.active() && !transition_.update(dt)) {
+            commit_theme(std::move(transition_target_));
+        }
+    }
+
+    // Adopt a theme whose values are already in the live style (end of a transition).
+    void theme_manager::commit_theme(theme_config theme) {
+        current_theme_ = std::move(theme);
+        Log::info("Theme", "transitioned to '", current_theme_.name, "'");
+        if (on_theme_changed_) on_theme_changed_(current_theme_);
+    }
+
     const theme_preset *theme_manager::find_preset(const std::string_view name) {
         const auto *it = std::ranges::find(theme_presets, name, &theme_preset::name);
         return it != theme_presets.end() ? it : nullptr;
@@ -432,11 +475,24 @@ namespace imgui_util::theme {
         return true;
     }
 
-    bool theme_manager::load_from_file(const std::filesystem::path &path) {
-        std::ifstream file(path);
-        if (!file.is_open()) {
-            Log::error("Theme", "load failed: could not open ", path.c_str());
-            return false;
+    std::optional<theme_config> theme_manager::read_file(const std::filesystem::path &path, theme_config base) {
+        watch_notices                     notes;
+        const std::optional<theme_config> loaded = read_file(path, std::move(base), notes);
+        for (const watch_notice &n: notes) log_notice(n);
+        return loaded;
+    }
+
+    // Touches no ImGui/ImNodes context state (GetStyleColorName is a static table) and does not
+    // log, so it is safe to call from the hot-reload watcher thread.
+    std::optional<theme_config> theme_manager::read_file(const std::filesystem::path &path, theme_config base,
+                                                         watch_notices &notices) {
+        const auto note = [&](const watch_notice::level severity, std::string text) {
+            notices.push_back({severity, std::move(text)});
+        };
+        const std::optional<std::string> text = parse::read_text_file(path);
+        if (!text) {
+            note(watch_notice::level::error, std::format("load failed: could not open {}", path.string()));
+            return std::nullopt;
         }
 
         // Build O(1) dispatch map for all known field keys.
@@ -474,28 +530,25 @@ namespace imgui_util::theme {
             return field_map_storage;
         }();
 
-        std::string  line;
         bool         version_found = false;
-        theme_config tmp           = current_theme_;
+        theme_config tmp           = std::move(base);
         try {
-            while (std::getline(file, line)) {
-                const size_t eq = line.find('=');
-                if (eq == std::string::npos) continue;
-
-                const std::string_view key(line.data(), eq);
-                const std::string_view value(line.data() + eq + 1, line.size() - eq - 1);
+            parse::for_each_config_entry(*text, [&](const parse::config_entry &entry) {
+                const std::string_view key   = entry.key;
+                const std::string_view value = entry.value;
 
                 if (key == "version") {
                     version_found = true;
                     if (const int v = parse::parse_int(value, -1); v != file_version) {
-                        Log::warning("Theme", "file version ", v, " differs from expected ", file_version);
+                        note(watch_notice::level::warning,
+                             std::format("file version {} differs from expected {}", v, file_version));
                     }
-                    continue;
+                    return;
                 }
 
                 if (key == "name") {
                     tmp.name = std::string(value);
-                    continue;
+                    return;
                 }
 
                 // O(1) dispatch for all known fields
@@ -521,7 +574,7 @@ namespace imgui_util::theme {
                             tmp.node_colors.at(idx) = parse::parse_u32(value);
                             break;
                     }
-                    continue;
+                    return;
                 }
 
                 // Backward compat: positional "color0=..." format
@@ -536,23 +589,58 @@ namespace imgui_util::theme {
                         tmp.node_colors.at(idx) = parse::parse_u32(value);
                     }
                 }
-            }
+            });
         } catch (const std::exception &e) {
-            Log::error("Theme", "load failed: parse error in ", path.c_str(), ": ", e.what());
-            return false;
+            note(watch_notice::level::error,
+                 std::format("load failed: parse error in {}: {}", path.string(), e.what()));
+            return std::nullopt;
         }
 
         if (!version_found) {
-            Log::warning("Theme", "no version line in ", path.c_str(), "; assuming version ", file_version);
+            note(watch_notice::level::warning,
+                 std::format("no version line in {}; assuming version {}", path.string(), file_version));
         }
 
-        current_theme_ = std::move(tmp);
-        current_theme_.apply();
-        editing_theme_ = current_theme_;
+        return tmp;
+    }
+
+    bool theme_manager::load_from_file(const std::filesystem::path &path) {
+        std::optional<theme_config> loaded = read_file(path, current_theme_);
+        if (!loaded) return false;
+        adopt_loaded(std::move(*loaded));
         Log::info("Theme", "loaded '", current_theme_.name, "' from ", path.c_str());
         return true;
     }
 
+    // Replace the current theme with one read from disk (explicit load or hot reload).
+    void theme_manager::adopt_loaded(theme_config theme) {
+        transition_.cancel();
+        current_theme_ = std::move(theme);
+        current_theme_.apply();
+        editing_theme_ = current_theme_;
+        if (on_theme_changed_) on_theme_changed_(current_theme_);
+    }
+
+    // ============================================================================
+    // Hot reload
+    // ============================================================================
+
+    void theme_manager::watch_file(const std::filesystem::path &path, const std::chrono::milliseconds debounce,
+                                   const watch_backend backend) {
+        // Fields missing from the file keep their values from the theme current at watch start.
+        watcher_ = std::make_unique<theme_file_watcher>(
+            path,
+            [base = current_theme_](const std::filesystem::path &p, watch_notices &notes) {
+                return read_file(p, base, notes);
+            },
+            debounce, backend);
+        Log::info("Theme", "watching ", path.c_str(), " for changes");
+    }
+
+    void theme_manager::stop_watching() {
+        watcher_.reset();
+    }
+
     void theme_manager::apply_preset(const std::string_view name, const theme_mode mode) {
         const auto *preset = find_preset(name);
         if (!preset) {
@@ -611,6 +699,7 @@ namespace imgui_util::theme {
         ImGui::Checkbox("Live Preview", &live_preview_);
         ImGui::SameLine();
         if (ImGui::Button("Apply")) {
+            transition_.cancel(); // a running transition would overwrite the applied style
             current_theme_ = editing_theme_;
             current_theme_.apply();
         }
@@ -620,6 +709,11 @@ namespace imgui_util::theme {
             if (live_preview_) editing_theme_.apply();
         }
         ImGui::SameLine();
+        if (ImGui::Button("Fix Contrast")) {
+            enforce_contrast(editing_theme_);
+            if (live_preview_) editing_theme_.apply();
+        }
+        ImGui::SameLine();
         if (ImGui::Button("Copy as C++ Preset")) {
             ImGui::SetClipboardText(generate_preset_code(editing_theme_).c_str());
         }
@@ -0,0 +1,162 @@
+#include "imgui_util/theme/theme_watcher.hpp"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#define IMGUI_UTIL_THEME_INOTIFY 1
+#endif
+
+namespace imgui_util::theme {
+
+    using clock_type = std::chrono::steady_clock;
+
+    theme_file_watcher::theme_file_watcher(std::filesystem::path path, parse_fn parse,
+                                           const std::chrono::milliseconds debounce, const watch_backend backend) :
+        path_(std::move(path)), parse_(std::move(parse)), debounce_(debounce), backend_(backend),
+        thread_([this](const std::stop_token &stop) { run(stop); }) {}
+
+    // ============================================================================
+    // Watcher thread
+    // ============================================================================
+
+    void theme_file_watcher::run(const std::stop_token &stop) {
+        if (backend_ == watch_backend::automatic && run_inotify(stop)) return;
+        run_polling(stop);
+    }
+
+    // Parse on this thread and publish; a newer result simply replaces an unconsumed older one.
+    void theme_file_watcher::reload() {
+        watch_notices               notes;
+        std::optional<theme_config> parsed = parse_(path_, notes);
+        if (!parsed) {
+            notes.push_back({watch_notice::level::warning,
+                             std::format("hot reload: keeping current theme, failed to parse {}", path_.string())});
+        }
+        post(std::move(notes));
+        if (!parsed) return;
+        pending_.store(std::make_shared<theme_config>(std::move(*parsed)));
+        reloads_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void theme_file_watcher::post(watch_notices notes) {
+        if (notes.empty()) return;
+        const std::scoped_lock lock{notices_mutex_};
+        std::ranges::move(notes, std::back_inserter(notices_));
+    }
+
+    void theme_file_watcher::mark_ready() noexcept {
+        ready_.store(true, std::memory_order_release);
+        ready_.notify_all();
+    }
+
+    // Returns false if inotify could not be set up (caller falls back to polling). Returns true
+    // once stopped; if the watched directory disappears mid-run it falls back to polling itself.
+    bool theme_file_watcher::run_inotify([[maybe_unused]] const std::stop_token &stop) {
+#ifdef IMGUI_UTIL_THEME_INOTIFY
+        const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) return false;
+
+        // Watch the directory, not the file: editors that save via write-temp-then-rename
+        // replace the inode, which would silently end a watch on the file itself.
+        std::filesystem::path dir = path_.parent_path();
+        if (dir.empty()) dir = ".";
+        if (inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF) < 0) {
+            close(fd);
+            return false;
+        }
+        inotify_.store(true, std::memory_order_relaxed);
+        mark_ready();
+
+        const std::string           name  = path_.filename().string();
+        bool                        dirty = false;
+        bool                        lost  = false;
+        clock_type::time_point      deadline{};
+        alignas(inotify_event) char buf[4096];
+
+        while (!stop.stop_requested() && !lost) {
+            int timeout_ms = static_cast<int>(poll_interval.count());
+            if (dirty) {
+                const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock_type::now());
+                timeout_ms      = static_cast<int>(std::clamp(left.count(), std::int64_t{0}, std::int64_t{timeout_ms}));
+            }
+
+            pollfd pfd{.fd = fd, .events = POLLIN, .revents = 0};
+            if (poll(&pfd, 1, timeout_ms) > 0 && (pfd.revents & POLLIN) != 0) {
+                ssize_t n;
+                while ((n = read(fd, buf, sizeof(buf))) > 0) {
+                    for (ssize_t off = 0; off < n;) {
+                        const auto *ev = reinterpret_cast<const inotify_event *>(buf + off); // NOLINT
+                        off += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+                        if ((ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) != 0) {
+                            lost = true;
+                        } else if (ev->len > 0 && name == ev->name) {
+                            dirty    = true;
+                            deadline = clock_type::now() + debounce_; // each event restarts the quiet period
+                        }
+                    }
+                }
+            }
+
+            if (dirty && clock_type::now() >= deadline) {
+                dirty = false;
+                reload();
+            }
+        }
+
+        close(fd);
+        inotify_.store(false, std::memory_order_relaxed);
+        if (lost && !stop.stop_requested()) {
+            post({{watch_notice::level::warning,
+                   std::format("hot reload: lost inotify watch on {}; falling back to polling", dir.string())}});
+            run_polling(stop);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void theme_file_watcher::run_polling(const std::stop_token &stop) {
+        struct file_stamp {
+            std::filesystem::file_time_type mtime{};
+            std::uintmax_t                  size   = 0;
+            bool                            exists = false;
+
+            bool operator==(const file_stamp &) const = default;
+        };
+        auto stamp = [&] {
+            std::error_code ec;
+            file_stamp      s;
+            s.mtime  = std::filesystem::last_write_time(path_, ec);
+            s.exists = !ec;
+            if (s.exists) s.size = std::filesystem::file_size(path_, ec);
+            return s;
+        };
+
+        file_stamp             last  = stamp();
+        bool                   dirty = false;
+        clock_type::time_point deadline{};
+        mark_ready();
+        while (!stop.stop_requested()) {
+            std::this_thread::sleep_for(dirty ? std::min(poll_interval, debounce_) : poll_interval);
+
+            if (const file_stamp now = stamp(); now != last) {
+                last     = now;
+                dirty    = now.exists;
+                deadline = clock_type::now() + debounce_;
+            }
+            if (dirty && clock_type::now() >= deadline) {
+                dirty = false;
+                reload();
+            }
+        }
+    }
+
+} // namespace imgui_util::theme
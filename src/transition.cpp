@@ -0,0 +1,161 @@
+#include "imgui_util/theme/transition.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define IMGUI_UTIL_TRANSITION_SSE 1
+#endif
+
+namespace imgui_util::theme {
+
+    using color::float4_to_u32;
+    using color::u32_to_float4;
+
+    namespace {
+
+        [[nodiscard]] bool vec4_equal(const ImVec4 &a, const ImVec4 &b) noexcept {
+            return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+        }
+
+        [[nodiscard]] ImVec4 vec4_sub(const ImVec4 &a, const ImVec4 &b) noexcept {
+            return {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
+        }
+
+        // out[i] = start[i] + delta[i] * t for n packed float4 lanes, scattered through write(i, value).
+        template<typename Write>
+        void lerp_lanes(const ImVec4 *start, const ImVec4 *delta, const int n, const float t, Write &&write) noexcept {
+#ifdef IMGUI_UTIL_TRANSITION_SSE
+            const __m128 tv = _mm_set1_ps(t);
+            for (int i = 0; i < n; ++i) {
+                const __m128 v = _mm_add_ps(_mm_load_ps(&start[i].x), _mm_mul_ps(_mm_load_ps(&delta[i].x), tv));
+                ImVec4       out;
+                _mm_storeu_ps(&out.x, v);
+                write(i, out);
+            }
+#else
+            for (int i = 0; i < n; ++i) {
+                write(i, ImVec4{start[i].x + delta[i].x * t, start[i].y + delta[i].y * t, start[i].z + delta[i].z * t,
+                                start[i].w + delta[i].w * t});
+            }
+#endif
+        }
+
+        // Write one theme_float_fields entry to its ImGuiStyle or ImNodesStyle destination.
+        void write_float(const std::size_t field, const float v, ImGuiStyle &style, ImNodesStyle *node_style) noexcept {
+            if (field < style_float_map.size()) {
+                style.*style_float_map[field].imgui_ptr = v;
+            } else if (node_style != nullptr) {
+                node_style->*node_style_float_map[field - style_float_map.size()].imnodes_ptr = v;
+            }
+        }
+
+        [[nodiscard]] ImNodesStyle *current_node_style() noexcept {
+            return ImNodes::GetCurrentContext() != nullptr ? &ImNodes::GetStyle() : nullptr;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // theme_transition::start - diff once, keep only the differing fields
+    // ============================================================================
+
+    void theme_transition::start(const theme_config &from, const theme_config &to, const float duration,
+                                 const easing curve) noexcept {
+        color_count_ = 0;
+        for (int i = 0; i < ImGuiCol_COUNT; i++) {
+            const ImVec4 &a = from.colors[i];
+            const ImVec4 &b = to.colors[i];
+            if (vec4_equal(a, b)) continue;
+            color_start_[color_count_] = a;
+            color_delta_[color_count_] = vec4_sub(b, a);
+            color_end_[color_count_]   = b;
+            color_idx_[color_count_]   = static_cast<std::uint8_t>(i);
+            ++color_count_;
+        }
+
+        node_count_ = 0;
+        for (int i = 0; i < ImNodesCol_COUNT; i++) {
+            const ImU32 a = from.node_colors[i];
+            const ImU32 b = to.node_colors[i];
+            if (a == b) continue;
+            const ImVec4 fa          = u32_to_float4(a);
+            node_start_[node_count_] = fa;
+            node_delta_[node_count_] = vec4_sub(u32_to_float4(b), fa);
+            node_end_[node_count_]   = b;
+            node_idx_[node_count_]   = static_cast<std::uint8_t>(i);
+            ++node_count_;
+        }
+
+        float_count_ = 0;
+        for (std::size_t i = 0; i < theme_float_fields.size(); i++) {
+            const float a = from.*theme_float_fields[i].ptr;
+            const float b = to.*theme_float_fields[i].ptr;
+            if (a == b) continue;
+            float_start_[float_count_] = a;
+            float_delta_[float_count_] = b - a;
+            float_end_[float_count_]   = b;
+            float_idx_[float_count_]   = static_cast<std::uint8_t>(i);
+            ++float_count_;
+        }
+
+        duration_ = std::max(duration, 0.0f);
+        elapsed_  = 0.0f;
+        curve_    = curve;
+        active_   = true;
+    }
+
+    // ============================================================================
+    // theme_transition::update / finish
+    // ============================================================================
+
+    bool theme_transition::update(const float dt) noexcept {
+        if (!active_) return false;
+        elapsed_ += dt;
+        if (elapsed_ >= duration_) {
+            finish();
+            return false;
+        }
+        write(ease(curve_, elapsed_ / duration_));
+        return true;
+    }
+
+    void theme_transition::finish() noexcept {
+        if (!active_) return;
+        elapsed_ = duration_;
+        active_  = false;
+        write_end();
+    }
+
+    void theme_transition::write(const float t) const noexcept {
+        ImGuiStyle &style = ImGui::GetStyle();
+        lerp_lanes(color_start_.data(), color_delta_.data(), color_count_, t,
+                   [&](const int i, const ImVec4 &v) { style.Colors[color_idx_[i]] = v; });
+
+        ImNodesStyle *node_style = current_node_style();
+        if (node_style != nullptr) {
+            lerp_lanes(node_start_.data(), node_delta_.data(), node_count_, t,
+                       [&](const int i, const ImVec4 &v) { node_style->Colors[node_idx_[i]] = float4_to_u32(v); });
+        }
+
+        for (int i = 0; i < float_count_; i++)
+            write_float(float_idx_[i], float_start_[i] + float_delta_[i] * t, style, node_style);
+    }
+
+    void theme_transition::write_end() const noexcept {
+        ImGuiStyle &style = ImGui::GetStyle();
+        for (int i = 0; i < color_count_; i++)
+            style.Colors[color_idx_[i]] = color_end_[i];
+
+        ImNodesStyle *node_style = current_node_style();
+        if (node_style != nullptr) {
+            for (int i = 0; i < node_count_; i++)
+                node_style->Colors[node_idx_[i]] = node_end_[i];
+        }
+
+        for (int i = 0; i < float_count_; i++)
+            write_float(float_idx_[i], float_end_[i], style, node_style);
+    }
+
+} // namespace imgui_util::theme
@@ -0,0 +1,205 @@
+/// @file headless.hpp
+/// @brief Headless ImGui/ImPlot/ImNodes test bed that measures the draw data widgets produce.
+///
+/// headless owns the three contexts, builds the default font atlas in memory and never talks
+/// to a renderer: each frame() runs NewFrame(), the UI callback and Render(), then records the
+/// vertex, index and draw-command counts of every draw list in ImDrawData. widget() renders a
+/// callback in a borderless, background-less window covering the display, so its stats are
+/// exactly what the widget itself (and its child windows) emitted. Input is scripted through
+/// ImGui's event queue, which trickles it over the following frames like a real backend.
+///
+/// Usage:
+/// @code
+///   imgui_util::testing::headless h;
+///   imgui_util::hex_viewer         hex;
+///   const auto s = h.widget("hex", [&] { hex.render("##hex", bytes); });
+///   EXPECT_LE(s.commands, 2);
+///
+///   h.press_key(ImGuiKey_S, ImGuiMod_Ctrl);
+///   h.frame([&] { fired += hotkeys.dispatch(); });
+/// @endcode
+#pragma once
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <imnodes.h>
+#include <implot.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "imgui_util/core/raii.hpp"
+
+namespace imgui_util::testing {
+
+    /// @brief Geometry submitted by one or more draw lists.
+    struct draw_stats {
+        int vertices = 0; ///< ImDrawList::VtxBuffer entries.
+        int indices  = 0; ///< ImDrawList::IdxBuffer entries.
+        int commands = 0; ///< ImDrawCmd count (draw calls a renderer would issue).
+        int lists    = 0; ///< Draw lists contributing to the totals.
+
+        draw_stats &operator+=(const draw_stats &o) noexcept {
+            vertices += o.vertices;
+            indices += o.indices;
+            commands += o.commands;
+            lists += o.lists;
+            return *this;
+        }
+
+        [[nodiscard]] bool operator==(const draw_stats &) const noexcept = default;
+    };
+
+    /**
+     * @brief Owns an ImGui, ImPlot and ImNodes context and runs frames without a renderer.
+     *
+     * Several instances may coexist: frame() makes the instance's contexts current first, and
+     * scripted input is queued on the instance's own IO. Every frame advances time by 1/60 s.
+     */
+    class headless {
+    public:
+        explicit headless(const ImVec2 display = {1280.0f, 720.0f}) {
+            ctx_        = ImGui::CreateContext();
+            plot_ctx_   = ImPlot::CreateContext();
+            nodes_ctx_  = ImNodes::CreateContext();
+            make_current(); // CreateContext() keeps an already-current context current
+            ImGuiIO &io = ImGui::GetIO();
+            io.IniFilename = nullptr;
+            io.LogFilename = nullptr;
+            io.DisplaySize = display;
+            io.DeltaTime   = 1.0f / 60.0f;
+            io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+            io.Fonts->Build(); // default font; the texture stays in memory, nothing is uploaded
+            ImGui::GetStyle().WindowBorderSize = 0.0f;
+        }
+
+        ~headless() {
+            ImNodes::DestroyContext(nodes_ctx_);
+            ImPlot::DestroyContext(plot_ctx_);
+            ImGui::DestroyContext(ctx_);
+        }
+
+        headless(const headless &)            = delete;
+        headless &operator=(const headless &) = delete;
+
+        /**
+         * @brief Run one frame and record its draw data.
+         * @param ui Called between NewFrame() and Render().
+         * @return Totals over every draw list of the frame.
+         */
+        template<typename F>
+        draw_stats frame(F &&ui) {
+            make_current();
+            ImGui::NewFrame();
+            std::forward<F>(ui)();
+            ImGui::Render();
+            capture(*ImGui::GetDrawData());
+            return total_;
+        }
+
+        /// @brief Run @p n frames with no UI (lets queued input drain).
+        void frames(const int n) {
+            for (int i = 0; i < n; ++i) (void)frame([] {});
+        }
+
+        /**
+         * @brief Render @p ui alone in a display-sized window named @p name and measure it.
+         *
+         * The window has no decorations, background or border, so an empty callback measures
+         * zero. The first frames let clippers and auto-sized children settle; only the last
+         * one is measured.
+         * @param frame_count Frames to run (at least 1).
+         * @return Stats of the window's draw list and those of its child windows.
+         */
+        template<typename F>
+        draw_stats widget(const std::string_view name, F &&ui, const int frame_count = 2) {
+            const std::string title{name};
+            for (int i = 0; i < frame_count; ++i) {
+                (void)frame([&] {
+                    ImGui::SetNextWindowPos({0.0f, 0.0f});
+                    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+                    if (const window w{title.c_str(), nullptr, widget_flags}) ui();
+                });
+            }
+            return stats(name);
+        }
+
+        /// @brief Stats of window @p name and its child windows in the last frame.
+        [[nodiscard]] draw_stats stats(const std::string_view name) const {
+            draw_stats s;
+            for (const auto &[owner, list]: lists_) {
+                const std::string_view o{owner};
+                if (o == name || (o.size() > name.size() && o.starts_with(name) && o[name.size()] == '/')) s += list;
+            }
+            return s;
+        }
+
+        /// @brief Make this instance's ImGui, ImPlot and ImNodes contexts current.
+        void make_current() const {
+            ImGui::SetCurrentContext(ctx_);
+            ImPlot::SetCurrentContext(plot_ctx_);
+            ImNodes::SetCurrentContext(nodes_ctx_);
+        }
+
+        /// @brief Totals of the last frame.
+        [[nodiscard]] const draw_stats &total() const noexcept { return total_; }
+
+        // --- scripted input (queued; ImGui applies it over the next frames) ---
+
+        void move_mouse(const ImVec2 pos) { io().AddMousePosEvent(pos.x, pos.y); }
+        void mouse_down(const ImGuiMouseButton b = ImGuiMouseButton_Left) { io().AddMouseButtonEvent(b, true); }
+        void mouse_up(const ImGuiMouseButton b = ImGuiMouseButton_Left) { io().AddMouseButtonEvent(b, false); }
+        void wheel(const float dy, const float dx = 0.0f) { io().AddMouseWheelEvent(dx, dy); }
+        void type(const char *utf8) { io().AddInputCharactersUTF8(utf8); }
+        void key_down(const ImGuiKey key) { io().AddKeyEvent(key, true); } // also ImGuiMod_Ctrl etc.
+        void key_up(const ImGuiKey key) { io().AddKeyEvent(key, false); }
+
+        /// @brief Move to @p pos and press and release @p b (down and up land on consecutive frames).
+        void click(const ImVec2 pos, const ImGuiMouseButton b = ImGuiMouseButton_Left) {
+            move_mouse(pos);
+            mouse_down(b);
+            mouse_up(b);
+        }
+
+        /// @brief Press and release @p key while holding @p mods (e.g. ImGuiMod_Ctrl | ImGuiMod_Shift).
+        void press_key(const ImGuiKey key, const ImGuiKeyChord mods = ImGuiMod_None) {
+            for_each_mod(mods, [&](const ImGuiKey m) { io().AddKeyEvent(m, true); });
+            io().AddKeyEvent(key, true);
+            io().AddKeyEvent(key, false);
+            for_each_mod(mods, [&](const ImGuiKey m) { io().AddKeyEvent(m, false); });
+        }
+
+    private:
+        static constexpr ImGuiWindowFlags widget_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground
+            | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoBringToFrontOnFocus;
+
+        [[nodiscard]] ImGuiIO &io() const noexcept { return ctx_->IO; }
+
+        template<typename F>
+        static void for_each_mod(const ImGuiKeyChord mods, F &&f) {
+            for (const ImGuiKey m: {ImGuiMod_Ctrl, ImGuiMod_Shift, ImGuiMod_Alt, ImGuiMod_Super})
+                if ((mods & m) != 0) f(m);
+        }
+
+        void capture(const ImDrawData &dd) {
+            lists_.clear();
+            total_ = {};
+            for (const ImDrawList *dl: dd.CmdLists) {
+                const draw_stats s{.vertices = dl->VtxBuffer.Size,
+                                   .indices  = dl->IdxBuffer.Size,
+                                   .commands = dl->CmdBuffer.Size,
+                                   .lists    = 1};
+                lists_.emplace_back(dl->_OwnerName != nullptr ? dl->_OwnerName : "", s);
+                total_ += s;
+            }
+        }
+
+        ImGuiContext                                   *ctx_       = nullptr;
+        ImPlotContext                                  *plot_ctx_  = nullptr;
+        ImNodesContext                                 *nodes_ctx_ = nullptr;
+        std::vector<std::pair<std::string, draw_stats>> lists_; // owner window name -> stats, last frame
+        draw_stats                                      total_;
+    };
+
+} // namespace imgui_util::testing
@@ -0,0 +1,25 @@
+/// @file test_font.hpp
+/// @brief Hand-built ImFont with known glyph advances, for text measuring tests without an ImGui context.
+#pragma once
+
+#include <imgui.h>
+
+namespace imgui_util::testing {
+
+    /// @brief FontSize 10: 10 px per ASCII glyph except '.' (2 px) and 'i' (3.3 px); everything else
+    ///        uses the 5 px fallback.
+    inline ImFont &test_font() {
+        static ImFont font = [] {
+            ImFont f;
+            f.FontSize         = 10.0f;
+            f.FallbackAdvanceX = 5.0f;
+            f.IndexAdvanceX.resize(128);
+            for (int c = 0; c < 128; ++c) f.IndexAdvanceX[c] = 10.0f;
+            f.IndexAdvanceX['.'] = 2.0f;
+            f.IndexAdvanceX['i'] = 3.3f;
+            return f;
+        }();
+        return font;
+    }
+
+} // namespace imgui_util::testing
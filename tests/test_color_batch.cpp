@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <imgui_util/theme/color_batch.hpp>
+#include <imgui_util/theme/color_math.hpp>
+#include <vector>
+
+using namespace imgui_util::color;
+
+namespace {
+    // Odd size so every kernel exercises both the SIMD blocks and the scalar tail.
+    constexpr std::size_t batch_size = 1003;
+
+    struct ColorBatch : ::testing::Test {
+        std::vector<ImU32>  packed = std::vector<ImU32>(batch_size);
+        std::vector<float>  x      = std::vector<float>(batch_size);
+        std::vector<float>  y      = std::vector<float>(batch_size);
+        std::vector<float>  z      = std::vector<float>(batch_size);
+        std::vector<float>  w      = std::vector<float>(batch_size);
+        std::vector<ImVec4> ref    = std::vector<ImVec4>(batch_size);
+
+        [[nodiscard]] float4_soa soa() { return {x, y, z, w}; }
+
+        void SetUp() override {
+            for (std::size_t i = 0; i < batch_size; i++)
+                packed[i] = static_cast<ImU32>(i * 2654435761u);
+            unpack_u32(packed, soa());
+            for (std::size_t i = 0; i < batch_size; i++)
+                ref[i] = u32_to_float4(packed[i]);
+        }
+
+        template<typename Batch, typename Scalar>
+        void expect_matches(Batch &&batch, Scalar &&scalar, const float tol = 1e-5f) {
+            batch(soa());
+            for (std::size_t i = 0; i < batch_size; i++) {
+                ref[i] = scalar(ref[i]);
+                ASSERT_NEAR(x[i], ref[i].x, tol) << "index " << i;
+                ASSERT_NEAR(y[i], ref[i].y, tol) << "index " << i;
+                ASSERT_NEAR(z[i], ref[i].z, tol) << "index " << i;
+                ASSERT_EQ(w[i], ref[i].w) << "alpha must be untouched";
+            }
+        }
+    };
+} // namespace
+
+TEST(ColorBatchBackend, Named) {
+    const auto name = batch_backend();
+    EXPECT_TRUE(name == "avx2" || name == "sse2" || name == "scalar");
+}
+
+TEST_F(ColorBatch, UnpackMatchesScalar) {
+    for (std::size_t i = 0; i < batch_size; i++) {
+        EXPECT_EQ(x[i], ref[i].x);
+        EXPECT_EQ(y[i], ref[i].y);
+        EXPECT_EQ(z[i], ref[i].z);
+        EXPECT_EQ(w[i], ref[i].w);
+    }
+}
+
+TEST_F(ColorBatch, PackRoundTrips) {
+    std::vector<ImU32> out(batch_size);
+    pack_u32(soa(), out);
+    EXPECT_EQ(out, packed);
+}
+
+TEST_F(ColorBatch, PackClamps) {
+    x[0] = -1.0f;
+    y[0] = 2.0f;
+    std::vector<ImU32> out(batch_size);
+    pack_u32(soa(), out);
+    EXPECT_EQ(out[0] >> IM_COL32_R_SHIFT & 0xFF, 0u);
+    EXPECT_EQ(out[0] >> IM_COL32_G_SHIFT & 0xFF, 255u);
+}
+
+TEST_F(ColorBatch, SrgbMatchesScalar) {
+    expect_matches([](const float4_soa &c) { srgb_to_linear(c); }, [](const ImVec4 &c) { return srgb_to_linear(c); });
+    expect_matches([](const float4_soa &c) { linear_to_srgb(c); }, [](const ImVec4 &c) { return linear_to_srgb(c); });
+}
+
+TEST_F(ColorBatch, HsvMatchesScalar) {
+    expect_matches([](const float4_soa &c) { rgb_to_hsv(c); }, [](const ImVec4 &c) { return rgb_to_hsv(c); });
+    expect_matches([](const float4_soa &c) { hsv_to_rgb(c); }, [](const ImVec4 &c) { return hsv_to_rgb(c); });
+}
+
+TEST_F(ColorBatch, OklchPipelineMatchesScalar) {
+    expect_matches([](const float4_soa &c) { srgb_to_linear(c); }, [](const ImVec4 &c) { return srgb_to_linear(c); });
+    expect_matches([](const float4_soa &c) { linear_to_oklab(c); }, [](const ImVec4 &c) { return linear_to_oklab(c); });
+    expect_matches([](const float4_soa &c) { oklab_to_oklch(c); }, [](const ImVec4 &c) { return oklab_to_oklch(c); });
+    expect_matches([](const float4_soa &c) { oklch_to_oklab(c); }, [](const ImVec4 &c) { return oklch_to_oklab(c); });
+    expect_matches([](const float4_soa &c) { oklab_to_linear(c); }, [](const ImVec4 &c) { return oklab_to_linear(c); });
+}
+
+TEST(ColorBatchEdge, EmptySpansAreNoOps) {
+    const float4_soa empty{};
+    srgb_to_linear(empty);
+    linear_to_oklab(empty);
+    pack_u32(empty, {});
+    SUCCEED();
+}
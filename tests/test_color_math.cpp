@@ -318,3 +318,57 @@ TEST(OffsetU32Rgb, ZeroDelta) {
     EXPECT_EQ((result >> IM_COL32_B_SHIFT) & 0xFF, 126u);
     EXPECT_EQ((result >> IM_COL32_A_SHIFT) & 0xFF, 100u);
 }
+
+// --- color-space transforms (scalar reference) ---
+
+TEST(SrgbTransfer, Endpoints) {
+    EXPECT_FLOAT_EQ(srgb_to_linear(0.0f), 0.0f);
+    EXPECT_NEAR(srgb_to_linear(1.0f), 1.0f, 1e-6f);
+    EXPECT_NEAR(linear_to_srgb(1.0f), 1.0f, 1e-6f);
+    EXPECT_NEAR(srgb_to_linear(0.5f), 0.2140411f, 1e-6f);
+}
+
+TEST(SrgbTransfer, RoundTrip) {
+    for (int i = 0; i <= 255; i++) {
+        const float c = static_cast<float>(i) / 255.0f;
+        EXPECT_NEAR(linear_to_srgb(srgb_to_linear(c)), c, 2e-6f);
+    }
+}
+
+TEST(Hsv, RoundTrip) {
+    const ImVec4 c   = {0.8f, 0.3f, 0.55f, 0.5f};
+    const ImVec4 hsv = rgb_to_hsv(c);
+    EXPECT_NEAR(hsv.z, 0.8f, 1e-6f);
+    EXPECT_FLOAT_EQ(hsv.w, 0.5f);
+    const ImVec4 back = hsv_to_rgb(hsv);
+    EXPECT_NEAR(back.x, c.x, 1e-6f);
+    EXPECT_NEAR(back.y, c.y, 1e-6f);
+    EXPECT_NEAR(back.z, c.z, 1e-6f);
+}
+
+TEST(Oklab, KnownValues) {
+    const ImVec4 white = linear_to_oklab(ImVec4{1.0f, 1.0f, 1.0f, 1.0f});
+    EXPECT_NEAR(white.x, 1.0f, 1e-4f);
+    EXPECT_NEAR(white.y, 0.0f, 1e-4f);
+    EXPECT_NEAR(white.z, 0.0f, 1e-4f);
+
+    const ImVec4 red = linear_to_oklab(ImVec4{1.0f, 0.0f, 0.0f, 1.0f});
+    EXPECT_NEAR(red.x, 0.62796f, 1e-4f);
+    EXPECT_NEAR(red.y, 0.22486f, 1e-4f);
+    EXPECT_NEAR(red.z, 0.12585f, 1e-4f);
+}
+
+TEST(Oklab, RoundTripThroughOklch) {
+    const ImVec4 lin  = srgb_to_linear(ImVec4{0.2f, 0.6f, 0.9f, 1.0f});
+    const ImVec4 lch  = oklab_to_oklch(linear_to_oklab(lin));
+    const ImVec4 back = oklab_to_linear(oklch_to_oklab(lch));
+    EXPECT_GE(lch.z, 0.0f);
+    EXPECT_LT(lch.z, 1.0f);
+    EXPECT_NEAR(back.x, lin.x, 1e-5f);
+    EXPECT_NEAR(back.y, lin.y, 1e-5f);
+    EXPECT_NEAR(back.z, lin.z, 1e-5f);
+}
+
+static_assert(srgb_to_linear(0.0f) == 0.0f);
+static_assert(linear_to_oklab(ImVec4{1.0f, 1.0f, 1.0f, 1.0f}).x > 0.999f);
+static_assert(oklab_to_oklch(ImVec4{0.5f, 0.0f, 0.1f, 1.0f}).z > 0.249f);
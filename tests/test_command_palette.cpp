@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/command_palette.hpp>
+#include <string>
+#include <vector>
+
+#include "support/headless.hpp"
+
+using imgui_util::command_palette;
+using imgui_util::testing::headless;
+
+namespace {
+
+    // Drives a command_palette in a headless context and records which commands ran.
+    struct CommandPalette : ::testing::Test {
+        headless                 h;
+        command_palette          palette;
+        std::vector<std::string> ran;
+        bool                     open_now = false;
+
+        void add(const std::string &name, const bool *enabled = nullptr) {
+            if (enabled == nullptr) palette.add(name, [this, name] { ran.push_back(name); });
+            else palette.add(name, {}, {}, [this, name] { ran.push_back(name); }, [enabled] { return *enabled; });
+        }
+
+        void step(const int n = 1) {
+            for (int i = 0; i < n; ++i) {
+                (void)h.frame([&] {
+                    palette.render();
+                    open_now = ImGui::IsPopupOpen("##cmd_palette");
+                });
+            }
+        }
+
+        void open() {
+            palette.open();
+            step(3); // popup appears, then the filter input takes focus
+        }
+
+        void type(const char *query) {
+            h.type(query);
+            step(2);
+        }
+
+        void press(const ImGuiKey key) {
+            h.press_key(key);
+            step(3);
+        }
+
+        // Centre of result row @p i in the palette popup: rows follow the filter input and a
+        // separator, which takes no height of its own beyond the item spacing.
+        [[nodiscard]] static ImVec2 row(const int i) {
+            const ImGuiWindow *w     = ImGui::FindWindowByName("##cmd_palette");
+            const float        line  = ImGui::GetTextLineHeight();
+            const float        gap   = ImGui::GetStyle().ItemSpacing.y;
+            const float        top   = w->DC.CursorStartPos.y + ImGui::GetFrameHeight() + 2.0f * gap;
+            const float        pitch = line + gap;
+            return {w->DC.CursorStartPos.x + 20.0f, top + static_cast<float>(i) * pitch + line * 0.5f};
+        }
+    };
+
+} // namespace
+
+TEST_F(CommandPalette, EnterRunsBestMatchAndCloses) {
+    add("Open File");
+    add("Save");
+    open();
+    ASSERT_TRUE(open_now);
+    type("sav");
+    press(ImGuiKey_Enter);
+    EXPECT_EQ(ran, std::vector<std::string>{"Save"});
+    EXPECT_FALSE(open_now);
+}
+
+TEST_F(CommandPalette, RescoresWhenQueryOrCommandsChange) {
+    add("Open File");
+    add("Save");
+    open();
+    type("sav");
+    press(ImGuiKey_Enter);
+
+    open(); // filter reset: the cached "sav" results must not be reused
+    press(ImGuiKey_Enter);
+    EXPECT_EQ(ran, (std::vector<std::string>{"Save", "Open File"}));
+
+    open();
+    type("new");
+    press(ImGuiKey_Enter); // nothing matches yet
+    EXPECT_TRUE(open_now);
+    add("New Window"); // same query, new command: rescored
+    step();
+    press(ImGuiKey_Enter);
+    EXPECT_EQ(ran, (std::vector<std::string>{"Save", "Open File", "New Window"}));
+}
+
+TEST_F(CommandPalette, EqualScoresKeepRegistrationOrder) {
+    for (int i = 0; i < 40; ++i) add("Item " + std::to_string(100 + i)); // all tie on "item"
+    open();
+    type("item");
+    press(ImGuiKey_Enter);
+    open();
+    type("item");
+    for (int i = 0; i < 3; ++i) press(ImGuiKey_DownArrow);
+    press(ImGuiKey_Enter);
+    EXPECT_EQ(ran, (std::vector<std::string>{"Item 100", "Item 103"}));
+}
+
+TEST_F(CommandPalette, DisabledCommandIgnoresEnterAndClick) {
+    const bool off = false;
+    add("Delete", &off);
+    add("Duplicate");
+    open();
+
+    press(ImGuiKey_Enter); // "Delete" is selected
+    EXPECT_TRUE(ran.empty());
+    EXPECT_TRUE(open_now);
+
+    h.click(row(0));
+    step(3);
+    EXPECT_TRUE(ran.empty());
+    EXPECT_TRUE(open_now);
+
+    h.click(row(1)); // the enabled row below is clickable
+    step(3);
+    EXPECT_EQ(ran, std::vector<std::string>{"Duplicate"});
+    EXPECT_FALSE(open_now);
+}
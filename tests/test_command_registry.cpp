@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/command_registry.hpp>
+#include <imgui_util/widgets/menu_bar_builder.hpp>
+#include <imgui_util/widgets/toolbar.hpp>
+
+#include "support/headless.hpp"
+
+using imgui_util::command_registry;
+using imgui_util::key_combo;
+using imgui_util::testing::headless;
+
+namespace {
+    struct CommandRegistry : ::testing::Test {
+        ImGuiContext *ctx = nullptr;
+        void          SetUp() override { ctx = ImGui::CreateContext(); }
+        void          TearDown() override { ImGui::DestroyContext(ctx); }
+    };
+} // namespace
+
+TEST_F(CommandRegistry, ExecutesOnlyWhenEnabled) {
+    command_registry reg;
+    bool             dirty = false;
+    int              saves = 0;
+    const auto       save  = reg.add({.label = "Save", .action = [&] { ++saves; }, .enabled = [&] { return dirty; }});
+    ASSERT_TRUE(save.has_value());
+    EXPECT_FALSE(reg.execute(*save));
+    EXPECT_EQ(saves, 0);
+    EXPECT_STREQ(reg.label(*save), "Save");
+    EXPECT_EQ(reg.shortcut(*save), nullptr);
+    EXPECT_EQ(reg.find("Save"), *save);
+}
+
+TEST_F(CommandRegistry, EnablePredicateRunsOncePerFrame) {
+    command_registry reg;
+    int              evaluations = 0;
+    const auto       id          = *reg.add({.label = "Undo", .action = [] {}, .enabled = [&] {
+        ++evaluations;
+        return true;
+    }});
+    for (int occurrence = 0; occurrence < 5; ++occurrence) EXPECT_TRUE(reg.enabled(id)); // menu, toolbar, palette...
+    EXPECT_TRUE(reg.execute(id));
+    EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(CommandRegistry, ShortcutsAreUniqueAndFormatted) {
+    command_registry reg;
+    int              undos = 0;
+    const auto       undo  = *reg.add({.label    = "Undo",
+                                        .action   = [&] { ++undos; },
+                                        .shortcut = {ImGuiKey_Z, ImGuiMod_Ctrl}});
+    EXPECT_STREQ(reg.shortcut(undo), "Ctrl+Z");
+
+    const auto clash = reg.add({.label = "Zoom", .action = [] {}, .shortcut = {ImGuiKey_Z, ImGuiMod_Ctrl}});
+    ASSERT_FALSE(clash.has_value());
+    EXPECT_EQ(clash.error(), undo);
+    EXPECT_EQ(reg.size(), 1u);
+
+    const auto dup = reg.add({.label = "Undo", .action = [] {}});
+    ASSERT_FALSE(dup.has_value());
+    EXPECT_EQ(dup.error(), undo);
+
+    EXPECT_NE(reg.hotkeys().find({ImGuiKey_Z, ImGuiMod_Ctrl}), imgui_util::hotkey_registry::invalid_id);
+    EXPECT_TRUE(reg.execute(undo));
+    EXPECT_EQ(undos, 1);
+}
+
+TEST_F(CommandRegistry, RebindUnknownIdFails) {
+    command_registry reg;
+    const auto       missing = reg.rebind(7, {ImGuiKey_S, ImGuiMod_Ctrl});
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), command_registry::invalid_id);
+    EXPECT_EQ(reg.hotkeys().find({ImGuiKey_S, ImGuiMod_Ctrl}), imgui_util::hotkey_registry::invalid_id);
+}
+
+TEST_F(CommandRegistry, RebindUpdatesShortcutText) {
+    command_registry reg;
+    const auto       a = *reg.add({.label = "A", .action = [] {}, .shortcut = {ImGuiKey_S, ImGuiMod_Ctrl}});
+    const auto       b = *reg.add({.label = "B", .action = [] {}});
+
+    const auto clash = reg.rebind(b, {ImGuiKey_S, ImGuiMod_Ctrl});
+    ASSERT_FALSE(clash.has_value());
+    EXPECT_EQ(clash.error(), a);
+    EXPECT_EQ(reg.shortcut(b), nullptr);
+
+    EXPECT_TRUE(reg.rebind(a, {}).has_value());
+    EXPECT_EQ(reg.shortcut(a), nullptr);
+    EXPECT_TRUE(reg.rebind(b, {ImGuiKey_S, ImGuiMod_Ctrl | ImGuiMod_Shift}).has_value());
+    EXPECT_STREQ(reg.shortcut(b), "Ctrl+Shift+S");
+    EXPECT_EQ(reg.combo(b).key, ImGuiKey_S);
+}
+
+// --- widgets drawing commands (headless) ---
+
+namespace {
+
+    ImVec2 centre(const ImGuiWindow &w, const ImVec2 offset) {
+        return {w.DC.CursorStartPos.x + offset.x, w.DC.CursorStartPos.y + offset.y};
+    }
+
+} // namespace
+
+TEST(CommandWidgets, MenuItemFollowsRegistryState) {
+    headless         h;
+    command_registry reg;
+    bool             dirty = false;
+    int              saves = 0;
+    const auto       save  = *reg.add({.label = "Save", .action = [&] { ++saves; }, .enabled = [&] { return dirty; }});
+
+    imgui_util::menu_bar_builder menus;
+    (void)menus.menu("File", [&](auto &m) { (void)m.item(reg, save); });
+    const auto step = [&](const int n) {
+        for (int i = 0; i < n; ++i) (void)h.frame([&] { menus.render_main(); });
+    };
+
+    step(2);
+    const ImGuiWindow *bar = ImGui::FindWindowByName("##MainMenuBar");
+    ASSERT_NE(bar, nullptr);
+    const auto open_menu = [&] {
+        h.click({bar->Pos.x + 16.0f, bar->Pos.y + bar->Size.y * 0.5f}); // on "File"
+        step(3);
+    };
+    const auto click_item = [&] {
+        const ImGuiWindow *menu = ImGui::FindWindowByName("##Menu_00");
+        ASSERT_NE(menu, nullptr);
+        ASSERT_TRUE(menu->Active);
+        h.click(centre(*menu, {10.0f, ImGui::GetTextLineHeight() * 0.5f}));
+        step(3);
+    };
+
+    open_menu();
+    click_item(); // disabled: nothing runs
+    EXPECT_EQ(saves, 0);
+
+    dirty = true; // read from the registry on the next frame, no rebuild
+    step(1);
+    if (!ImGui::FindWindowByName("##Menu_00")->Active) open_menu();
+    click_item();
+    EXPECT_EQ(saves, 1);
+}
+
+TEST(CommandWidgets, ToolbarButtonFollowsRegistryState) {
+    headless         h;
+    command_registry reg;
+    bool             dirty = false;
+    int              saves = 0;
+    const auto       save  = *reg.add({.label = "Save", .action = [&] { ++saves; }, .enabled = [&] { return dirty; }});
+
+    imgui_util::toolbar bar;
+    (void)bar.button(reg, save);
+    const auto click = [&] {
+        (void)h.widget("bar", [&] { bar.render(); });
+        h.click({16.0f, 16.0f}); // inside the first button at the window padding offset
+        (void)h.widget("bar", [&] { bar.render(); }, 4);
+    };
+
+    click();
+    EXPECT_EQ(saves, 0);
+    dirty = true;
+    click();
+    EXPECT_EQ(saves, 1);
+}
+
+TEST(CommandWidgets, PaletteShowsShortcutAfterRebind) {
+    headless                    h;
+    command_registry            reg;
+    imgui_util::command_palette palette;
+    int                         saves = 0;
+
+    const auto save = *reg.add({.label = "Save", .action = [&] { ++saves; }, .shortcut = {ImGuiKey_S, ImGuiMod_Ctrl}});
+    reg.add_to(palette);
+    palette.open();
+    const auto shown = [&] {
+        for (int i = 0; i < 3; ++i) (void)h.frame([&] { palette.render(); });
+        return h.stats("##cmd_palette");
+    };
+
+    const auto before = shown(); // "Ctrl+S"
+    ASSERT_TRUE(reg.rebind(save, {ImGuiKey_S, ImGuiMod_Ctrl | ImGuiMod_Shift}).has_value());
+    const auto after = shown(); // "Ctrl+Shift+S": six more glyphs, one quad each
+    EXPECT_EQ(after.vertices - before.vertices, 6 * 4);
+
+    h.press_key(ImGuiKey_Enter);
+    (void)shown();
+    EXPECT_EQ(saves, 1);
+}
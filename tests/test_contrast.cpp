@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <imgui_util/theme/dynamic_colors.hpp>
+#include <imgui_util/theme/palette.hpp>
+
+using namespace imgui_util::theme;
+using namespace imgui_util::color;
+
+namespace {
+    constexpr ImVec4 black{0.0f, 0.0f, 0.0f, 1.0f};
+    constexpr ImVec4 white{1.0f, 1.0f, 1.0f, 1.0f};
+    constexpr ImVec4 grey{0.533f, 0.533f, 0.533f, 1.0f}; // #888888
+
+    // Low-contrast preset: mid-grey text on a mid-dark bluish background.
+    constexpr theme_preset murky_preset{
+        .name                    = "Murky",
+        .bg_dark                 = {{{0.20f, 0.22f, 0.28f}}},
+        .bg_mid                  = {{{0.26f, 0.28f, 0.34f}}},
+        .accent                  = {{{0.45f, 0.55f, 0.90f}}},
+        .secondary               = {{{0.30f, 0.75f, 0.70f}}},
+        .alternate               = std::nullopt,
+        .text                    = rgb_color{{{0.50f, 0.52f, 0.58f}}},
+        .node_title_bar          = IM_COL32(75, 90, 140, 255),
+        .node_title_bar_hovered  = IM_COL32(95, 115, 170, 255),
+        .node_title_bar_selected = IM_COL32(115, 140, 230, 255),
+        .node_link               = IM_COL32(75, 190, 180, 220),
+        .node_link_hovered       = IM_COL32(100, 220, 210, 255),
+        .node_pin                = IM_COL32(75, 190, 180, 255),
+        .node_pin_hovered        = IM_COL32(100, 220, 210, 255),
+        .node_grid_bg            = IM_COL32(22, 22, 26, 255),
+        .light =
+            theme_preset::light_overrides{
+                .bg_dark = {{{0.80f, 0.80f, 0.84f}}},
+                .bg_mid  = {{{0.86f, 0.86f, 0.90f}}},
+                .text    = rgb_color{{{0.55f, 0.55f, 0.60f}}},
+            },
+    };
+} // namespace
+
+// --- metrics ---
+
+TEST(WcagContrast, KnownValues) {
+    EXPECT_NEAR(wcag_contrast(black, white), 21.0f, 1e-3f);
+    EXPECT_NEAR(wcag_contrast(white, black), 21.0f, 1e-3f);
+    EXPECT_NEAR(wcag_contrast(grey, white), 3.55f, 0.01f);
+    EXPECT_FLOAT_EQ(wcag_contrast(grey, grey), 1.0f);
+}
+
+TEST(ApcaContrast, KnownValuesAndPolarity) {
+    EXPECT_NEAR(apca_contrast(black, white), 106.04f, 0.1f);
+    EXPECT_NEAR(apca_contrast(white, black), -107.88f, 0.1f);
+    EXPECT_NEAR(apca_contrast(grey, white), 63.06f, 0.1f);
+    EXPECT_FLOAT_EQ(apca_contrast(grey, grey), 0.0f);
+    EXPECT_GT(contrast(white, black, contrast_metric::apca), 0.0f);
+}
+
+TEST(ShiftLightness, KeepsHueAndAlpha) {
+    const ImVec4 c       = {0.2f, 0.4f, 0.8f, 0.5f};
+    const ImVec4 lighter = shift_lightness(c, 0.1f);
+    EXPECT_NEAR(srgb_to_oklch(lighter).x, srgb_to_oklch(c).x + 0.1f, 1e-3f);
+    EXPECT_NEAR(srgb_to_oklch(lighter).z, srgb_to_oklch(c).z, 1e-3f);
+    EXPECT_FLOAT_EQ(lighter.w, 0.5f);
+    EXPECT_FLOAT_EQ(shift_lightness(c, 0.1f, 1.0f).w, 1.0f);
+}
+
+// --- solve_contrast ---
+
+TEST(SolveContrast, AlreadySufficientIsUnchanged) {
+    const ImVec4 out = solve_contrast(white, black, 4.5f);
+    EXPECT_EQ(out.x, 1.0f);
+    EXPECT_EQ(out.y, 1.0f);
+    EXPECT_EQ(out.z, 1.0f);
+}
+
+TEST(SolveContrast, ReachesTargetWithSmallStep) {
+    const ImVec4 bg{0.30f, 0.30f, 0.35f, 1.0f};
+    const ImVec4 fg{0.50f, 0.50f, 0.60f, 0.8f};
+    ASSERT_LT(wcag_contrast(fg, bg), 4.5f);
+
+    const ImVec4 out = solve_contrast(fg, bg, 4.5f);
+    EXPECT_GE(wcag_contrast(out, bg), 4.5f);
+    EXPECT_LT(wcag_contrast(out, bg), 4.6f);              // minimal change, not pushed to white
+    EXPECT_GT(srgb_to_oklch(out).x, srgb_to_oklch(fg).x); // light text stays on the light side
+    EXPECT_FLOAT_EQ(out.w, 0.8f);
+}
+
+TEST(SolveContrast, ApcaTarget) {
+    const ImVec4 bg{0.9f, 0.9f, 0.9f, 1.0f};
+    const ImVec4 out = solve_contrast(ImVec4{0.6f, 0.4f, 0.4f, 1.0f}, bg, 75.0f, contrast_metric::apca);
+    EXPECT_GE(contrast(out, bg, contrast_metric::apca), 75.0f);
+}
+
+TEST(SolveContrast, UnreachableReturnsBestExtreme) {
+    const ImVec4 out = solve_contrast(grey, grey, 30.0f);
+    EXPECT_NEAR(wcag_contrast(out, grey), std::max(wcag_contrast(white, grey), wcag_contrast(black, grey)), 0.05f);
+}
+
+static_assert(wcag_contrast(black, white) > 20.9f);
+static_assert(wcag_contrast(solve_contrast(grey, ImVec4{0.4f, 0.4f, 0.4f, 1.0f}, 4.5f), ImVec4{0.4f, 0.4f, 0.4f, 1.0f})
+              >= 4.5f);
+
+// --- contrast_text ---
+
+TEST(ContrastText, PicksHigherContrast) {
+    EXPECT_EQ(contrast_text(white).x, 0.0f);
+    EXPECT_EQ(contrast_text(black).x, 1.0f);
+    EXPECT_EQ(contrast_text(ImVec4{0.9f, 0.2f, 0.2f, 1.0f}, 0.5f).w, 0.5f);
+    // Saturated blue reads better with white text even though its RGB average is mid-range.
+    EXPECT_EQ(contrast_text(ImVec4{0.1f, 0.3f, 0.9f, 1.0f}).x, 1.0f);
+}
+
+// --- palette ---
+
+// Verify the whole derivation, contrast solving included, is a constant expression
+static_assert(min_text_contrast(from_preset_perceptual(murky_preset, theme_mode::light)) >= 4.5f);
+static_assert(min_text_contrast(theme_config::from_preset_core(murky_preset)) < 4.5f);
+
+TEST(PerceptualPalette, BuiltAtCompileTime) {
+    static constexpr auto murky_perceptual = from_preset_perceptual(murky_preset);
+    static_assert(min_text_contrast(murky_perceptual) >= 4.5f);
+    EXPECT_GE(min_text_contrast(murky_perceptual), 4.5f);
+}
+
+TEST(PerceptualPalette, EnforcesTextContrast) {
+    for (const auto mode: {theme_mode::dark, theme_mode::light}) {
+        const theme_config core = theme_config::from_preset_core(murky_preset, mode);
+        const theme_config perc = from_preset_perceptual(murky_preset, mode);
+        EXPECT_LT(min_text_contrast(core), 4.5f);
+        EXPECT_GE(min_text_contrast(perc), 4.5f);
+        for (const ImGuiCol s: disabled_text_surfaces)
+            EXPECT_GE(wcag_contrast(perc.colors[ImGuiCol_TextDisabled], perc.colors[s]), 3.0f);
+    }
+}
+
+TEST(PerceptualPalette, ApcaTargets) {
+    const palette_options opts{.metric = contrast_metric::apca, .text_contrast = 60.0f, .disabled_contrast = 45.0f};
+    const theme_config    cfg = from_preset_perceptual(murky_preset, theme_mode::dark, opts);
+    EXPECT_GE(min_text_contrast(cfg, contrast_metric::apca), 60.0f);
+}
+
+TEST(PerceptualPalette, StepsAreLighterInDarkModeAndDarkerInLight) {
+    const theme_config dark  = from_preset_perceptual(murky_preset, theme_mode::dark);
+    const theme_config light = from_preset_perceptual(murky_preset, theme_mode::light);
+    EXPECT_GT(srgb_to_oklch(dark.colors[ImGuiCol_FrameBg]).x, srgb_to_oklch(dark.colors[ImGuiCol_WindowBg]).x);
+    EXPECT_LT(srgb_to_oklch(light.colors[ImGuiCol_FrameBg]).x, srgb_to_oklch(light.colors[ImGuiCol_WindowBg]).x);
+    EXPECT_NEAR(srgb_to_oklch(dark.colors[ImGuiCol_FrameBg]).x - srgb_to_oklch(dark.colors[ImGuiCol_WindowBg]).x,
+                0.06f, 1e-3f);
+}
+
+TEST(PerceptualPalette, EnforceContrastOnUserTheme) {
+    theme_config cfg              = theme_config::from_preset_core(murky_preset);
+    cfg.colors[ImGuiCol_Text]     = cfg.colors[ImGuiCol_WindowBg];
+    const ImVec4 window_bg_before = cfg.colors[ImGuiCol_WindowBg];
+    enforce_contrast(cfg);
+    EXPECT_GE(min_text_contrast(cfg), 4.5f);
+    EXPECT_EQ(cfg.colors[ImGuiCol_WindowBg].x, window_bg_before.x); // surfaces untouched
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/drag_drop.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "support/headless.hpp"
+
+using namespace imgui_util::drag_drop;
+using imgui_util::testing::headless;
+
+namespace {
+
+    // A source button publishing a shared string and a target button below it; remembers
+    // where both are and what was dropped.
+    struct drag_scene {
+        ImVec2                             source;
+        ImVec2                             target;
+        std::weak_ptr<const std::string>   published;
+        std::shared_ptr<const std::string> dropped;
+
+        void operator()() {
+            ImGui::Button("source");
+            source = centre();
+            if (const imgui_util::drag_drop_source src{}) {
+                set_shared_payload<std::string>("TEXT", [&] {
+                    auto s    = std::make_shared<const std::string>("payload");
+                    published = s;
+                    return s;
+                });
+            }
+            ImGui::Button("target");
+            target = centre();
+            if (const imgui_util::drag_drop_target tgt{}) {
+                if (auto s = accept_shared_payload<std::string>("TEXT")) dropped = std::move(s);
+            }
+        }
+
+        static ImVec2 centre() {
+            const ImVec2 a = ImGui::GetItemRectMin();
+            const ImVec2 b = ImGui::GetItemRectMax();
+            return {(a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f};
+        }
+    };
+
+    // Press on the source and move onto the target, leaving the button held.
+    void start_drag(headless &h, drag_scene &scene) {
+        const auto step = [&] { (void)h.widget("dnd", scene, 1); };
+        step();
+        h.move_mouse(scene.source);
+        step();
+        h.mouse_down();
+        step();
+        h.move_mouse(scene.target);
+        step();
+        step();
+    }
+
+} // namespace
+
+TEST(PayloadRegistry, ResolvesWithoutCopying) {
+    payload_registry reg;
+    const auto       rows = std::make_shared<const std::vector<int>>(std::vector<int>{1, 2, 3});
+    const auto       h    = reg.insert<std::vector<int>>(rows);
+    EXPECT_EQ(reg.size(), 1u);
+    EXPECT_EQ(reg.get<std::vector<int>>(h), rows.get());
+    EXPECT_EQ(reg.find<std::vector<int>>(h), rows);
+    EXPECT_EQ(reg.get<std::string>(h), nullptr); // wrong type
+    EXPECT_TRUE(reg.contains(h));
+}
+
+TEST(PayloadRegistry, DefaultHandleIsInvalid) {
+    payload_registry reg;
+    (void)reg.insert<int>(std::make_shared<const int>(1));
+    EXPECT_FALSE(reg.contains(payload_handle{}));
+    EXPECT_EQ(reg.get<int>(payload_handle{}), nullptr);
+}
+
+TEST(PayloadRegistry, ReusedSlotRejectsStaleHandle) {
+    payload_registry reg;
+    const auto       a = reg.insert<int>(std::make_shared<const int>(1));
+    reg.release(a);
+    EXPECT_EQ(reg.size(), 0u);
+    const auto b = reg.insert<int>(std::make_shared<const int>(2));
+    EXPECT_EQ(b.slot, a.slot);
+    EXPECT_FALSE(reg.contains(a));
+    EXPECT_EQ(reg.get<int>(a), nullptr);
+    ASSERT_NE(reg.get<int>(b), nullptr);
+    EXPECT_EQ(*reg.get<int>(b), 2);
+    reg.release(a); // stale: no effect
+    EXPECT_TRUE(reg.contains(b));
+}
+
+TEST(PayloadRegistry, CarriedByMatchesDragType) {
+    payload_registry reg;
+    const auto       h = reg.insert<int>(std::make_shared<const int>(1), "ROWS");
+    EXPECT_TRUE(reg.carried_by(h, "ROWS"));
+    EXPECT_FALSE(reg.carried_by(h, "COLUMNS"));
+    reg.release(h);
+    EXPECT_FALSE(reg.carried_by(h, "ROWS"));
+}
+
+TEST(PayloadRegistry, ReleaseExceptKeepsOnlyActivePayload) {
+    payload_registry reg;
+    const auto       a = reg.insert<int>(std::make_shared<const int>(1));
+    const auto       b = reg.insert<int>(std::make_shared<const int>(2));
+    const auto       c = reg.insert<int>(std::make_shared<const int>(3));
+    reg.release_except(b);
+    EXPECT_FALSE(reg.contains(a));
+    EXPECT_TRUE(reg.contains(b));
+    EXPECT_FALSE(reg.contains(c));
+    reg.release_except(std::nullopt);
+    EXPECT_EQ(reg.size(), 0u);
+}
+
+TEST(PayloadRegistry, FoundObjectOutlivesRelease) {
+    payload_registry                   reg;
+    std::weak_ptr<const std::string>   weak;
+    std::shared_ptr<const std::string> kept;
+    {
+        auto s       = std::make_shared<const std::string>("dropped");
+        weak         = s;
+        const auto h = reg.insert<std::string>(std::move(s));
+        kept         = reg.find<std::string>(h);
+        reg.release(h);
+    }
+    EXPECT_FALSE(weak.expired());
+    EXPECT_EQ(*kept, "dropped");
+    kept.reset();
+    EXPECT_TRUE(weak.expired());
+}
+
+// --- shared payloads in a running context ---
+
+TEST(SharedPayload, ReleasedOnceDragIsDelivered) {
+    headless   h;
+    drag_scene scene;
+    start_drag(h, scene);
+    EXPECT_EQ(payload_registry::instance().size(), 1u);
+    EXPECT_FALSE(scene.published.expired());
+
+    h.mouse_up();
+    (void)h.widget("dnd", scene, 1); // delivered to the target
+    ASSERT_NE(scene.dropped, nullptr);
+    EXPECT_EQ(*scene.dropped, "payload");
+
+    (void)h.widget("dnd", scene, 1); // next NewFrame sweeps the finished drag
+    EXPECT_EQ(payload_registry::instance().size(), 0u);
+    scene.dropped.reset();
+    EXPECT_TRUE(scene.published.expired());
+}
+
+TEST(SharedPayload, OtherContextDoesNotReleaseActiveDrag) {
+    headless   a;
+    headless   b;
+    drag_scene scene_a;
+    drag_scene scene_b;
+    start_drag(a, scene_a);
+
+    b.make_current();
+    (void)payload_registry::instance(); // hooks b
+    (void)b.widget("dnd", scene_b, 3);  // b's sweeps only look at b's registry
+    a.make_current();
+    EXPECT_EQ(payload_registry::instance().size(), 1u);
+    EXPECT_FALSE(scene_a.published.expired());
+}
+
+TEST(SharedPayload, PlainPayloadOfHandleSizeIsNotMistakenForHandle) {
+    headless   h;
+    drag_scene scene;
+    start_drag(h, scene);
+    const payload_handle live = *peek_payload<payload_handle>("TEXT");
+
+    // Another payload type whose bytes happen to equal the live handle: entry is released
+    (void)h.widget("dnd", [&] {
+        ImGui::Button("source");
+        if (const imgui_util::drag_drop_source src{}) set_payload("OTHER", live);
+    }, 2);
+    EXPECT_FALSE(payload_registry::instance().contains(live));
+}
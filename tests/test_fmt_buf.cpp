@@ -2,6 +2,8 @@
 #include <cstring>
 #include <gtest/gtest.h>
 #include <imgui_util/core/fmt_buf.hpp>
+#include <limits>
+#include <string>
 #include <string_view>
 
 using namespace imgui_util;
@@ -201,3 +203,92 @@ TEST(FmtBuf, SpaceshipBufToStringView) {
     EXPECT_TRUE(buf > std::string_view{"abc"});
     EXPECT_TRUE((buf <=> std::string_view{"hello"}) == 0);
 }
+
+// --- Compile-time fast-path analysis ---
+
+static_assert(detail::fmt::analyze<int>("{:02X}").fast);
+static_assert(detail::fmt::analyze<unsigned>("0x{:08X}: ").fast);
+static_assert(detail::fmt::analyze<double>("[{:>6.1f}s] ").fast);
+static_assert(detail::fmt::analyze<const char *, long>("{}: {:06}").fast);
+static_assert(!detail::fmt::analyze<int>("{:^6}").fast, "centering goes through std::format");
+static_assert(!detail::fmt::analyze<int>("{0}").fast, "manual indices go through std::format");
+static_assert(!detail::fmt::analyze<bool>("{}").fast, "bool goes through std::format");
+
+// --- Fast path output ---
+
+TEST(FmtBufFastPath, Integers) {
+    EXPECT_EQ(fmt_buf<64>("{}", 0).sv(), "0");
+    EXPECT_EQ(fmt_buf<64>("{} {}", -42, 18446744073709551615ull).sv(), "-42 18446744073709551615");
+    EXPECT_EQ(fmt_buf<64>("{}", std::numeric_limits<long long>::min()).sv(), "-9223372036854775808");
+    EXPECT_EQ(fmt_buf<64>("[{:5}|{:<5}|{:06}]", -12, 7, -12).sv(), "[  -12|7    |-00012]");
+}
+
+TEST(FmtBufFastPath, Hex) {
+    EXPECT_EQ(fmt_buf<64>("{:02X}", 10).sv(), "0A");
+    EXPECT_EQ(fmt_buf<64>("0x{:08X}: ", 0xBEEFu).sv(), "0x0000BEEF: ");
+    EXPECT_EQ(fmt_buf<64>("{:x}", -255).sv(), "-ff");
+    EXPECT_EQ(fmt_buf<64>("{:04x}", 0xABCDEFu).sv(), "abcdef");
+}
+
+TEST(FmtBufFastPath, FloatsAndStrings) {
+    EXPECT_EQ(fmt_buf<64>("{:.1f}", 2.25).sv(), "2.2");
+    EXPECT_EQ(fmt_buf<64>("[{:>6.2f}s] ", 3.14159).sv(), "[  3.14s] ");
+    EXPECT_EQ(fmt_buf<64>("{}", 0.1f).sv(), "0.1");
+    EXPECT_EQ(fmt_buf<64>("{}: {}", std::string_view{"key"}, std::string{"value"}).sv(), "key: value");
+    EXPECT_EQ(fmt_buf<64>("{{{}}}", 5).sv(), "{5}");
+}
+
+TEST(FmtBufFastPath, TruncatesLikeFormatToN) {
+    const fmt_buf<8> buf("{:08X}{}", 0x1234u, 99);
+    EXPECT_EQ(buf.sv(), "0000123");
+}
+
+TEST(FmtBufFastPath, AppendMatchesFormatted) {
+    fmt_buf<64> buf("{}", "t=");
+    buf.append("{:.3f} ", 1.5);
+    buf.append("#{:04X}", 0x2Au);
+    EXPECT_EQ(buf.sv(), "t=1.500 #002A");
+}
+
+// --- Append primitives ---
+
+TEST(FmtBufAppend, Primitives) {
+    fmt_buf<64> buf;
+    buf.append_str("id ");
+    buf.append_int(-7, 4);
+    buf.append_str(" ");
+    buf.append_int(42, 5, '0');
+    buf.append_str(" 0x");
+    buf.append_hex(0xCAFEu, 8);
+    buf.append_str(" ");
+    buf.append_hex(255, 0, false);
+    buf.append_str(" ");
+    buf.append_fixed(2.0 / 3.0, 2, 6);
+    EXPECT_EQ(buf.sv(), "id   -7 00042 0x0000CAFE ff   0.67");
+}
+
+TEST(FmtBufAppend, Truncates) {
+    fmt_buf<6> buf;
+    buf.append_str("abc");
+    buf.append_int(123456);
+    EXPECT_EQ(buf.sv(), "abc12");
+    buf.append_hex(1u);
+    EXPECT_EQ(buf.sv(), "abc12");
+    EXPECT_EQ(buf.c_str()[5], '\0');
+}
+
+// --- Runtime format strings ---
+
+TEST(FmtBuf, RuntimeFormat) {
+    const std::string_view spec = "{:.2f} dB";
+    EXPECT_EQ(fmt_buf<64>(runtime_fmt(spec), -3.0).sv(), "-3.00 dB");
+}
+
+TEST(FmtBuf, StdRuntimeFormat) {
+    const std::string_view spec = "{:.2f} dB";
+    EXPECT_EQ(fmt_buf<64>(std::runtime_format(spec), -3.0).sv(), "-3.00 dB");
+
+    fmt_buf<64> buf("gain ");
+    buf.append(std::runtime_format(spec), 1.5);
+    EXPECT_EQ(buf.sv(), "gain 1.50 dB");
+}
@@ -0,0 +1,160 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/hex_viewer.hpp>
+#include <imgui_util/widgets/hotkey_registry.hpp>
+#include <imgui_util/widgets/log_viewer.hpp>
+#include <imgui_util/widgets/settings_panel.hpp>
+#include <imgui_util/widgets/spinner.hpp>
+#include <string>
+#include <vector>
+
+#include "support/headless.hpp"
+
+using imgui_util::testing::draw_stats;
+using imgui_util::testing::headless;
+
+namespace {
+    std::vector<std::byte> pattern(const std::size_t n) {
+        std::vector<std::byte> out(n);
+        for (std::size_t i = 0; i < n; ++i) out[i] = static_cast<std::byte>(i & 0xFF);
+        return out;
+    }
+
+    draw_stats measure_log(headless &h, const int entries) {
+        imgui_util::log_viewer log;
+        log.set_show_timestamps(false);
+        for (int i = 0; i < entries; ++i) log.push(imgui_util::log_level::info, "connection accepted");
+        return h.widget("log", [&] { (void)log.render([](auto &&) {}, "##log"); });
+    }
+} // namespace
+
+TEST(Headless, EmptyWidgetDrawsNothing) {
+    headless h;
+    EXPECT_EQ(h.widget("empty", [] {}), draw_stats{});
+}
+
+TEST(Headless, TextIsOneQuadPerGlyph) {
+    headless         h;
+    const draw_stats s = h.widget("text", [] { ImGui::TextUnformatted("abc"); });
+    EXPECT_EQ(s.vertices, 3 * 4);
+    EXPECT_EQ(s.indices, 3 * 6);
+    EXPECT_EQ(s.commands, 1);
+    EXPECT_EQ(s.lists, 1);
+}
+
+TEST(Headless, HexViewerDrawsOnlyVisibleRows) {
+    // The parent has no background or border, so its list is empty and left out of the draw
+    // data. The child draws its border (and scrollbar) under its outer clip rect, then its
+    // rows under the inner one: two commands.
+    constexpr int max_commands = 2;
+
+    headless                     h({1280.0f, 1400.0f});
+    imgui_util::hex_viewer       hex;
+    const std::vector<std::byte> rows64 = pattern(64 * 16);
+    const draw_stats             small  = h.widget("hex", [&] { hex.render("##hex", rows64); });
+    EXPECT_LE(small.commands, max_commands);
+    EXPECT_GT(small.vertices, 64 * 16 * 2 * 4); // every row's hex digits were drawn
+
+    // Once the data overflows the view, cost no longer depends on its size
+    headless                     h2;
+    const std::vector<std::byte> mid = pattern(std::size_t{1} << 16);
+    const std::vector<std::byte> big = pattern(std::size_t{1} << 22);
+    const draw_stats             a   = h2.widget("hex", [&] { hex.render("##hex", mid); });
+    const draw_stats             b   = h2.widget("hex", [&] { hex.render("##hex", big); });
+    EXPECT_EQ(a, b);
+    EXPECT_LE(b.commands, max_commands);
+}
+
+TEST(Headless, LogViewerRendersVisibleRowsOnly) {
+    headless         h;
+    const draw_stats few  = measure_log(h, 200);
+    const draw_stats many = measure_log(h, 50'000);
+    EXPECT_GT(few.vertices, 0);
+    EXPECT_EQ(few, many);
+}
+
+TEST(Headless, SettingsTreeIsClipped) {
+    const auto measure = [](headless &h, const int sections) {
+        imgui_util::settings_panel panel;
+        for (int i = 0; i < sections; ++i) {
+            const std::string name = "Section " + std::to_string(100'000 + i);
+            (void)panel.section(name, [] {});
+        }
+        return h.widget("settings", [&] { panel.render("##settings"); });
+    };
+    headless h;
+    EXPECT_EQ(measure(h, 200), measure(h, 20'000));
+}
+
+TEST(Headless, SpinnerBatchIsOneCommand) {
+    constexpr int count = 16;
+    headless      h;
+    int           mesh_vtx = 0;
+    const auto    batched  = h.widget("batch", [&] {
+        imgui_util::spinner_batch batch;
+        for (int i = 0; i < count; ++i) batch.add();
+        batch.flush();
+        mesh_vtx = imgui_util::detail::spinner_mesh_for(ImGui::GetWindowDrawList(), 8.0f, 2.0f).vtx_count();
+    });
+    EXPECT_EQ(batched.vertices, count * mesh_vtx);
+    EXPECT_EQ(batched.commands, 1);
+
+    const auto single = h.widget("single", [&] {
+        for (int i = 0; i < count; ++i) {
+            const imgui_util::id scope{i};
+            imgui_util::spinner("##s");
+        }
+    });
+    EXPECT_EQ(single.vertices, batched.vertices);
+}
+
+TEST(Headless, SpinnerBatchKeepsEachSpinnersClipRect) {
+    headless   h;
+    const auto s = h.widget("clip", [&] {
+        imgui_util::spinner_batch batch;
+        ImGui::PushClipRect({0.0f, 0.0f}, {100.0f, 100.0f}, true);
+        batch.add();
+        batch.add();
+        ImGui::PopClipRect();
+        batch.add();
+        batch.flush(); // after the clip scope closed
+    });
+    EXPECT_EQ(s.commands, 2);
+
+    const ImDrawList *dl = ImGui::FindWindowByName("clip")->DrawList;
+    ASSERT_EQ(dl->CmdBuffer.Size, 2);
+    EXPECT_EQ(dl->CmdBuffer[0].ClipRect.z, 100.0f);
+    EXPECT_EQ(dl->CmdBuffer[0].ClipRect.w, 100.0f);
+    EXPECT_GT(dl->CmdBuffer[1].ClipRect.w, 100.0f);
+}
+
+TEST(Headless, SpinnerMeshStaysPutWhileOthersAreBuilt) {
+    headless h;
+    (void)h.frame([] {
+        const ImDrawList                       *dl    = ImGui::GetForegroundDrawList();
+        const imgui_util::detail::spinner_mesh &first = imgui_util::detail::spinner_mesh_for(dl, 3.0f, 1.0f);
+        for (int i = 0; i < 16; ++i) (void)imgui_util::detail::spinner_mesh_for(dl, 100.0f + i, 1.0f);
+        EXPECT_EQ(&imgui_util::detail::spinner_mesh_for(dl, 3.0f, 1.0f), &first);
+    });
+}
+
+TEST(Headless, ScriptedClickPressesButtonOnce) {
+    headless h;
+    int      clicks = 0;
+    (void)h.widget("button", [&] { clicks += ImGui::Button("OK") ? 1 : 0; });
+    h.click({16.0f, 16.0f}); // inside the button at the window padding offset
+    (void)h.widget("button", [&] { clicks += ImGui::Button("OK") ? 1 : 0; }, 4);
+    EXPECT_EQ(clicks, 1);
+}
+
+TEST(Headless, ScriptedChordDispatchesHotkeyOnce) {
+    headless                    h;
+    imgui_util::hotkey_registry reg;
+    int                         saves = 0;
+    ASSERT_TRUE(reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { ++saves; }).has_value());
+
+    h.frames(2);
+    h.press_key(ImGuiKey_S, ImGuiMod_Ctrl);
+    for (int i = 0; i < 3; ++i) (void)h.frame([&] { (void)reg.dispatch(); });
+    EXPECT_EQ(saves, 1);
+}
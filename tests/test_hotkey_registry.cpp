@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/command_palette.hpp>
+#include <imgui_util/widgets/hotkey_registry.hpp>
+#include <imgui_util/widgets/key_binding.hpp>
+
+#include "support/headless.hpp"
+
+using imgui_util::hotkey_registry;
+using imgui_util::key_combo;
+using imgui_util::testing::headless;
+
+namespace {
+
+    // Runs dispatch() for @p n frames and returns how many actions fired. Scripted key events
+    // reach dispatch() through ImGui's InputEventsTrail, like a backend's would.
+    int dispatch_frames(headless &h, hotkey_registry &reg, const int n, const bool text_field = false) {
+        int  fired   = 0;
+        char buf[32] = {};
+        for (int i = 0; i < n; ++i) {
+            (void)h.widget("hotkeys", [&] {
+                if (text_field) {
+                    if (ImGui::GetFrameCount() <= 2) ImGui::SetKeyboardFocusHere();
+                    ImGui::InputText("##field", buf, sizeof(buf));
+                }
+                fired += reg.dispatch();
+            }, 1);
+        }
+        return fired;
+    }
+
+} // namespace
+
+TEST(HotkeyRegistry, TriggersBoundAction) {
+    hotkey_registry reg;
+    int             saves = 0;
+    const auto      id    = reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { ++saves; });
+    ASSERT_TRUE(id.has_value());
+    EXPECT_EQ(reg.find({ImGuiKey_S, ImGuiMod_Ctrl}), *id);
+    EXPECT_TRUE(reg.trigger({ImGuiKey_S, ImGuiMod_Ctrl}));
+    EXPECT_FALSE(reg.trigger({ImGuiKey_S, ImGuiMod_None})); // modifier mask is part of the key
+    EXPECT_FALSE(reg.trigger({ImGuiKey_S, ImGuiMod_Ctrl | ImGuiMod_Shift}));
+    EXPECT_EQ(saves, 1);
+    EXPECT_EQ(reg.name(*id), "Save");
+}
+
+TEST(HotkeyRegistry, RejectsConflictWithHolder) {
+    hotkey_registry reg;
+    const auto      save = reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [] {});
+    const auto      dup  = reg.add("Sort", {ImGuiKey_S, ImGuiMod_Ctrl}, [] {});
+    ASSERT_FALSE(dup.has_value());
+    EXPECT_EQ(dup.error(), *save);
+    EXPECT_EQ(reg.size(), 1u);
+    EXPECT_TRUE(reg.add("Save as", {ImGuiKey_S, ImGuiMod_Ctrl | ImGuiMod_Shift}, [] {}).has_value());
+}
+
+TEST(HotkeyRegistry, UnboundActionsNeverConflict) {
+    hotkey_registry reg;
+    EXPECT_TRUE(reg.add("A", {}, [] {}).has_value());
+    EXPECT_TRUE(reg.add("B", {}, [] {}).has_value());
+    EXPECT_TRUE(reg.add("C", {ImGuiKey_LeftCtrl, ImGuiMod_None}, [] {}).has_value()); // modifier alone
+    EXPECT_EQ(reg.size(), 3u);
+    EXPECT_EQ(reg.find({}), hotkey_registry::invalid_id);
+}
+
+TEST(HotkeyRegistry, RebindMovesSlot) {
+    hotkey_registry reg;
+    const auto      a = *reg.add("A", {ImGuiKey_F1, ImGuiMod_None}, [] {});
+    const auto      b = *reg.add("B", {ImGuiKey_F2, ImGuiMod_None}, [] {});
+
+    const auto clash = reg.rebind(a, {ImGuiKey_F2, ImGuiMod_None});
+    ASSERT_FALSE(clash.has_value());
+    EXPECT_EQ(clash.error(), b);
+    EXPECT_EQ(reg.find({ImGuiKey_F1, ImGuiMod_None}), a); // unchanged on conflict
+
+    EXPECT_TRUE(reg.rebind(a, {ImGuiKey_F3, ImGuiMod_Alt}).has_value());
+    EXPECT_EQ(reg.find({ImGuiKey_F1, ImGuiMod_None}), hotkey_registry::invalid_id);
+    EXPECT_EQ(reg.find({ImGuiKey_F3, ImGuiMod_Alt}), a);
+    EXPECT_TRUE(reg.rebind(a, {ImGuiKey_F3, ImGuiMod_Alt}).has_value()); // same combo is not a conflict
+}
+
+TEST(HotkeyRegistry, RemoveFreesComboAndKeepsIds) {
+    hotkey_registry reg;
+    int             hits = 0;
+    const auto      a    = *reg.add("A", {ImGuiKey_Z, ImGuiMod_Ctrl}, [&] { ++hits; });
+    const auto      b    = *reg.add("B", {ImGuiKey_Y, ImGuiMod_Ctrl}, [&] { hits += 10; });
+    reg.remove(a);
+    EXPECT_FALSE(reg.contains(a));
+    EXPECT_TRUE(reg.name(a).empty());
+    EXPECT_FALSE(reg.trigger({ImGuiKey_Z, ImGuiMod_Ctrl}));
+
+    const auto c = *reg.add("C", {ImGuiKey_Z, ImGuiMod_Ctrl}, [&] { hits += 100; });
+    EXPECT_NE(c, a);
+    EXPECT_TRUE(reg.trigger({ImGuiKey_Y, ImGuiMod_Ctrl}));
+    EXPECT_TRUE(reg.trigger({ImGuiKey_Z, ImGuiMod_Ctrl}));
+    EXPECT_EQ(hits, 110);
+    EXPECT_EQ(reg.combo(b).key, ImGuiKey_Y);
+    EXPECT_EQ(reg.size(), 2u);
+}
+
+TEST(HotkeyRegistry, RebindUnknownIdFails) {
+    hotkey_registry reg;
+    const auto      a = *reg.add("A", {ImGuiKey_F1, ImGuiMod_None}, [] {});
+    reg.remove(a);
+    const auto gone = reg.rebind(a, {ImGuiKey_F2, ImGuiMod_None});
+    ASSERT_FALSE(gone.has_value());
+    EXPECT_EQ(gone.error(), hotkey_registry::invalid_id);
+    EXPECT_FALSE(reg.rebind(a + 1, {}).has_value()); // never handed out
+    EXPECT_EQ(reg.find({ImGuiKey_F2, ImGuiMod_None}), hotkey_registry::invalid_id);
+}
+
+TEST(HotkeyRegistry, ClearNeverReusesIds) {
+    hotkey_registry reg;
+    const auto      a = *reg.add("A", {ImGuiKey_F1, ImGuiMod_None}, [] {});
+    const auto      b = *reg.add("B", {ImGuiKey_F2, ImGuiMod_None}, [] {});
+    reg.clear();
+    EXPECT_TRUE(reg.empty());
+    const auto c = *reg.add("C", {ImGuiKey_F1, ImGuiMod_None}, [] {});
+    EXPECT_NE(c, a);
+    EXPECT_NE(c, b);
+    EXPECT_FALSE(reg.contains(a));
+    EXPECT_FALSE(reg.contains(b));
+    EXPECT_TRUE(reg.contains(c));
+    EXPECT_TRUE(reg.name(a).empty());
+    EXPECT_EQ(reg.name(c), "C");
+}
+
+// --- dispatch() in a running context ---
+
+TEST(HotkeyDispatch, RepeatFiresWhileHeldAndStopsOnRelease) {
+    headless        h;
+    hotkey_registry reg;
+    int             next = 0;
+    int             once = 0;
+    ASSERT_TRUE(reg.add("Next", {ImGuiKey_F3, ImGuiMod_None}, [&] { ++next; }, true).has_value());
+    ASSERT_TRUE(reg.add("Once", {ImGuiKey_F4, ImGuiMod_None}, [&] { ++once; }).has_value());
+    (void)dispatch_frames(h, reg, 2);
+
+    // Held for one second: past ImGui's repeat delay, so repeats arrive for F3 only
+    h.key_down(ImGuiKey_F3);
+    h.key_down(ImGuiKey_F4);
+    (void)dispatch_frames(h, reg, 60);
+    EXPECT_GT(next, 1);
+    EXPECT_EQ(once, 1);
+
+    h.key_up(ImGuiKey_F3);
+    h.key_up(ImGuiKey_F4);
+    (void)dispatch_frames(h, reg, 2);
+    const int released = next;
+    (void)dispatch_frames(h, reg, 30);
+    EXPECT_EQ(next, released);
+    EXPECT_EQ(once, 1);
+}
+
+TEST(HotkeyDispatch, RepeatStopsWhenModifierIsReleased) {
+    headless        h;
+    hotkey_registry reg;
+    int             zooms = 0;
+    ASSERT_TRUE(reg.add("Zoom", {ImGuiKey_Equal, ImGuiMod_Ctrl}, [&] { ++zooms; }, true).has_value());
+    (void)dispatch_frames(h, reg, 2);
+
+    h.key_down(ImGuiMod_Ctrl);
+    h.key_down(ImGuiKey_Equal);
+    (void)dispatch_frames(h, reg, 40);
+    EXPECT_GT(zooms, 1);
+
+    h.key_up(ImGuiMod_Ctrl); // '=' still held: no longer the bound combo
+    (void)dispatch_frames(h, reg, 2);
+    const int after_release = zooms;
+    (void)dispatch_frames(h, reg, 30);
+    EXPECT_EQ(zooms, after_release);
+}
+
+TEST(HotkeyDispatch, TextFieldKeepsUnmodifiedKeys) {
+    headless        h;
+    hotkey_registry reg;
+    int             plain = 0;
+    int             ctrl  = 0;
+    ASSERT_TRUE(reg.add("Plain", {ImGuiKey_A, ImGuiMod_None}, [&] { ++plain; }).has_value());
+    ASSERT_TRUE(reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { ++ctrl; }).has_value());
+    (void)dispatch_frames(h, reg, 4, true); // focus the text field
+    ASSERT_TRUE(ImGui::GetIO().WantTextInput);
+
+    h.press_key(ImGuiKey_A);
+    h.press_key(ImGuiKey_S, ImGuiMod_Ctrl);
+    (void)dispatch_frames(h, reg, 6, true);
+    EXPECT_EQ(plain, 0); // typed into the field instead
+    EXPECT_EQ(ctrl, 1);
+
+    (void)dispatch_frames(h, reg, 2); // field gone; WantTextInput clears a frame later
+    h.press_key(ImGuiKey_A);
+    (void)dispatch_frames(h, reg, 4);
+    EXPECT_EQ(plain, 1);
+}
+
+TEST(HotkeyDispatch, KeyCaptureInOtherContextDoesNotBlock) {
+    headless   editor;
+    key_combo  edited{};
+    const auto edit = [&] {
+        (void)editor.widget("editor", [&] { (void)imgui_util::key_binding_editor("Key", &edited); }, 1);
+    };
+    edit();
+    editor.click({16.0f, 16.0f}); // inside the binding button: starts capturing
+    for (int i = 0; i < 3; ++i) edit();
+
+    headless        h;
+    hotkey_registry reg;
+    int             saves = 0;
+    ASSERT_TRUE(reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { ++saves; }).has_value());
+    (void)dispatch_frames(h, reg, 2);
+    h.press_key(ImGuiKey_S, ImGuiMod_Ctrl);
+    for (int i = 0; i < 4; ++i) {
+        edit(); // still capturing, in its own context
+        (void)dispatch_frames(h, reg, 1);
+    }
+    EXPECT_EQ(saves, 1);
+}
+
+// --- add_to(command_palette&) ---
+
+TEST(HotkeyPalette, ShowsShortcutAfterRebind) {
+    headless                    h;
+    hotkey_registry             reg;
+    imgui_util::command_palette palette;
+    int                         saves = 0;
+
+    const auto save = *reg.add("Save", {ImGuiKey_S, ImGuiMod_Ctrl}, [&] { ++saves; });
+    reg.add_to(palette);
+    palette.open();
+    const auto shown = [&] {
+        for (int i = 0; i < 3; ++i) (void)h.frame([&] { palette.render(); });
+        return h.stats("##cmd_palette");
+    };
+
+    const auto before = shown(); // "Ctrl+S"
+    ASSERT_TRUE(reg.rebind(save, {ImGuiKey_S, ImGuiMod_Ctrl | ImGuiMod_Shift}).has_value());
+    const auto after = shown(); // "Ctrl+Shift+S": six more glyphs, one quad each
+    EXPECT_EQ(after.vertices - before.vertices, 6 * 4);
+
+    h.press_key(ImGuiKey_Enter);
+    (void)shown();
+    EXPECT_EQ(saves, 1);
+}
@@ -0,0 +1,52 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <imgui_internal.h>
+#include <imgui_util/core/label_id.hpp>
+#include <string_view>
+
+using namespace imgui_util;
+
+// --- compile-time evaluation ---
+
+static_assert("##entries"_id.id(0) == hash_label("##entries"));
+static_assert("##entries"_id.view() == "##entries");
+static_assert(""_id.id(0x1234u) == 0x1234u, "empty label keeps the seed, like GetID(\"\")");
+
+namespace {
+
+    constexpr std::array<ImGuiID, 5> seeds = {0u, 1u, 0xDEADBEEFu, 0x80000000u, 0xFFFFFFFFu};
+
+} // namespace
+
+// --- hash_label ---
+
+TEST(HashLabel, MatchesImHashStr) {
+    for (const std::string_view s: {"", "a", "##entries", "Save###save_btn", "####", "#x##y", "long label with spaces"})
+        for (const ImGuiID seed: seeds) EXPECT_EQ(hash_label(s, seed), ImHashStr(s.data(), s.size(), seed)) << s;
+}
+
+// --- label_id ---
+
+TEST(LabelId, MatchesRuntimeHashForAnySeed) {
+    constexpr label_id labels[] = {"##entries"_id, "##search"_id, "##diff_left"_id, "##timeline_canvas"_id, "x"_id};
+    for (const label_id l: labels)
+        for (const ImGuiID seed: seeds) EXPECT_EQ(l.id(seed), hash_label(l.view(), seed)) << l.c_str();
+}
+
+TEST(LabelId, TripleHashUsesTailOnly) {
+    constexpr label_id a = "Open###file_menu"_id;
+    constexpr label_id b = "Abrir###file_menu"_id;
+    EXPECT_STREQ(a.c_str(), "Open###file_menu");
+    for (const ImGuiID seed: seeds) {
+        EXPECT_EQ(a.id(seed), b.id(seed));
+        EXPECT_EQ(a.id(seed), hash_label("###file_menu", seed));
+    }
+    EXPECT_EQ("a###b###c"_id.id(7), hash_label("a###b###c", 7)); // last "###" wins
+    EXPECT_EQ("####"_id.id(7), hash_label("####", 7));
+}
+
+TEST(LabelId, OfMatchesLiteral) {
+    constexpr label_id l = label_id::of<"##row">();
+    EXPECT_EQ(l.id(42), "##row"_id.id(42));
+    EXPECT_EQ(l.view().size(), 5u);
+}
@@ -4,6 +4,9 @@
 #include <gtest/gtest.h>
 #include <imgui_util/core/parse.hpp>
 #include <span>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace imgui_util::parse;
 
@@ -246,3 +249,186 @@ TEST(ParseFloatComponents, WhitespacePaddedCsv) {
     EXPECT_NEAR(arr[1], 2.0f, 0.001f);
     EXPECT_NEAR(arr[2], 3.0f, 0.001f);
 }
+
+// --- Bulk parsing ---
+
+namespace {
+
+    constexpr std::size_t sum_ints(const std::string_view sv) {
+        std::array<int, 8> out{};
+        const auto         r = parse_numbers(sv, std::span{out});
+        std::size_t        s = 0;
+        for (std::size_t i = 0; i < r.count; ++i) s += static_cast<std::size_t>(out[i]);
+        return s;
+    }
+
+    // Plain scalar split, independent of the library
+    std::vector<std::pair<std::size_t, std::size_t>> reference_tokens(const std::string_view sv, const char delim) {
+        std::vector<std::pair<std::size_t, std::size_t>> v;
+        auto sep = [&](const char c) { return c == delim || c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+        for (std::size_t i = 0; i < sv.size();) {
+            if (sep(sv[i])) {
+                ++i;
+                continue;
+            }
+            const std::size_t first = i;
+            while (i < sv.size() && !sep(sv[i])) ++i;
+            v.emplace_back(first, i - first);
+        }
+        return v;
+    }
+
+} // namespace
+
+static_assert(sum_ints("1, 2,3\n 4") == 10);
+static_assert(count_tokens(",, 7 ,\t8,,") == 2);
+static_assert(parse_numbers("1,x,3", std::span<int>{}).next == 0);
+
+TEST(ForEachToken, MatchesScalarReferenceAcrossBlockBoundaries) {
+    EXPECT_FALSE(scan_backend().empty());
+    std::uint32_t state = 3;
+    for (const std::size_t len: {0u, 1u, 31u, 32u, 33u, 64u, 100u, 4095u, 4096u, 4097u, 9000u}) {
+        std::string text(len, 'x');
+        for (char &c: text) {
+            state = state * 1664525u + 1013904223u;
+            c     = ",; \t\r\n12.5e"[(state >> 24) % 12];
+        }
+        for (const char delim: {',', ';'}) {
+            std::vector<std::pair<std::size_t, std::size_t>> got;
+            for_each_token(text, delim, [&](const std::string_view t, const std::size_t at) {
+                got.emplace_back(at, t.size());
+                return true;
+            });
+            EXPECT_EQ(got, reference_tokens(text, delim)) << "length " << len;
+        }
+    }
+}
+
+TEST(ForEachToken, TokenSpanningWordsAndEarlyStop) {
+    const std::string text = std::string(40, ' ') + std::string(70, '7') + ",8";
+    std::size_t       calls = 0;
+    const std::size_t n     = for_each_token(text, ',', [&](const std::string_view t, const std::size_t at) {
+        EXPECT_EQ(at, 40u);
+        EXPECT_EQ(t.size(), 70u);
+        ++calls;
+        return false;
+    });
+    EXPECT_EQ(n, 1u);
+    EXPECT_EQ(calls, 1u);
+}
+
+TEST(ParseNumbers, CsvTableIntoSpan) {
+    const std::string_view csv = "1.5, 2.5, 3.5\n-4, 5e2, 6\r\n";
+    std::vector<double>    out(count_tokens(csv));
+    const auto             r = parse_numbers(csv, std::span{out});
+    EXPECT_TRUE(r.ok());
+    EXPECT_EQ(r.count, 6u);
+    EXPECT_EQ(r.next, csv.size());
+    EXPECT_DOUBLE_EQ(out[4], 500.0);
+    EXPECT_DOUBLE_EQ(out[3], -4.0);
+}
+
+TEST(ParseNumbers, ReportsErrorOffset) {
+    const std::string_view text = "10 20 3x0 40";
+    std::array<int, 4>     out{};
+    const auto             r = parse_numbers(text, std::span{out}, ' ');
+    EXPECT_FALSE(r.ok());
+    EXPECT_EQ(r.count, 2u);
+    EXPECT_EQ(r.error, 6u);
+    EXPECT_EQ(out[1], 20);
+}
+
+TEST(ParseNumbers, FullOutputReportsResumeOffset) {
+    const std::string_view text = "1;2;3;4";
+    std::array<float, 2>   out{};
+    const auto             r = parse_numbers(text, std::span{out}, ';');
+    EXPECT_TRUE(r.ok());
+    EXPECT_EQ(r.count, 2u);
+    EXPECT_EQ(r.next, 4u);
+    const auto rest = parse_numbers(text.substr(r.next), std::span{out}, ';');
+    EXPECT_EQ(rest.count, 2u);
+    EXPECT_FLOAT_EQ(out[1], 4.0f);
+}
+
+// --- key=value config reader ---
+
+namespace {
+
+    std::vector<config_entry> collect_entries(const std::string_view text) {
+        std::vector<config_entry> v;
+        for_each_config_entry(text, [&](const config_entry &e) { v.push_back(e); });
+        return v;
+    }
+
+    constexpr std::size_t count_entries(const std::string_view text) {
+        return for_each_config_entry(text, [](const config_entry &) {});
+    }
+
+} // namespace
+
+static_assert(count_entries("a=1\nno equals\n\nb=2=3\r\nc=") == 3);
+
+TEST(ConfigEntries, SplitsOnFirstEqualsAndStripsCr) {
+    const auto e = collect_entries("version=1\r\n# comment\nname=My = Theme\nempty=\nlast=x");
+    ASSERT_EQ(e.size(), 4u);
+    EXPECT_EQ(e[0].key, "version");
+    EXPECT_EQ(e[0].value, "1");
+    EXPECT_EQ(e[1].key, "name");
+    EXPECT_EQ(e[1].value, "My = Theme");
+    EXPECT_EQ(e[1].line, 3u);
+    EXPECT_EQ(e[2].value, "");
+    EXPECT_EQ(e[3].key, "last");
+    EXPECT_EQ(e[3].value, "x");
+    EXPECT_EQ(e[3].line, 5u);
+}
+
+TEST(ConfigEntries, MatchesLineByLineSplitOnLargeInput) {
+    std::string text;
+    for (int i = 0; i < 10'000; ++i) {
+        text += "key_" + std::to_string(i);
+        if (i % 7 != 0) text += "=" + std::to_string(i * 3) + (i % 5 == 0 ? "=x" : "");
+        text += i % 3 == 0 ? "\r\n" : "\n";
+    }
+    const auto  e    = collect_entries(text);
+    std::size_t line = 0;
+    std::size_t k    = 0;
+    for (std::size_t pos = 0; pos < text.size(); ++line) {
+        const std::size_t nl = text.find('\n', pos);
+        std::string_view  l  = std::string_view{text}.substr(pos, nl - pos);
+        pos                  = nl + 1;
+        if (l.ends_with('\r')) l.remove_suffix(1);
+        const std::size_t eq = l.find('=');
+        if (eq == std::string_view::npos) continue;
+        ASSERT_LT(k, e.size());
+        EXPECT_EQ(e[k].key, l.substr(0, eq));
+        EXPECT_EQ(e[k].value, l.substr(eq + 1));
+        EXPECT_EQ(e[k].line, line + 1);
+        ++k;
+    }
+    EXPECT_EQ(k, e.size());
+}
+
+TEST(ConfigBinder, BindsTypedValues) {
+    int         size  = 0;
+    bool        vsync = false;
+    float       scale = 1.0f;
+    std::string title;
+    ImVec2      pos{5.0f, 6.0f};
+
+    config_binder b;
+    b.bind("size", size).bind("vsync", vsync).bind("scale", scale).bind("title", title).bind("pos", pos);
+    const auto r = b.load("size=14\nvsync=true\nscale=oops\ntitle=Tool\npos=10, 20\nunknown=1\n");
+    EXPECT_EQ(r.applied, 4u);
+    EXPECT_EQ(r.unknown, 1u);
+    EXPECT_EQ(r.invalid, 1u);
+    EXPECT_EQ(r.invalid_line, 3u);
+    EXPECT_EQ(size, 14);
+    EXPECT_TRUE(vsync);
+    EXPECT_FLOAT_EQ(scale, 1.0f); // unchanged on parse failure
+    EXPECT_EQ(title, "Tool");
+    EXPECT_FLOAT_EQ(pos.y, 20.0f);
+}
+
+TEST(ReadTextFile, MissingFileIsNullopt) {
+    EXPECT_FALSE(read_text_file("/nonexistent/imgui_util/settings.ini").has_value());
+}
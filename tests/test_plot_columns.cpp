@@ -0,0 +1,119 @@
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/columns.hpp>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+namespace {
+
+    // 8 columns of differently shaped noise over 20k shared timestamps
+    shared_x_store<double, float> make_store(const std::size_t rows = 20'000) {
+        shared_x_store<double, float> store{8};
+        std::vector<float>            row(8);
+        std::uint32_t                 state = 11;
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < row.size(); ++j) {
+                state  = state * 1664525u + 1013904223u;
+                row[j] = static_cast<float>(std::sin(0.001 * static_cast<double>(i * (j + 1)))) +
+                         static_cast<float>(state >> 20) / 4096.0f;
+            }
+            store.push_row(static_cast<double>(i) * 0.5, row);
+        }
+        return store;
+    }
+
+    void expect_same(const std::vector<ImPlotPoint> &a, const std::vector<ImPlotPoint> &b) {
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            ASSERT_EQ(a[i].x, b[i].x) << i;
+            ASSERT_EQ(a[i].y, b[i].y) << i;
+        }
+    }
+
+    // Every column must match decimate() on its own xy_series.
+    void expect_matches_per_series(const shared_x_store<double, float> &store, const double x_min, const double x_max,
+                                   const int width, const decimation method) {
+        shared_x_cache cache;
+        const auto     all = cache.update(store, x_min, x_max, width, method);
+        ASSERT_EQ(all.size(), store.columns());
+        std::vector<ImPlotPoint> ref;
+        for (std::size_t j = 0; j < store.columns(); ++j) {
+            const auto s = store.series(j);
+            decimate(s, visible_range(s, x_min, x_max), x_min, x_max, width, method, ref);
+            expect_same(all[j], ref);
+        }
+    }
+
+} // namespace
+
+TEST(SharedXStore, PushRowPadsMissingValues) {
+    shared_x_store<double, float> store{3};
+    const std::vector<float>      row = {1.0f};
+    store.push_row(0.0, row);
+    EXPECT_EQ(store.size(), 1u);
+    EXPECT_EQ(store.ys(0)[0], 1.0f);
+    EXPECT_TRUE(std::isnan(store.ys(2)[0]));
+}
+
+TEST(SharedXStore, AppendColumnsKeepsColumnsAligned) {
+    shared_x_store<double, int>             store{2};
+    const std::vector<double>               xs = {0, 1, 2};
+    const std::vector<int>                  a  = {1, 2, 3};
+    const std::vector<int>                  b  = {4};
+    const std::vector<std::span<const int>> cols{a, b};
+    const std::uint64_t                     v = store.version();
+    store.append(xs, cols);
+    EXPECT_GT(store.version(), v);
+    ASSERT_EQ(store.ys(1).size(), 3u);
+    EXPECT_EQ(store.ys(0)[2], 3);
+    EXPECT_EQ(store.ys(1)[0], 4);
+    EXPECT_EQ(store.ys(1)[2], 0); // integral columns pad with 0
+}
+
+TEST(SharedXCache, MinmaxMatchesPerSeriesDecimation) {
+    const auto store = make_store();
+    expect_matches_per_series(store, 0.0, 10'000.0, 300, decimation::minmax);
+    expect_matches_per_series(store, 1234.5, 4321.0, 97, decimation::minmax);
+}
+
+TEST(SharedXCache, LttbAndPassThroughMatchPerSeries) {
+    const auto store = make_store();
+    expect_matches_per_series(store, 100.0, 9000.0, 200, decimation::lttb);
+    expect_matches_per_series(store, 100.0, 150.0, 800, decimation::minmax); // few samples: copied
+}
+
+TEST(SharedXCache, OneVisibleRangeForAllColumns) {
+    const auto     store = make_store(1000);
+    shared_x_cache cache;
+    (void)cache.update(store, 100.0, 200.0, 50);
+    EXPECT_EQ(cache.visible(), visible_range(store.series(0), 100.0, 200.0));
+    EXPECT_EQ(cache.visible(), visible_range(store.series(7), 100.0, 200.0));
+}
+
+TEST(SharedXCache, RebuildsOnlyOnKeyChange) {
+    auto           store = make_store(1000);
+    shared_x_cache cache;
+    (void)cache.update(store, 0.0, 500.0, 100);
+    (void)cache.update(store, 0.0, 500.0, 100);
+    EXPECT_EQ(cache.rebuilds(), 1);
+
+    const std::vector<float> row(8, 0.0f);
+    store.push_row(500.0, row);
+    (void)cache.update(store, 0.0, 500.0, 100);
+    EXPECT_EQ(cache.rebuilds(), 2);
+    (void)cache.update(store, 0.0, 400.0, 100);
+    EXPECT_EQ(cache.rebuilds(), 3);
+}
+
+TEST(SharedXCache, EmptyStoreAndZeroWidth) {
+    shared_x_store<double, float> empty{4};
+    shared_x_cache                cache;
+    const auto                    pts = cache.update(empty, 0.0, 1.0, 100);
+    ASSERT_EQ(pts.size(), 4u);
+    EXPECT_TRUE(pts[0].empty());
+
+    const auto store = make_store(1000);
+    for (const auto &p: cache.update(store, 0.0, 100.0, 0)) EXPECT_TRUE(p.empty());
+}
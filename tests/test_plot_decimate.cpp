@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/decimate.hpp>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+namespace {
+
+    struct DecimateRamp : ::testing::Test {
+        std::vector<double> xs;
+        std::vector<float>  ys;
+
+        void SetUp() override {
+            constexpr int n = 100'000;
+            xs.resize(n);
+            ys.resize(n);
+            for (int i = 0; i < n; i++) {
+                xs[i] = i * 0.01;
+                ys[i] = std::sin(static_cast<float>(i) * 0.001f);
+            }
+            ys[54'321] = 10.0f; // single-sample spike
+        }
+    };
+
+} // namespace
+
+static_assert(plot_series<xy_series<double, float>>);
+static_assert(plot_series<uniform_series<int>>);
+
+// --- visible_range ---
+
+TEST(VisibleRange, PadsOneSampleEachSide) {
+    const std::vector<double> xs = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(visible_range(xy_series{xs, xs}, 2.5, 6.5), (index_range{2, 8}));
+    EXPECT_EQ(visible_range(xy_series{xs, xs}, 3.0, 6.0), (index_range{2, 8}));
+}
+
+TEST(VisibleRange, ClampsAtEnds) {
+    const std::vector<double> xs = {0, 1, 2, 3};
+    EXPECT_EQ(visible_range(xy_series{xs, xs}, -10.0, 10.0), (index_range{0, 4}));
+    EXPECT_EQ(visible_range(xy_series{xs, xs}, 5.0, 6.0), (index_range{3, 4}));
+    EXPECT_TRUE(visible_range(xy_series<double>{}, 0.0, 1.0).empty());
+}
+
+TEST(VisibleRange, UniformSeries) {
+    const std::vector<int> ys(1000, 0);
+    EXPECT_EQ(visible_range(uniform_series{ys, 100.0, 0.5}, 200.0, 300.0), (index_range{199, 402}));
+}
+
+// --- decimate_minmax ---
+
+TEST_F(DecimateRamp, MinMaxBoundsPointCount) {
+    const xy_series          s{xs, ys};
+    std::vector<ImPlotPoint> out;
+    decimate(s, visible_range(s, 0.0, 1000.0), 0.0, 1000.0, 800, decimation::minmax, out);
+    EXPECT_LE(out.size(), 2u * 800 + 2);
+    EXPECT_GE(out.size(), 800u);
+}
+
+TEST_F(DecimateRamp, MinMaxKeepsSpikeAndEnvelope) {
+    const xy_series          s{xs, ys};
+    std::vector<ImPlotPoint> out;
+    decimate(s, visible_range(s, 0.0, 1000.0), 0.0, 1000.0, 300, decimation::minmax, out);
+    const auto [lo, hi] = std::ranges::minmax(out, {}, &ImPlotPoint::y);
+    EXPECT_DOUBLE_EQ(hi.y, 10.0);
+    EXPECT_DOUBLE_EQ(lo.y, *std::ranges::min_element(ys));
+}
+
+TEST_F(DecimateRamp, MinMaxOutputIsXOrdered) {
+    const xy_series          s{xs, ys};
+    std::vector<ImPlotPoint> out;
+    decimate(s, visible_range(s, 123.4, 567.8), 123.4, 567.8, 640, decimation::minmax, out);
+    EXPECT_TRUE(std::ranges::is_sorted(out, {}, &ImPlotPoint::x));
+    EXPECT_LT(out.front().x, 123.4); // padding sample reaches the left edge
+    EXPECT_GT(out.back().x, 567.8);
+}
+
+// --- decimate_lttb ---
+
+TEST_F(DecimateRamp, LttbExactCountAndEndpoints) {
+    const xy_series          s{xs, ys};
+    std::vector<ImPlotPoint> out;
+    decimate_lttb(s, {0, xs.size()}, 500, out);
+    ASSERT_EQ(out.size(), 500u);
+    EXPECT_DOUBLE_EQ(out.front().x, xs.front());
+    EXPECT_DOUBLE_EQ(out.back().x, xs.back());
+    EXPECT_TRUE(std::ranges::is_sorted(out, {}, &ImPlotPoint::x));
+}
+
+TEST(DecimateLttb, SmallInputCopied) {
+    const std::vector<double> xs = {0, 1, 2};
+    std::vector<ImPlotPoint>  out;
+    decimate_lttb(xy_series{xs, xs}, {0, 3}, 10, out);
+    EXPECT_EQ(out.size(), 3u);
+}
+
+// --- decimate ---
+
+TEST(Decimate, PassesThroughSparseWindow) {
+    const std::vector<double> xs = {0, 1, 2, 3, 4};
+    std::vector<ImPlotPoint>  out;
+    decimate(xy_series{xs, xs}, {0, 5}, 0.0, 4.0, 100, decimation::minmax, out);
+    ASSERT_EQ(out.size(), 5u);
+    EXPECT_DOUBLE_EQ(out[3].y, 3.0);
+}
+
+TEST(Decimate, ZeroWidthEmitsNothing) {
+    const std::vector<double> xs = {0, 1, 2};
+    std::vector<ImPlotPoint>  out{{1.0, 1.0}};
+    decimate(xy_series{xs, xs}, {0, 3}, 0.0, 2.0, 0, decimation::minmax, out);
+    EXPECT_TRUE(out.empty());
+}
+
+// --- decimation_cache ---
+
+TEST_F(DecimateRamp, CacheRebuildsOnlyOnKeyChange) {
+    const xy_series  s{xs, ys};
+    decimation_cache cache;
+    cache.update(s, 1, 0.0, 100.0, 400);
+    cache.update(s, 1, 0.0, 100.0, 400);
+    EXPECT_EQ(cache.rebuilds(), 1);
+
+    cache.update(s, 1, 10.0, 100.0, 400); // pan
+    cache.update(s, 1, 10.0, 100.0, 500); // resize
+    cache.update(s, 2, 10.0, 100.0, 500); // new data
+    cache.update(s, 2, 10.0, 100.0, 500, decimation::lttb);
+    EXPECT_EQ(cache.rebuilds(), 5);
+
+    cache.invalidate();
+    cache.update(s, 2, 10.0, 100.0, 500, decimation::lttb);
+    EXPECT_EQ(cache.rebuilds(), 6);
+    EXPECT_EQ(cache.points().size(), 1000u);
+}
+
+TEST_F(DecimateRamp, CacheKeySeparatesReductionFamilies) {
+    decimation_cache cache;
+    int              fills = 0;
+    const auto       fill  = [&](std::vector<ImPlotPoint> &out) {
+        out.clear();
+        ++fills;
+    };
+    const std::uint8_t mode = 0;
+    cache.update_with(1, 0.0, 100.0, 400, {reduction_key::family::decimate, mode}, fill);
+    cache.update_with(1, 0.0, 100.0, 400, {reduction_key::family::pyramid, mode}, fill);
+    cache.update_with(1, 0.0, 100.0, 400, {reduction_key::family::pyramid, mode}, fill);
+    EXPECT_EQ(fills, 2);
+}
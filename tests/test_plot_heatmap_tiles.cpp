@@ -0,0 +1,170 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/heatmap_tiles.hpp>
+#include <limits>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+namespace {
+
+    const ImU32 black = IM_COL32(0, 0, 0, 255);
+    const ImU32 white = IM_COL32(255, 255, 255, 255);
+
+    colormap_lut gray() {
+        const std::vector<ImU32> keys = {black, white};
+        return colormap_lut{keys};
+    }
+
+    // 0 / 1 checkerboard of single cells
+    std::vector<float> checkerboard(const int rows, const int cols) {
+        std::vector<float> v(static_cast<std::size_t>(rows) * static_cast<std::size_t>(cols));
+        for (int r = 0; r < rows; r++)
+            for (int c = 0; c < cols; c++) v[static_cast<std::size_t>(r * cols + c)] = static_cast<float>((r + c) % 2);
+        return v;
+    }
+
+} // namespace
+
+// --- colormap_lut ---
+
+TEST(ColormapLut, EndpointsMatchKeys) {
+    const colormap_lut lut = gray();
+    EXPECT_EQ(lut(0.0f), black);
+    EXPECT_EQ(lut(1.0f), white);
+    EXPECT_EQ(lut(-5.0f), black);
+    EXPECT_EQ(lut(5.0f), white);
+    const ImU32 mid = lut(0.5f);
+    EXPECT_GT(mid & 0xFFu, 0x40u);
+    EXPECT_LT(mid & 0xFFu, 0xD0u);
+}
+
+// --- rasterize_tile ---
+
+TEST(RasterizeTile, BlockMeanMapsThroughLut) {
+    const auto         v   = checkerboard(4, 4);
+    const colormap_lut lut = gray();
+    std::vector<ImU32> px;
+
+    const auto [w0, h0] = rasterize_tile({v, 4, 4, 0.0, 1.0}, {0, 0, 0}, 4, lut, px);
+    ASSERT_EQ(w0, 4);
+    ASSERT_EQ(h0, 4);
+    EXPECT_EQ(px[0], black);
+    EXPECT_EQ(px[1], white);
+
+    const auto [w1, h1] = rasterize_tile({v, 4, 4, 0.0, 1.0}, {1, 0, 0}, 4, lut, px);
+    ASSERT_EQ(w1, 2);
+    ASSERT_EQ(h1, 2);
+    for (const ImU32 c: px) EXPECT_EQ(c, lut(0.5f)); // every 2x2 block averages to 0.5
+}
+
+TEST(RasterizeTile, EdgeTilesAreSmallerAndNanIsTransparent) {
+    std::vector<float> v(5 * 3, 1.0f);
+    v[0]                   = std::numeric_limits<float>::quiet_NaN();
+    const colormap_lut lut = gray();
+    std::vector<ImU32> px;
+
+    const auto [w, h] = rasterize_tile({v, 3, 5, 0.0, 1.0}, {0, 1, 0}, 4, lut, px); // cols 4..4
+    EXPECT_EQ(w, 1);
+    EXPECT_EQ(h, 3);
+
+    rasterize_tile({v, 3, 5, 0.0, 1.0}, {0, 0, 0}, 4, lut, px);
+    EXPECT_EQ(px[0], 0u);
+    EXPECT_EQ(px[1], white);
+
+    const auto [we, he] = rasterize_tile({v, 3, 5, 0.0, 1.0}, {0, 2, 0}, 4, lut, px); // past the grid
+    EXPECT_EQ(we, 0);
+    EXPECT_EQ(he, 0);
+    EXPECT_TRUE(px.empty());
+}
+
+// --- tiled_heatmap ---
+
+TEST(TiledHeatmap, LevelFollowsCellsPerPixel) {
+    std::vector<float> v(1024 * 1024, 0.0f); // declared first: must outlive the workers
+    tiled_heatmap      heat{null_texture_backend(), gray(), {.tile_px = 16, .workers = 1}};
+    heat.set_data(v, 1024, 1024, 0.0, 1.0, ImPlotPoint(0, 0), ImPlotPoint(1024, 1024));
+
+    EXPECT_EQ(heat.level_for({0, 1024, 0, 1024, 1024, 1024}), 0);
+    EXPECT_EQ(heat.level_for({0, 1024, 0, 1024, 256, 256}), 2);
+    EXPECT_EQ(heat.level_for({0, 1024, 0, 1024, 300, 300}), 1); // never coarser than a screen pixel
+    EXPECT_EQ(heat.level_for({0, 1024, 0, 1024, 1, 1}), 6);     // clamped to one tile for the grid
+}
+
+TEST(TiledHeatmap, UploadsOnceAndCoversView) {
+    const auto    v = checkerboard(32, 32);
+    tiled_heatmap heat{null_texture_backend(), gray(), {.tile_px = 8, .workers = 2}};
+    heat.set_data(v, 32, 32, 0.0, 1.0, ImPlotPoint(0, 0), ImPlotPoint(32, 32));
+    const heatmap_view view{0, 32, 0, 32, 32, 32};
+
+    EXPECT_TRUE(heat.prepare(view).empty()); // nothing rasterized yet
+    heat.wait_idle();
+    const auto draws = heat.prepare(view);
+    ASSERT_EQ(draws.size(), 16u);
+    EXPECT_EQ(heat.uploads(), 16);
+
+    double area = 0.0;
+    for (const tile_draw &d: draws) area += (d.bounds_max.x - d.bounds_min.x) * (d.bounds_max.y - d.bounds_min.y);
+    EXPECT_DOUBLE_EQ(area, 32.0 * 32.0);
+
+    heat.wait_idle();
+    EXPECT_EQ(heat.prepare(view).size(), 16u);
+    EXPECT_EQ(heat.uploads(), 16); // cached
+}
+
+TEST(TiledHeatmap, CoarserTileStandsInWhileZooming) {
+    const auto    v = checkerboard(32, 32);
+    tiled_heatmap heat{null_texture_backend(), gray(), {.tile_px = 8, .workers = 1}};
+    heat.set_data(v, 32, 32, 0.0, 1.0, ImPlotPoint(0, 0), ImPlotPoint(32, 32));
+
+    const heatmap_view overview{0, 32, 0, 32, 8, 8}; // level 2: one tile
+    (void)heat.prepare(overview);
+    heat.wait_idle();
+    ASSERT_EQ(heat.prepare(overview).size(), 1u);
+
+    const heatmap_view zoomed{0, 8, 24, 32, 8, 8}; // level 0, top-left tile
+    const auto         draws = heat.prepare(zoomed);
+    ASSERT_EQ(draws.size(), 1u);
+    EXPECT_DOUBLE_EQ(draws[0].bounds_max.x, 32.0); // the level-2 tile, not the fine one
+    heat.wait_idle();
+    const auto fine = heat.prepare(zoomed);
+    ASSERT_EQ(fine.size(), 1u);
+    EXPECT_DOUBLE_EQ(fine[0].bounds_max.x, 8.0);
+    EXPECT_DOUBLE_EQ(fine[0].bounds_min.y, 24.0);
+}
+
+TEST(TiledHeatmap, EvictsLeastRecentlyUsed) {
+    const auto    v         = checkerboard(4, 16);
+    int           destroyed = 0;
+    auto          backend   = null_texture_backend();
+    backend.destroy         = [&](ImTextureID) { destroyed++; };
+    tiled_heatmap heat{backend, gray(), {.tile_px = 4, .workers = 1, .max_tiles = 2}};
+    heat.set_data(v, 4, 16, 0.0, 1.0, ImPlotPoint(0, 0), ImPlotPoint(16, 4));
+
+    for (int tx = 0; tx < 4; tx++) {
+        const heatmap_view view{tx * 4.0, tx * 4.0 + 4.0, 0, 4, 4, 4};
+        (void)heat.prepare(view);
+        heat.wait_idle();
+        (void)heat.prepare(view);
+    }
+    EXPECT_LE(heat.cached_tiles(), 2u);
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST(TiledHeatmap, SetDataDropsTiles) {
+    const auto    v         = checkerboard(16, 16);
+    int           destroyed = 0;
+    auto          backend   = null_texture_backend();
+    backend.destroy         = [&](ImTextureID) { destroyed++; };
+    tiled_heatmap heat{backend, gray(), {.tile_px = 8, .workers = 2}};
+    heat.set_data(v, 16, 16, 0.0, 1.0, ImPlotPoint(0, 0), ImPlotPoint(16, 16));
+    const heatmap_view view{0, 16, 0, 16, 16, 16};
+    (void)heat.prepare(view);
+    heat.wait_idle();
+    ASSERT_EQ(heat.prepare(view).size(), 4u);
+
+    heat.set_data(v, 16, 16, 0.0, 2.0, ImPlotPoint(0, 0), ImPlotPoint(16, 16));
+    EXPECT_EQ(heat.cached_tiles(), 0u);
+    EXPECT_EQ(destroyed, 4);
+    EXPECT_TRUE(heat.prepare(view).empty());
+}
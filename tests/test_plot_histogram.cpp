@@ -0,0 +1,197 @@
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/histogram.hpp>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+// --- bin_axis (constexpr reference) ---
+
+static_assert(bin_axis{0.0, 100.0, 50}.index(42.0) == 21);
+static_assert(bin_axis{0.0, 100.0, 50}.index(0.0) == 0);
+static_assert(bin_axis{0.0, 100.0, 50}.index(100.0) == 49); // max lands in the last bin
+static_assert(bin_axis{0.0, 100.0, 50}.index(-0.001) == -1);
+static_assert(bin_axis{0.0, 100.0, 50}.index(100.001) == -1);
+static_assert(bin_axis{-1.0, 1.0, 4}.center(0) == -0.75);
+
+// --- bin_indices matches the reference ---
+
+namespace {
+
+    template<typename T>
+    std::vector<T> edge_samples(const bin_axis &axis) {
+        std::vector<T> v;
+        for (int i = 0; i <= axis.bins; i++) {
+            const double e = axis.edge(i);
+            v.push_back(static_cast<T>(e));
+            v.push_back(std::nextafter(static_cast<T>(e), std::numeric_limits<T>::lowest()));
+            v.push_back(std::nextafter(static_cast<T>(e), std::numeric_limits<T>::max()));
+        }
+        v.push_back(std::numeric_limits<T>::quiet_NaN());
+        v.push_back(std::numeric_limits<T>::infinity());
+        v.push_back(-std::numeric_limits<T>::infinity());
+        std::uint32_t state = 7;
+        for (int i = 0; i < 997; i++) {
+            state = state * 1664525u + 1013904223u;
+            v.push_back(static_cast<T>(axis.min - 1.0 + (axis.max - axis.min + 2.0) * (state >> 8) / 16777216.0));
+        }
+        return v;
+    }
+
+    template<typename T>
+    void expect_matches_reference(const bin_axis &axis) {
+        const std::vector<T>      in = edge_samples<T>(axis);
+        std::vector<std::int32_t> out(in.size());
+        bin_indices(std::span<const T>{in}, axis, out);
+        for (std::size_t i = 0; i < in.size(); i++)
+            ASSERT_EQ(out[i], axis.index(static_cast<double>(in[i]))) << "sample " << in[i];
+    }
+
+} // namespace
+
+TEST(BinIndices, FloatMatchesReference) {
+    expect_matches_reference<float>({0.0, 100.0, 50});
+    expect_matches_reference<float>({-3.3, 7.7, 13});
+}
+
+TEST(BinIndices, DoubleMatchesReference) {
+    expect_matches_reference<double>({0.0, 100.0, 50});
+    expect_matches_reference<double>({-3.3, 7.7, 13});
+}
+
+TEST(BinIndices, BackendNamed) {
+    EXPECT_FALSE(binning_backend().empty());
+}
+
+// --- histogram ---
+
+TEST(Histogram, AddCountsInRangeSamples) {
+    histogram                 h{{0.0, 10.0, 10}};
+    const std::vector<double> v = {0.5, 1.5, 1.6, 9.99, 10.0, -1.0, 11.0};
+    h.add(v);
+    EXPECT_EQ(h.counts()[0], 1.0);
+    EXPECT_EQ(h.counts()[1], 2.0);
+    EXPECT_EQ(h.counts()[9], 2.0);
+    EXPECT_EQ(std::accumulate(h.counts().begin(), h.counts().end(), 0.0), 5.0);
+}
+
+TEST(Histogram, PartialsMergeOnSync) {
+    histogram          h{{0.0, 1.0, 100}};
+    std::vector<float> v(10'000);
+    for (std::size_t i = 0; i < v.size(); i++) v[i] = (static_cast<float>(i % 100) + 0.5f) / 100.0f; // bin centers
+
+    std::vector<std::jthread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&] {
+            auto part = h.make_partial();
+            for (int rep = 0; rep < 5; rep++) {
+                part.add(v);
+                h.publish(part);
+            }
+        });
+    }
+    workers.clear(); // join
+    EXPECT_EQ(h.counts()[0], 0.0);
+    EXPECT_TRUE(h.sync());
+    EXPECT_FALSE(h.sync());
+    for (const double c: h.counts()) EXPECT_EQ(c, 4 * 5 * 100.0);
+}
+
+TEST(Histogram, ClearDropsUnsyncedPartials) {
+    histogram                h{{0.0, 1.0, 4}};
+    auto                     part = h.make_partial();
+    const std::vector<float> v    = {0.1f, 0.6f};
+    part.add(v);
+    h.publish(part);
+    h.clear();
+    EXPECT_FALSE(h.sync());
+    for (const double c: h.counts()) EXPECT_EQ(c, 0.0);
+}
+
+TEST(Histogram, GroupedBarsAreCachedAndSumFineBins) {
+    histogram          h{{0.0, 10.0, 10}};
+    std::vector<float> v;
+    for (int i = 0; i < 10; i++) v.insert(v.end(), static_cast<std::size_t>(i + 1), static_cast<float>(i) + 0.5f);
+    h.add(v);
+
+    const auto &b = h.grouped(3); // 3 + 1 bins, last one short
+    ASSERT_EQ(b.counts.size(), 4u);
+    EXPECT_EQ(b.counts[0], 1.0 + 2 + 3);
+    EXPECT_EQ(b.counts[3], 10.0);
+    EXPECT_DOUBLE_EQ(b.width, 3.0);
+    EXPECT_DOUBLE_EQ(b.centers[1], 4.5);
+    EXPECT_EQ(&h.grouped(3), &b);
+}
+
+TEST(Histogram, RebinFromFineWhenAligned) {
+    histogram          h{{0.0, 100.0, 100}};
+    std::vector<float> v(1000);
+    for (std::size_t i = 0; i < v.size(); i++) v[i] = static_cast<float>(i) * 0.1f;
+    h.add(v);
+
+    std::vector<double> out;
+    ASSERT_TRUE(h.rebin({20.0, 60.0, 8}, out)); // 5 fine bins each
+    ASSERT_EQ(out.size(), 8u);
+    for (const double c: out) EXPECT_EQ(c, 50.0);
+
+    EXPECT_FALSE(h.rebin({20.5, 60.5, 8}, out));  // edges between fine edges
+    EXPECT_FALSE(h.rebin({20.0, 60.0, 7}, out));  // width not a whole number of fine bins
+    EXPECT_FALSE(h.rebin({50.0, 150.0, 10}, out)); // beyond the fine range
+}
+
+// --- histogram_2d ---
+
+TEST(Histogram2d, RowZeroIsTop) {
+    histogram_2d              h{{0.0, 4.0, 4}, {0.0, 2.0, 2}};
+    const std::vector<double> xs = {0.5, 3.5, 3.5};
+    const std::vector<double> ys = {0.5, 1.5, 1.9};
+    h.add(xs, ys);
+    EXPECT_EQ(h.counts()[0 * 4 + 3], 2.0); // top row, right column
+    EXPECT_EQ(h.counts()[1 * 4 + 0], 1.0); // bottom row, left column
+}
+
+TEST(Histogram2d, GroupedKeepsTotalsAndOrientation) {
+    histogram_2d        h{{0.0, 5.0, 5}, {0.0, 3.0, 3}};
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (int x = 0; x < 5; x++)
+        for (int y = 0; y < 3; y++) {
+            xs.push_back(x + 0.5);
+            ys.push_back(y + 0.5);
+        }
+    h.add(xs, ys);
+
+    const auto &g = h.grouped(2, 2);
+    ASSERT_EQ(g.cols, 3);
+    ASSERT_EQ(g.rows, 2);
+    EXPECT_EQ(std::accumulate(g.values.begin(), g.values.end(), 0.0), 15.0);
+    EXPECT_EQ(g.values[1 * 3 + 0], 4.0); // bottom-left group: fine x 0..1, y 0..1
+    EXPECT_EQ(g.values[0 * 3 + 2], 1.0); // top-right group: fine x 4, y 2
+}
+
+TEST(Histogram2d, PartialsMergeOnSync) {
+    histogram_2d             h{{0.0, 1.0, 8}, {0.0, 1.0, 8}};
+    auto                     part = h.make_partial();
+    const std::vector<float> xs(64, 0.3f);
+    const std::vector<float> ys(64, 0.7f);
+    part.add(xs, ys);
+    h.publish(part);
+    EXPECT_TRUE(h.sync());
+    EXPECT_EQ(std::accumulate(h.counts().begin(), h.counts().end(), 0.0), 64.0);
+}
+
+TEST(Histogram2d, ClearDropsUnsyncedPartials) {
+    histogram_2d             h{{0.0, 1.0, 4}, {0.0, 1.0, 4}};
+    auto                     part = h.make_partial();
+    const std::vector<float> xs   = {0.1f, 0.6f};
+    const std::vector<float> ys   = {0.2f, 0.9f};
+    part.add(xs, ys);
+    h.publish(part);
+    h.clear();
+    EXPECT_FALSE(h.sync());
+    for (const double c: h.counts()) EXPECT_EQ(c, 0.0);
+}
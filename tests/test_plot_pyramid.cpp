@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/pyramid.hpp>
+#include <numeric>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+namespace {
+
+    std::vector<std::int32_t> make_samples(const std::size_t n) {
+        std::vector<std::int32_t> v(n);
+        std::uint32_t             state = 12345;
+        for (auto &x: v) {
+            state = state * 1664525u + 1013904223u;
+            x     = static_cast<std::int32_t>(state >> 16) - 32768;
+        }
+        return v;
+    }
+
+    // Every bucket of every level matches a brute-force scan of its samples.
+    void expect_matches_brute_force(const sample_pyramid<std::int32_t> &pyr, const std::vector<std::int32_t> &v) {
+        ASSERT_EQ(pyr.size(), v.size());
+        ASSERT_FALSE(pyr.levels().empty());
+        EXPECT_EQ(pyr.levels().back().min.size(), 1u);
+        for (std::size_t j = 0; j < pyr.levels().size(); ++j) {
+            const auto       &l = pyr.levels()[j];
+            const std::size_t b = pyr.bucket_size(j);
+            ASSERT_EQ(l.min.size(), (v.size() + b - 1) / b);
+            for (std::size_t k = 0; k < l.min.size(); ++k) {
+                const auto first = v.begin() + static_cast<std::ptrdiff_t>(k * b);
+                const auto last  = v.begin() + static_cast<std::ptrdiff_t>(std::min(v.size(), (k + 1) * b));
+                EXPECT_EQ(l.min[k], *std::min_element(first, last));
+                EXPECT_EQ(l.max[k], *std::max_element(first, last));
+                EXPECT_DOUBLE_EQ(l.sum[k], std::accumulate(first, last, 0.0));
+                EXPECT_EQ(l.max_first[k] != 0, std::max_element(first, last) < std::min_element(first, last));
+            }
+        }
+    }
+
+} // namespace
+
+TEST(SamplePyramid, BuildMatchesBruteForce) {
+    const auto                   v = make_samples(10'000);
+    sample_pyramid<std::int32_t> pyr{3};
+    pyr.append(v);
+    expect_matches_brute_force(pyr, v);
+}
+
+TEST(SamplePyramid, IncrementalAppendMatchesFullBuild) {
+    const auto                   v = make_samples(5'003);
+    sample_pyramid<std::int32_t> pyr{2};
+    for (std::size_t n = 1; n <= v.size(); n += 97) pyr.append(std::span{v}.first(n));
+    pyr.append(v);
+    expect_matches_brute_force(pyr, v);
+}
+
+TEST(SamplePyramid, ShrinkRebuilds) {
+    const auto                   v = make_samples(1'000);
+    sample_pyramid<std::int32_t> pyr{2};
+    pyr.append(v);
+    const std::vector<std::int32_t> shorter(v.begin(), v.begin() + 300);
+    pyr.append(shorter);
+    expect_matches_brute_force(pyr, shorter);
+}
+
+TEST(SamplePyramid, GenerationTracksRebuilds) {
+    const auto                   v = make_samples(1'000);
+    sample_pyramid<std::int32_t> pyr{2};
+    pyr.append(v);
+    const std::uint64_t built = pyr.generation();
+    pyr.append(v); // nothing new
+    EXPECT_EQ(pyr.generation(), built);
+
+    // Same length again after a shrink: the size alone would not tell the two apart
+    pyr.append(std::span{v}.first(300));
+    pyr.append(v);
+    EXPECT_NE(pyr.generation(), built);
+
+    sample_pyramid<std::int32_t> other{2};
+    other.append(v);
+    EXPECT_NE(other.generation(), pyr.generation());
+}
+
+TEST(SamplePyramid, BuildAsync) {
+    const auto v       = make_samples(100'000);
+    auto       pending = sample_pyramid<std::int32_t>::build_async(v, 4);
+    ASSERT_EQ(pending.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    expect_matches_brute_force(pending.get(), v);
+}
+
+TEST(SamplePyramid, LevelForPixelWidth) {
+    const auto                   v = make_samples(1 << 20);
+    sample_pyramid<std::int32_t> pyr{6};
+    pyr.append(v);
+    EXPECT_EQ(pyr.level_for(1000 * 10, 1000), -1);   // 10 samples per pixel: raw
+    EXPECT_EQ(pyr.level_for(1000 * 64, 1000), 1);    // 64 per pixel: 128-sample buckets
+    EXPECT_EQ(pyr.level_for(1 << 20, 1024), 5);      // 1024 per pixel: 2048-sample buckets
+    EXPECT_EQ(pyr.level_for(1 << 20, 1), 14);        // clamped to the top level
+    EXPECT_EQ(pyr.level_for(1 << 20, 0), -1);
+}
+
+TEST(SamplePyramid, DecimateIsBoundedByPixels) {
+    const auto                   v = make_samples(1 << 20);
+    sample_pyramid<std::int32_t> pyr;
+    pyr.append(v);
+    const uniform_series     s{v};
+    std::vector<ImPlotPoint> out;
+
+    pyr.decimate(s, {0, v.size()}, 0.0, static_cast<double>(v.size()), 800, pyramid_mode::envelope, out);
+    EXPECT_LE(out.size(), 2u * 800 + 2);
+    EXPECT_GE(out.size(), 800u);
+    const auto [lo, hi] = std::ranges::minmax(out, {}, &ImPlotPoint::y);
+    EXPECT_EQ(lo.y, *std::ranges::min_element(v));
+    EXPECT_EQ(hi.y, *std::ranges::max_element(v));
+
+    pyr.decimate(s, {0, v.size()}, 0.0, static_cast<double>(v.size()), 800, pyramid_mode::mean, out);
+    EXPECT_LE(out.size(), 800u + 1);
+    EXPECT_TRUE(std::ranges::is_sorted(out, {}, &ImPlotPoint::x));
+}
+
+TEST(SamplePyramid, EnvelopeKeepsSampleOrder) {
+    // A rising ramp then a falling one, one bucket each at level 0 and one bucket together at level 1
+    std::vector<std::int32_t> v(8);
+    std::iota(v.begin(), v.begin() + 4, 0);
+    for (int i = 0; i < 4; ++i) v[4 + static_cast<std::size_t>(i)] = 10 - i;
+    sample_pyramid<std::int32_t> pyr{2};
+    pyr.append(v);
+    ASSERT_EQ(pyr.levels().size(), 2u);
+    EXPECT_EQ(pyr.levels()[0].max_first[0], 0);
+    EXPECT_EQ(pyr.levels()[0].max_first[1], 1);
+    EXPECT_EQ(pyr.levels()[1].max_first[0], 0); // min at 0, max (10) at 4
+
+    const uniform_series     s{v};
+    std::vector<ImPlotPoint> out;
+    pyr.decimate(s, {0, v.size()}, 0.0, 8.0, 4, pyramid_mode::envelope, out); // 2 per pixel: level 0
+    ASSERT_EQ(out.size(), 4u);
+    EXPECT_EQ(out[0].y, 0.0);
+    EXPECT_EQ(out[1].y, 3.0);
+    EXPECT_EQ(out[2].y, 10.0); // falling bucket: max first
+    EXPECT_EQ(out[3].y, 7.0);
+}
+
+TEST(SamplePyramid, NarrowViewFallsBackToRaw) {
+    const auto                   v = make_samples(1 << 16);
+    sample_pyramid<std::int32_t> pyr;
+    pyr.append(v);
+    const uniform_series     s{v};
+    std::vector<ImPlotPoint> out;
+    pyr.decimate(s, visible_range(s, 100.0, 199.0), 100.0, 199.0, 400, pyramid_mode::envelope, out);
+    ASSERT_EQ(out.size(), 102u); // 100 samples + one padding sample each side, copied
+    EXPECT_EQ(out[1].y, v[100]);
+}
@@ -0,0 +1,102 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <imgui_util/plot/decimate.hpp>
+#include <imgui_util/plot/streaming.hpp>
+#include <thread>
+#include <vector>
+
+using namespace imgui_util::implot;
+
+static_assert(plot_series<streaming_series<float>::view>);
+static_assert(std::is_invocable_r_v<ImPlotPoint, streaming_series<double>::view, int>);
+
+TEST(StreamingSeries, EmptySnapshot) {
+    const streaming_series<float> s{16};
+    const auto                    snap = s.snapshot();
+    EXPECT_TRUE(snap.empty());
+    EXPECT_EQ(snap.version(), 0u);
+}
+
+TEST(StreamingSeries, RingSizeIsPowerOfTwoWithGuard) {
+    const streaming_series<float> s{100, 10};
+    EXPECT_EQ(s.capacity(), 100u);
+    EXPECT_EQ(s.capacity() + s.guard(), 128u);
+}
+
+TEST(StreamingSeries, PartialFillIsOneSpan) {
+    streaming_series<int> s{8};
+    for (int i = 0; i < 5; i++) s.push(i, i * 10);
+    const auto snap = s.snapshot();
+    ASSERT_EQ(snap.size(), 5u);
+    EXPECT_TRUE(snap.second.empty());
+    EXPECT_EQ(snap[4].y, 40);
+}
+
+TEST(StreamingSeries, WrapSplitsIntoTwoSpansOldestFirst) {
+    streaming_series<int> s{6, 2}; // ring of 8
+    for (int i = 0; i < 11; i++) s.push(i, -i);
+    const auto snap = s.snapshot();
+    ASSERT_EQ(snap.size(), 6u);
+    EXPECT_FALSE(snap.second.empty());
+    for (std::size_t i = 0; i < snap.size(); i++) EXPECT_EQ(snap[i].x, static_cast<int>(5 + i));
+    EXPECT_EQ(snap(5).y, -10.0);
+}
+
+TEST(StreamingSeries, BlockPush) {
+    streaming_series<double>                           s{4, 4};
+    const std::vector<streaming_series<double>::sample> block = {{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}};
+    s.push(block);
+    const auto snap = s.snapshot();
+    ASSERT_EQ(snap.size(), 4u);
+    EXPECT_EQ(snap[0].x, 3.0);
+    EXPECT_EQ(snap.version(), 5u);
+}
+
+TEST(StreamingSeries, IntactUntilProducerExceedsGuard) {
+    streaming_series<int> s{4, 4};
+    for (int i = 0; i < 4; i++) s.push(i, i);
+    const auto snap = s.snapshot();
+    for (int i = 0; i < 3; i++) s.push(i, i);
+    EXPECT_TRUE(s.intact(snap));
+    s.push(0, 0); // the guard()-th push may be mid-write over the oldest snapshot slot
+    EXPECT_FALSE(s.intact(snap));
+}
+
+TEST(StreamingSeries, FeedsDecimationAndGetter) {
+    streaming_series<double> s{10'000};
+    for (int i = 0; i < 25'000; i++) s.push(i, i % 100);
+    const auto snap = s.snapshot();
+
+    EXPECT_EQ(visible_range(snap, 20'000.0, 21'000.0), (index_range{4'999, 6'002}));
+    std::vector<ImPlotPoint> out;
+    decimate(snap, {0, snap.size()}, snap.x(0), snap.x(snap.size() - 1), 100, decimation::minmax, out);
+    EXPECT_LE(out.size(), 202u);
+
+    getter g{snap};
+    EXPECT_EQ(decltype(g)::callback(0, g.data()).x, 15'000.0);
+}
+
+TEST(StreamingSeries, ConcurrentProducerSnapshotsStayOrdered) {
+    streaming_series<std::int64_t> s{1024, 1 << 16};
+    std::atomic<bool>              done{false};
+    std::jthread                   producer([&] {
+        for (std::int64_t i = 0; i < 200'000; i++) s.push(i, 2 * i);
+        done = true;
+    });
+
+    std::vector<streaming_series<std::int64_t>::sample> rows;
+    int                                                 checked = 0;
+    do {
+        const auto snap = s.snapshot();
+        snap.copy_to(rows);
+        if (!s.intact(snap)) continue; // only a copy taken while intact is guaranteed untorn
+        for (std::size_t i = 0; i < rows.size(); i++) {
+            EXPECT_EQ(rows[i].y, 2 * rows[i].x);
+            if (i > 0) {
+                EXPECT_EQ(rows[i].x, rows[i - 1].x + 1);
+            }
+        }
+        checked++;
+    } while (!done);
+    EXPECT_GT(checked, 0);
+}
@@ -0,0 +1,148 @@
+#include <deque>
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/reorder_list.hpp>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "support/headless.hpp"
+
+using namespace imgui_util;
+
+namespace {
+
+    std::vector<int> iota(const int n) {
+        std::vector<int> v(static_cast<std::size_t>(n));
+        std::iota(v.begin(), v.end(), 0);
+        return v;
+    }
+
+    // Reference: erase the moved rows, then insert them at destination().
+    std::vector<int> reference(const int n, const reorder_move &m) {
+        std::vector<int> rest;
+        for (int i = 0; i < n; ++i)
+            if (!std::ranges::binary_search(m.from, i)) rest.push_back(i);
+        rest.insert(rest.begin() + m.destination(), m.from.begin(), m.from.end());
+        return rest;
+    }
+
+    // Counts move constructions and assignments.
+    struct counted {
+        int               v     = 0;
+        static inline int moves = 0;
+        counted(const int x) : v(x) {} // NOLINT(google-explicit-constructor)
+        counted(counted &&o) noexcept : v(o.v) { ++moves; }
+        counted &operator=(counted &&o) noexcept {
+            v = o.v;
+            ++moves;
+            return *this;
+        }
+    };
+
+} // namespace
+
+// --- reorder_move ---
+
+TEST(ReorderMove, DestinationAndNoop) {
+    EXPECT_EQ((reorder_move{{2}, 5}.destination()), 4);
+    EXPECT_EQ((reorder_move{{6}, 1}.destination()), 1);
+    EXPECT_TRUE((reorder_move{{3}, 3}.is_noop()));
+    EXPECT_TRUE((reorder_move{{3}, 4}.is_noop()));
+    EXPECT_TRUE((reorder_move{{2, 3, 4}, 5}.is_noop()));
+    EXPECT_FALSE((reorder_move{{2, 4}, 5}.is_noop())); // gathers 2 and 4 together
+    EXPECT_TRUE(reorder_move{}.is_noop());
+}
+
+TEST(ReorderMove, PermutationMatchesReference) {
+    const reorder_move moves[] = {{{0}, 10}, {{9}, 0}, {{2, 3}, 7}, {{1, 5, 8}, 4}, {{0, 9}, 5}, {{4, 6}, 10}};
+    for (const reorder_move &m: moves) EXPECT_EQ(m.permutation(10), reference(10, m));
+}
+
+// --- apply_move ---
+
+TEST(ApplyMove, MatchesPermutation) {
+    const reorder_move moves[] = {{{0}, 10}, {{9}, 0}, {{2, 3}, 7}, {{1, 5, 8}, 4}, {{0, 9}, 5}, {{4, 6}, 10}};
+    for (const reorder_move &m: moves) {
+        auto v = iota(10);
+        EXPECT_TRUE(apply_move(v, m));
+        EXPECT_EQ(v, m.permutation(10));
+    }
+}
+
+TEST(ApplyMove, RejectsNoopAndInvalid) {
+    auto v = iota(5);
+    EXPECT_FALSE(apply_move(v, {{1}, 2}));
+    EXPECT_FALSE(apply_move(v, {{7}, 0}));
+    EXPECT_FALSE(apply_move(v, {{1}, 6}));
+    EXPECT_FALSE(apply_move(v, {{3, 1}, 0})); // unsorted
+    EXPECT_FALSE(apply_move(v, {{1, 1}, 4})); // duplicate
+    EXPECT_EQ(v, iota(5));
+}
+
+TEST(ApplyMove, MoveOnlyElementsAndOtherContainers) {
+    std::vector<std::unique_ptr<std::string>> items;
+    for (const char *s: {"a", "b", "c", "d"}) items.push_back(std::make_unique<std::string>(s));
+    ASSERT_TRUE(apply_move(items, {{0, 2}, 4}));
+    std::string order;
+    for (const auto &p: items) order += *p;
+    EXPECT_EQ(order, "bdac");
+
+    std::deque<int> d = {0, 1, 2, 3};
+    ASSERT_TRUE(apply_move(d, {{3}, 0}));
+    EXPECT_EQ(d, (std::deque<int>{3, 0, 1, 2}));
+}
+
+TEST(ApplyMove, OnlyTouchesAffectedSpan) {
+    std::vector<counted> v;
+    for (int i = 0; i < 50'000; ++i) v.emplace_back(i);
+    counted::moves = 0;
+    ASSERT_TRUE(apply_move(v, {{100}, 104}));
+    EXPECT_LE(counted::moves, 8); // 1 out, 3 shifted, 1 back in (+ buffer growth)
+    EXPECT_EQ(v[103].v, 100);
+    EXPECT_EQ(v[100].v, 101);
+}
+
+// --- reorder_list_view (headless) ---
+
+TEST(ReorderListView, DragDropsRowBelowTarget) {
+    constexpr float               row_h = 20.0f;
+    imgui_util::testing::headless h;
+    reorder_list_view             view{{.item_height = row_h}};
+    std::vector<int>              items = iota(5);
+    std::optional<reorder_move>   dropped;
+
+    const auto draw = [&](const int i) { ImGui::Text("%d", items[static_cast<std::size_t>(i)]); };
+    const auto step = [&] {
+        (void)h.widget("list", [&] {
+            if (auto mv = view.render("##rows", static_cast<int>(items.size()), draw)) dropped = std::move(mv);
+        }, 1);
+    };
+    // The widget window puts row 0 at the window padding; aim at row centres.
+    const ImVec2 pad = ImGui::GetStyle().WindowPadding;
+    const auto   row = [&](const int i, const float frac) {
+        return ImVec2{pad.x + 40.0f, pad.y + (static_cast<float>(i) + frac) * row_h};
+    };
+
+    step();
+    h.move_mouse(row(0, 0.5f));
+    step();
+    h.mouse_down();
+    step();
+    h.move_mouse(row(1, 0.5f)); // past the drag threshold: the drag starts
+    step();
+    h.move_mouse(row(3, 0.75f)); // lower half of row 3: insert after it
+    step();
+    step();
+    ASSERT_FALSE(dropped.has_value());
+    h.mouse_up();
+    step();
+
+    ASSERT_TRUE(dropped.has_value());
+    EXPECT_EQ(dropped->from, std::vector<int>{0});
+    EXPECT_EQ(dropped->to, 4);
+    ASSERT_TRUE(apply_move(items, *dropped));
+    EXPECT_EQ(items, (std::vector<int>{1, 2, 3, 0, 4}));
+    EXPECT_EQ(std::vector<int>(view.selection().begin(), view.selection().end()), std::vector<int>{3});
+}
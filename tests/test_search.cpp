@@ -117,6 +117,29 @@ TEST(MatchesAny, ManyFields) {
         matches_any("e", std::string_view{"a"}, std::string_view{"b"}, std::string_view{"c"}, std::string_view{"d"}));
 }
 
+// --- fuzzy_match / char_mask ---
+
+TEST(FuzzyMatch, SubsequenceIgnoringCase) {
+    int score = 0;
+    EXPECT_TRUE(fuzzy_match("opf", "Open File", score));
+    EXPECT_GT(score, 0);
+    EXPECT_FALSE(fuzzy_match("xyz", "Open File", score));
+}
+
+TEST(FuzzyMatch, PrefersConsecutiveEarlyMatches) {
+    int tight = 0;
+    int loose = 0;
+    ASSERT_TRUE(fuzzy_match("ope", "Open", tight));
+    ASSERT_TRUE(fuzzy_match("ope", "a_o_p_e", loose));
+    EXPECT_GT(tight, loose);
+}
+
+TEST(CharMask, RejectsOnlyImpossibleMatches) {
+    EXPECT_EQ(char_mask("Abc"), char_mask("cab"));
+    EXPECT_EQ(char_mask("lmp") & ~char_mask("lamp"), 0u);
+    EXPECT_NE(char_mask("lmz") & ~char_mask("lamp"), 0u);
+}
+
 // --- search_bar default state ---
 
 TEST(SearchBar, DefaultStateIsEmpty) {
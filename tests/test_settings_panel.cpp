@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/settings_panel.hpp>
+#include <string>
+#include <vector>
+
+using imgui_util::settings_panel;
+
+namespace {
+    std::vector<std::string> child_names(const settings_panel &p, const std::string_view parent) {
+        std::vector<std::string> out;
+        for (const int i: p.children(parent)) out.emplace_back(p.name(i));
+        return out;
+    }
+} // namespace
+
+TEST(SettingsPanel, LinksTreeOnRegistration) {
+    settings_panel p;
+    (void)p.section("General", [] {}).section("Appearance", [] {}).section("Fonts", "Appearance", [] {});
+    (void)p.section("Colors", "Appearance", [] {});
+    EXPECT_EQ(child_names(p, ""), (std::vector<std::string>{"General", "Appearance"}));
+    EXPECT_EQ(child_names(p, "Appearance"), (std::vector<std::string>{"Fonts", "Colors"}));
+    EXPECT_TRUE(p.children("Fonts").empty());
+    EXPECT_TRUE(p.children("Missing").empty());
+}
+
+TEST(SettingsPanel, AdoptsChildrenRegisteredBeforeParent) {
+    settings_panel p;
+    (void)p.section("Fonts", "Appearance", [] {}).section("Colors", "Appearance", [] {});
+    EXPECT_TRUE(p.children("").empty());
+    (void)p.section("Appearance", [] {});
+    EXPECT_EQ(child_names(p, ""), (std::vector<std::string>{"Appearance"}));
+    EXPECT_EQ(child_names(p, "Appearance"), (std::vector<std::string>{"Fonts", "Colors"}));
+}
+
+TEST(SettingsPanel, ReRegistrationReplacesInsteadOfDuplicating) {
+    settings_panel p;
+    int            calls = 0;
+    for (int frame = 0; frame < 3; ++frame) {
+        (void)p.section("General", [&] { ++calls; }).setting("VSync").section("Keys", "General", [] {});
+    }
+    EXPECT_EQ(p.size(), 2u);
+    EXPECT_EQ(p.search("vsync").size(), 1u);
+
+    (void)p.section("Keys", [] {}); // move to top level
+    EXPECT_EQ(child_names(p, ""), (std::vector<std::string>{"General", "Keys"}));
+    EXPECT_TRUE(p.children("General").empty());
+}
+
+TEST(SettingsPanel, SearchCoversSectionsAndSettings) {
+    settings_panel p;
+    (void)p.section("Appearance", [] {}).setting("Accent color").setting("Font size");
+    (void)p.section("Editor", [] {}).setting("Tab size");
+
+    const auto hits = p.search("size");
+    ASSERT_EQ(hits.size(), 2u);
+    for (const auto &h: hits) EXPECT_TRUE(h.is_setting);
+    EXPECT_GE(hits[0].score, hits[1].score);
+
+    const auto acc = p.search("acc");
+    ASSERT_EQ(acc.size(), 1u);
+    EXPECT_EQ(acc[0].text, "Accent color");
+    EXPECT_EQ(acc[0].section, "Appearance");
+
+    const auto sec = p.search("EDIT");
+    ASSERT_EQ(sec.size(), 1u);
+    EXPECT_FALSE(sec[0].is_setting);
+    EXPECT_EQ(sec[0].section, "Editor");
+
+    EXPECT_TRUE(p.search("zzz").empty());
+    EXPECT_TRUE(p.search("").empty());
+}
+
+TEST(SettingsPanel, SearchSeesLaterRegistrations) {
+    settings_panel p;
+    (void)p.section("General", [] {});
+    EXPECT_TRUE(p.search("theme").empty());
+    (void)p.setting("Theme");
+    ASSERT_EQ(p.search("theme").size(), 1u);
+    EXPECT_EQ(p.search("theme")[0].section, "General");
+}
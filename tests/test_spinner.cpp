@@ -0,0 +1,47 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/spinner.hpp>
+
+using imgui_util::detail::spinner_mesh;
+
+namespace {
+    float dist(const ImVec2 v) { return std::sqrt(v.x * v.x + v.y * v.y); }
+} // namespace
+
+TEST(SpinnerMesh, AntiAliasedLayoutMatchesPathStroke) {
+    const auto m = spinner_mesh::build(8.0f, 2.0f, 24, true, 1.0f);
+    EXPECT_EQ(m.vtx_count(), 25 * 4);
+    EXPECT_EQ(m.idx_count(), 24 * 18);
+    for (const ImDrawIdx i: m.indices) EXPECT_LT(i, m.vtx_count());
+
+    // First point: fringe, edge, edge, fringe at +1.5, +0.5, -0.5, -1.5 along the end segment's
+    // normal, which is half a step off radial (law of cosines for the distance to the center)
+    const float c = std::cos(imgui_util::detail::spinner_sweep / 48.0f);
+    EXPECT_NEAR(dist(m.offsets[0]), std::sqrt(8.0f * 8.0f + 1.5f * 1.5f + 2.0f * 8.0f * 1.5f * c), 1e-3f);
+    EXPECT_NEAR(dist(m.offsets[3]), std::sqrt(8.0f * 8.0f + 1.5f * 1.5f - 2.0f * 8.0f * 1.5f * c), 1e-3f);
+    EXPECT_FALSE(m.opaque(0));
+    EXPECT_TRUE(m.opaque(1));
+    EXPECT_TRUE(m.opaque(2));
+    EXPECT_FALSE(m.opaque(3));
+}
+
+TEST(SpinnerMesh, JointsAreMiteredOnTheArc) {
+    const auto  m    = spinner_mesh::build(10.0f, 4.0f, 12, false, 1.0f);
+    const float step = imgui_util::detail::spinner_sweep / 12.0f;
+    EXPECT_EQ(m.vtx_count(), 13 * 2);
+    EXPECT_EQ(m.idx_count(), 12 * 6);
+    for (int i = 1; i < 12; ++i) {
+        // Interior joint: radial, offset by half the thickness over cos(step / 2)
+        const float off = 2.0f / std::cos(step * 0.5f);
+        EXPECT_NEAR(dist(m.offsets[static_cast<std::size_t>(i * 2)]), 10.0f + off, 1e-4f);
+        EXPECT_NEAR(dist(m.offsets[static_cast<std::size_t>(i * 2 + 1)]), 10.0f - off, 1e-4f);
+        EXPECT_TRUE(m.opaque(static_cast<std::size_t>(i * 2)));
+    }
+}
+
+TEST(SpinnerMesh, CacheKey) {
+    const auto m = spinner_mesh::build(8.0f, 2.0f, 24, true, 1.0f);
+    EXPECT_TRUE(m.matches(8.0f, 2.0f, 24, true, 1.0f));
+    EXPECT_FALSE(m.matches(8.0f, 2.0f, 24, false, 1.0f));
+    EXPECT_FALSE(m.matches(9.0f, 2.0f, 24, true, 1.0f));
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/tag_input.hpp>
+#include <string>
+#include <vector>
+
+#include "support/headless.hpp"
+
+using imgui_util::testing::headless;
+
+namespace {
+
+    // Focus the add-tag input of @p label, type @p text and press Enter.
+    void enter_tag(headless &h, const char *label, std::vector<std::string> &tags, const char *text) {
+        bool       focus = true;
+        const auto step  = [&] {
+            (void)h.widget("tags", [&] {
+                if (focus) ImGui::SetKeyboardFocusHere();
+                (void)imgui_util::tag_input(label, tags);
+            }, 1);
+            focus = false;
+        };
+        step();
+        step();
+        h.type(text);
+        step();
+        h.press_key(ImGuiKey_Enter);
+        for (int i = 0; i < 3; ++i) step();
+    }
+
+} // namespace
+
+TEST(TagInput, EnterAddsTypedTag) {
+    headless                 h;
+    std::vector<std::string> tags;
+    enter_tag(h, "Tags", tags, "cpp");
+    EXPECT_EQ(tags, std::vector<std::string>{"cpp"});
+}
+
+TEST(TagInput, StateIsPerWidgetAndPerContext) {
+    std::vector<std::string> first;
+    std::vector<std::string> second;
+    {
+        headless h;
+        enter_tag(h, "First", first, "alpha");
+        enter_tag(h, "Second", second, "beta");
+    } // the context's Shutdown hook frees both input states
+    headless                 h;
+    std::vector<std::string> third;
+    enter_tag(h, "First", third, "gamma"); // same ID in a new context starts from an empty buffer
+    EXPECT_EQ(first, std::vector<std::string>{"alpha"});
+    EXPECT_EQ(second, std::vector<std::string>{"beta"});
+    EXPECT_EQ(third, std::vector<std::string>{"gamma"});
+}
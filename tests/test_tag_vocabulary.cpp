@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <imgui_util/widgets/tag_vocabulary.hpp>
+#include <string>
+#include <vector>
+
+using namespace imgui_util;
+
+namespace {
+
+    std::vector<std::string> texts(const std::vector<tag_suggestion> &s) {
+        std::vector<std::string> out;
+        for (const auto &x: s) out.emplace_back(x.text);
+        return out;
+    }
+
+    // Prefix matches ranked by (frequency desc, sorted index asc), computed by a full scan
+    std::vector<std::uint32_t> brute_top(const tag_vocabulary &v, const std::string_view prefix, const std::size_t k) {
+        std::vector<std::uint32_t> idx;
+        for (std::uint32_t i = 0; i < v.size(); ++i) {
+            const auto t = v.term(i);
+            if (t.size() >= prefix.size() && search::contains_ignore_case(t.substr(0, prefix.size()), prefix))
+                idx.push_back(i);
+        }
+        std::ranges::stable_sort(idx, [&](const auto a, const auto b) { return v.frequency(a) > v.frequency(b); });
+        if (idx.size() > k) idx.resize(k);
+        return idx;
+    }
+
+} // namespace
+
+TEST(TagVocabulary, SortsAndMergesCaseDuplicates) {
+    const std::vector<tag_frequency> terms = {{"beta", 1}, {"Alpha", 2}, {"alpha", 3}, {"", 9}, {"gamma", 1}};
+    const tag_vocabulary             v{terms};
+    ASSERT_EQ(v.size(), 3u);
+    EXPECT_EQ(v.term(0), "Alpha"); // first spelling kept
+    EXPECT_EQ(v.frequency(0), 5u);
+    EXPECT_EQ(v.term(1), "beta");
+    EXPECT_EQ(v.term(2), "gamma");
+    EXPECT_EQ(v.term(2).data()[v.term(2).size()], '\0');
+}
+
+TEST(TagVocabulary, PrefixRangeIsCaseInsensitive) {
+    const std::vector<tag_frequency> terms = {{"cat"}, {"Car"}, {"cart"}, {"dog"}, {"ca"}};
+    const tag_vocabulary             v{terms};
+    const auto [first, last]         = v.prefix_range("CA");
+    EXPECT_EQ(last - first, 4u);
+    const auto [f2, l2] = v.prefix_range("cat");
+    EXPECT_EQ(l2 - f2, 1u);
+    const auto [f3, l3] = v.prefix_range("x");
+    EXPECT_EQ(f3, l3);
+}
+
+TEST(TagVocabulary, PrefixSuggestionsRankByFrequency) {
+    const std::vector<tag_frequency> terms = {
+        {"anim", 5}, {"animal", 50}, {"animation", 20}, {"anime", 20}, {"bee", 99}};
+    const tag_vocabulary             v{terms};
+    std::vector<tag_suggestion>      out;
+    v.suggest("ani", 3, out, false);
+    EXPECT_EQ(texts(out), (std::vector<std::string>{"animal", "animation", "anime"}));
+    v.suggest("", 2, out);
+    EXPECT_EQ(texts(out), (std::vector<std::string>{"bee", "animal"}));
+}
+
+TEST(TagVocabulary, TopKMatchesBruteForce) {
+    std::vector<std::string> words;
+    std::uint32_t            state = 7;
+    auto                     next  = [&] { return state = state * 1664525u + 1013904223u; };
+    for (int i = 0; i < 5000; ++i) {
+        std::string w(3 + next() % 6, 'a');
+        for (char &c: w) c = static_cast<char>('a' + (next() >> 16) % 4);
+        words.push_back(std::move(w));
+    }
+    std::vector<tag_frequency> terms;
+    for (const auto &w: words) terms.push_back({w, (next() >> 20) % 50});
+    const tag_vocabulary v{terms};
+
+    std::vector<tag_suggestion> out;
+    for (const std::string_view prefix: {"", "a", "ab", "dca", "bbb", "cadd", "abcdab"}) {
+        for (const std::size_t k: {1u, 5u, 40u}) {
+            v.suggest(prefix, k, out, false);
+            std::vector<std::uint32_t> got;
+            for (const auto &s: out) got.push_back(s.index);
+            EXPECT_EQ(got, brute_top(v, prefix, k)) << prefix << " k=" << k;
+        }
+    }
+}
+
+TEST(TagVocabulary, FuzzyFallbackFollowsPrefixMatches) {
+    const std::vector<tag_frequency> terms = {{"landscape", 3}, {"land", 1}, {"island", 9}, {"lamp", 4}};
+    const tag_vocabulary             v{terms};
+    std::vector<tag_suggestion>      out;
+    v.suggest("land", 4, out);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(texts(out), (std::vector<std::string>{"landscape", "land", "island"}));
+    EXPECT_FALSE(out[1].fuzzy);
+    EXPECT_TRUE(out[2].fuzzy);
+
+    v.suggest("lmp", 4, out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].text, "lamp");
+}
@@ -3,6 +3,9 @@
 #include <imgui_util/theme/color_math.hpp>
 #include <imgui_util/widgets/text.hpp>
 
+#include "support/headless.hpp"
+#include "support/test_font.hpp"
+
 using namespace imgui_util;
 
 // --- color::offset (formerly brighten) ---
@@ -118,3 +121,75 @@ TEST(TruncatedText, TruncatedFromOwnedString) {
     EXPECT_EQ(t.view(), "hell...");
     EXPECT_TRUE(t.was_truncated());
 }
+
+TEST(TruncatedText, NonOwningFormKeepsPrefixAndReportsEllipsis) {
+    const truncated_text t{std::string_view{"hello world"}, 4};
+    EXPECT_TRUE(t.was_truncated());
+    EXPECT_EQ(t.view(), "hell");
+    EXPECT_EQ(t.suffix(), "...");
+    EXPECT_EQ(t.kept(), 4u);
+    EXPECT_EQ(t.str(), "hell...");
+
+    const truncated_text whole{std::string_view{"hi"}, 2};
+    EXPECT_FALSE(whole.was_truncated());
+    EXPECT_TRUE(whole.suffix().empty());
+    EXPECT_EQ(truncated_text{std::string{"hell..."}}.kept(), 4u);
+}
+
+// --- truncate_length (hand-built font, no ImGui context needed) ---
+
+using imgui_util::testing::test_font;
+
+TEST(TruncateLength, WholeTextFits) {
+    const glyph_advances adv{test_font(), 10.0f};
+    EXPECT_EQ(truncate_length(adv, "hello", 50.0f), 5u);
+    EXPECT_EQ(truncate_length(adv, "", 0.0f), 0u);
+}
+
+TEST(TruncateLength, KeepsLongestPrefixThatFitsWithEllipsis) {
+    const glyph_advances adv{test_font(), 10.0f};
+    EXPECT_EQ(truncate_length(adv, "hello world", 50.0f), 4u); // 40 px + 6 px "..."
+    EXPECT_EQ(truncate_length(adv, "hello world", 5.0f), 0u);  // not even the ellipsis fits
+}
+
+TEST(TruncateLength, ScalesWithFontSize) {
+    const glyph_advances adv{test_font(), 20.0f};
+    EXPECT_FLOAT_EQ(adv('a'), 20.0f);
+    EXPECT_EQ(truncate_length(adv, "hello", 100.0f), 5u);
+    EXPECT_EQ(truncate_length(adv, "hello", 99.0f), 4u);
+}
+
+TEST(TruncateLength, RoundsWidthsUpLikeCalcTextSize) {
+    const glyph_advances adv{test_font(), 10.0f};
+    EXPECT_EQ(truncate_length(adv, "iii", 10.0f), 3u); // 9.9 px rounds to 10
+    EXPECT_EQ(truncate_length(adv, "iiii", 13.0f), 2u); // 13.2 -> 14 overflows; 6.6 -> 7, + 6 fits
+}
+
+TEST(TruncateLength, CutsOnlyAtUtf8Boundaries) {
+    const glyph_advances adv{test_font(), 10.0f};
+    const std::string    text = "\xC3\xA9\xC3\xA9\xC3\xA9"; // three U+00E9, 5 px fallback each
+    EXPECT_EQ(truncate_length(adv, text, 15.0f), text.size());
+    EXPECT_EQ(truncate_length(adv, text, 14.0f), 2u);
+}
+
+TEST(TruncateLength, MeasuresWidestLine) {
+    const glyph_advances adv{test_font(), 10.0f};
+    EXPECT_EQ(truncate_length(adv, "ab\ncdef", 40.0f), 7u);
+    EXPECT_EQ(truncate_length(adv, "ab\ncdef", 39.0f), 6u); // "ab\ncde" plus "..."
+}
+
+TEST(GlyphAdvances, CurrentTablesArePerContext) {
+    imgui_util::testing::headless a;
+    imgui_util::testing::headless b;
+    const glyph_advances         *in_a = nullptr;
+    (void)a.frame([&] { in_a = &glyph_advances::current(); });
+
+    // More font sizes than one context keeps tables for: must not evict the other context's
+    (void)b.frame([&] {
+        for (int i = 1; i <= 5; ++i) {
+            ImGui::SetWindowFontScale(static_cast<float>(i));
+            (void)glyph_advances::current();
+        }
+    });
+    (void)a.frame([&] { EXPECT_EQ(&glyph_advances::current(), in_a); });
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <imgui_util/core/text_metrics.hpp>
+
+#include "support/headless.hpp"
+#include "support/test_font.hpp"
+
+using namespace imgui_util;
+using imgui_util::testing::test_font;
+
+TEST(TextMetricsCache, MeasuresOnceThenHits) {
+    text_metrics_cache cache;
+    const ImVec2       a = cache.measure(&test_font(), 10.0f, "label");
+    const ImVec2       b = cache.measure(&test_font(), 10.0f, "label");
+    EXPECT_FLOAT_EQ(a.x, 50.0f);
+    EXPECT_FLOAT_EQ(a.y, 10.0f);
+    EXPECT_FLOAT_EQ(b.x, a.x);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(TextMetricsCache, RoundsWidthLikeCalcTextSize) {
+    text_metrics_cache cache;
+    EXPECT_FLOAT_EQ(cache.measure(&test_font(), 10.0f, "ai").x, 14.0f); // 13.3 rounds up
+}
+
+TEST(TextMetricsCache, KeyIncludesSizeAndText) {
+    text_metrics_cache cache;
+    EXPECT_FLOAT_EQ(cache.measure(&test_font(), 10.0f, "ab").x, 20.0f);
+    EXPECT_FLOAT_EQ(cache.measure(&test_font(), 20.0f, "ab").x, 40.0f);
+    EXPECT_FLOAT_EQ(cache.measure(&test_font(), 10.0f, "abc").x, 30.0f);
+    EXPECT_EQ(cache.misses(), 3u);
+    EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST(TextMetricsCache, EvictsLeastRecentlyUsed) {
+    text_metrics_cache cache{2};
+    (void)cache.measure(&test_font(), 10.0f, "a");
+    (void)cache.measure(&test_font(), 10.0f, "b");
+    (void)cache.measure(&test_font(), 10.0f, "a"); // b is now least recently used
+    (void)cache.measure(&test_font(), 10.0f, "c");
+    EXPECT_EQ(cache.size(), 2u);
+
+    const auto misses = cache.misses();
+    (void)cache.measure(&test_font(), 10.0f, "a");
+    (void)cache.measure(&test_font(), 10.0f, "c");
+    EXPECT_EQ(cache.misses(), misses);
+    (void)cache.measure(&test_font(), 10.0f, "b");
+    EXPECT_EQ(cache.misses(), misses + 1);
+}
+
+TEST(TextMetricsCache, ShrinkingCapacityDropsOldest) {
+    text_metrics_cache cache{8};
+    for (const char *s: {"a", "b", "c", "d"}) (void)cache.measure(&test_font(), 10.0f, s);
+    cache.set_capacity(2);
+    EXPECT_EQ(cache.size(), 2u);
+    const auto misses = cache.misses();
+    (void)cache.measure(&test_font(), 10.0f, "d");
+    (void)cache.measure(&test_font(), 10.0f, "c");
+    EXPECT_EQ(cache.misses(), misses);
+}
+
+TEST(TextMetricsCache, SyncClearsWhenAtlasChanges) {
+    text_metrics_cache cache;
+    ImFontAtlas        atlas;
+    EXPECT_TRUE(cache.sync(atlas)); // first sight of the atlas
+    (void)cache.measure(&test_font(), 10.0f, "x");
+    EXPECT_FALSE(cache.sync(atlas));
+    EXPECT_EQ(cache.size(), 1u);
+
+    atlas.TexWidth = 512; // rebuilt
+    EXPECT_TRUE(cache.sync(atlas));
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(TextMetricsCache, SharedInstanceKeepsEntriesAcrossContexts) {
+    imgui_util::testing::headless a;
+    imgui_util::testing::headless b;
+    const auto                    warm = [] { (void)calc_text_size("label"); };
+    for (int i = 0; i < 2; ++i) { // b's first frame clears what a cached (b is new to the cache)
+        (void)a.frame(warm);
+        (void)b.frame(warm);
+    }
+    const std::uint64_t misses = text_metrics_cache::instance().misses();
+
+    // Each context has its own atlas; alternating frames must not clear the shared cache
+    for (int i = 0; i < 3; ++i) {
+        (void)a.frame(warm);
+        (void)b.frame(warm);
+    }
+    EXPECT_EQ(text_metrics_cache::instance().misses(), misses);
+}
@@ -1,5 +1,6 @@
 #include <cmath>
 #include <gtest/gtest.h>
+#include <imgui_util/theme/overlay.hpp>
 #include <imgui_util/theme/theme.hpp>
 
 using namespace imgui_util::theme;
@@ -234,3 +235,46 @@ TEST(FromPresetCore, PresetAlternatePreserved) {
     ASSERT_TRUE(theme.preset_alternate.has_value());
     EXPECT_TRUE(*theme.preset_alternate == *dark_only_preset.alternate);
 }
+
+// --- theme_overlay ---
+
+namespace {
+    constexpr auto same_overlay  = theme_overlay::from_presets(test_preset, test_preset);
+    constexpr auto other_overlay = theme_overlay::from_presets(test_preset, dark_only_preset);
+} // namespace
+
+static_assert(same_overlay.empty());
+static_assert(other_overlay.color_count > 0);
+
+TEST(ThemeOverlay, IdenticalThemesProduceEmptyOverlay) {
+    EXPECT_TRUE(same_overlay.empty());
+    EXPECT_TRUE(same_overlay.colors().empty());
+    EXPECT_TRUE(same_overlay.vars().empty());
+}
+
+TEST(ThemeOverlay, EntriesHoldTargetValuesForDifferingColorsOnly) {
+    static constexpr auto base   = theme_config::from_preset_core(test_preset, theme_mode::dark);
+    static constexpr auto target = theme_config::from_preset_core(dark_only_preset, theme_mode::dark);
+    int                   differing = 0;
+    for (int i = 0; i < ImGuiCol_COUNT; i++) {
+        const ImVec4 &a = base.colors.at(i);
+        const ImVec4 &b = target.colors.at(i);
+        if (a.x != b.x || a.y != b.y || a.z != b.z || a.w != b.w) ++differing;
+    }
+    EXPECT_EQ(other_overlay.colors().size(), static_cast<size_t>(differing));
+    for (const auto &[idx, val]: other_overlay.colors()) {
+        EXPECT_FLOAT_EQ(val.x, target.colors.at(idx).x);
+        EXPECT_FLOAT_EQ(val.w, target.colors.at(idx).w);
+    }
+}
+
+TEST(ThemeOverlay, StyleFloatDiffMapsToStyleVar) {
+    theme_config base{};
+    theme_config target{};
+    target.frame_rounding = 6.0f;
+    const auto ov         = theme_overlay::diff(base, target);
+    ASSERT_EQ(ov.vars().size(), 1u);
+    EXPECT_EQ(ov.vars()[0].idx, ImGuiStyleVar_FrameRounding);
+    EXPECT_FLOAT_EQ(ov.vars()[0].val, 6.0f);
+    EXPECT_TRUE(ov.colors().empty());
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <imgui_util/theme/transition.hpp>
+
+using namespace imgui_util::theme;
+using namespace imgui_util::color;
+
+// --- ease ---
+
+TEST(Ease, Endpoints) {
+    for (const auto e: {easing::linear, easing::smoothstep, easing::ease_in_out_cubic, easing::ease_out_quad}) {
+        EXPECT_FLOAT_EQ(ease(e, 0.0f), 0.0f);
+        EXPECT_FLOAT_EQ(ease(e, 1.0f), 1.0f);
+    }
+}
+
+TEST(Ease, ClampsOutOfRange) {
+    EXPECT_FLOAT_EQ(ease(easing::smoothstep, -1.0f), 0.0f);
+    EXPECT_FLOAT_EQ(ease(easing::smoothstep, 2.0f), 1.0f);
+}
+
+TEST(Ease, SymmetricCurvesHitHalfAtMidpoint) {
+    EXPECT_FLOAT_EQ(ease(easing::linear, 0.5f), 0.5f);
+    EXPECT_FLOAT_EQ(ease(easing::smoothstep, 0.5f), 0.5f);
+    EXPECT_FLOAT_EQ(ease(easing::ease_in_out_cubic, 0.5f), 0.5f);
+}
+
+static_assert(ease(easing::ease_out_quad, 0.5f) == 0.75f);
+static_assert(ease(easing::linear, 0.25f) == 0.25f);
+
+// --- theme_transition ---
+
+namespace {
+    theme_config make_theme(const float bg, const float rounding) {
+        theme_config cfg{};
+        cfg.colors.fill(ImVec4{0.5f, 0.5f, 0.5f, 1.0f});
+        cfg.colors[ImGuiCol_WindowBg] = ImVec4{bg, bg, bg, 1.0f};
+        cfg.colors[ImGuiCol_Text]     = ImVec4{1.0f - bg, 1.0f - bg, 1.0f - bg, 1.0f};
+        cfg.window_rounding           = rounding;
+        return cfg;
+    }
+
+    struct ThemeTransitionLive : ::testing::Test {
+        ImGuiContext *ctx = nullptr;
+        void          SetUp() override { ctx = ImGui::CreateContext(); }
+        void          TearDown() override { ImGui::DestroyContext(ctx); }
+    };
+} // namespace
+
+TEST(ThemeTransition, OnlyDifferingFieldsAreDirty) {
+    const theme_transition tr{make_theme(0.1f, 0.0f), make_theme(0.9f, 4.0f)};
+    EXPECT_EQ(tr.dirty_color_count(), 2);
+    EXPECT_EQ(tr.dirty_node_color_count(), 0);
+    EXPECT_EQ(tr.dirty_float_count(), 1);
+    EXPECT_TRUE(tr.active());
+}
+
+TEST(ThemeTransition, IdenticalThemesHaveNoDirtyFields) {
+    const theme_config     a = make_theme(0.2f, 2.0f);
+    const theme_transition tr{a, a};
+    EXPECT_EQ(tr.dirty_color_count(), 0);
+    EXPECT_EQ(tr.dirty_node_color_count(), 0);
+    EXPECT_EQ(tr.dirty_float_count(), 0);
+}
+
+TEST(ThemeTransition, DefaultIsInactive) {
+    theme_transition tr;
+    EXPECT_FALSE(tr.active());
+    EXPECT_FALSE(tr.update(0.1f));
+}
+
+TEST_F(ThemeTransitionLive, TransitionWritesInterpolatedDirtyFields) {
+    const theme_config from = make_theme(0.0f, 0.0f);
+    const theme_config to   = make_theme(1.0f, 8.0f);
+    ImGuiStyle        &s    = ImGui::GetStyle();
+    s.Colors[ImGuiCol_Button] = ImVec4{0.25f, 0.25f, 0.25f, 1.0f}; // not dirty: must stay untouched
+
+    theme_transition tr{from, to, 1.0f, easing::linear};
+    EXPECT_TRUE(tr.update(0.5f));
+    EXPECT_NEAR(s.Colors[ImGuiCol_WindowBg].x, 0.5f, 1e-5f);
+    EXPECT_NEAR(s.Colors[ImGuiCol_Text].x, 0.5f, 1e-5f);
+    EXPECT_NEAR(s.WindowRounding, 4.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(s.Colors[ImGuiCol_Button].x, 0.25f);
+}
+
+TEST_F(ThemeTransitionLive, TransitionSnapsExactlyToTarget) {
+    const theme_config from = make_theme(0.1f, 1.0f);
+    const theme_config to   = make_theme(0.7f, 3.0f);
+    theme_transition   tr{from, to, 0.3f, easing::ease_in_out_cubic};
+    int                frames = 0;
+    while (tr.update(1.0f / 60.0f))
+        ++frames;
+    EXPECT_GT(frames, 0);
+    EXPECT_FALSE(tr.active());
+    const ImGuiStyle &s = ImGui::GetStyle();
+    EXPECT_EQ(s.Colors[ImGuiCol_WindowBg].x, to.colors[ImGuiCol_WindowBg].x);
+    EXPECT_EQ(s.Colors[ImGuiCol_Text].y, to.colors[ImGuiCol_Text].y);
+    EXPECT_EQ(s.WindowRounding, to.window_rounding);
+}
+
+TEST_F(ThemeTransitionLive, ZeroDurationSnapsOnFirstUpdate) {
+    theme_transition tr{make_theme(0.0f, 0.0f), make_theme(1.0f, 2.0f), 0.0f};
+    EXPECT_FALSE(tr.update(0.0f));
+    EXPECT_EQ(ImGui::GetStyle().Colors[ImGuiCol_WindowBg].x, 1.0f);
+    EXPECT_EQ(ImGui::GetStyle().WindowRounding, 2.0f);
+}
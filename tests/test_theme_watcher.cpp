@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <imgui_util/theme/theme_watcher.hpp>
+#include <string>
+#include <thread>
+
+using namespace imgui_util::theme;
+using namespace std::chrono_literals;
+
+namespace {
+    // Minimal parser: the first line of the file becomes the theme name; "bad" fails to parse.
+    std::optional<theme_config> parse_name(const std::filesystem::path &path, watch_notices &notes) {
+        std::ifstream file(path);
+        std::string   line;
+        if (!std::getline(file, line) || line == "bad") {
+            notes.push_back({watch_notice::level::error, "unparsable"});
+            return std::nullopt;
+        }
+        theme_config cfg{};
+        cfg.name = line;
+        return cfg;
+    }
+
+    // Poll @p done the way a render loop would, for up to @p timeout.
+    template<typename Pred>
+    bool wait_until(Pred done, const std::chrono::milliseconds timeout = 3s) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!done()) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(10ms);
+        }
+        return true;
+    }
+
+    void write_file(const std::filesystem::path &path, const std::string &contents) {
+        std::ofstream(path, std::ios::trunc) << contents << '\n';
+    }
+
+    std::shared_ptr<theme_config> wait_for_reload(theme_file_watcher &w) {
+        std::shared_ptr<theme_config> t;
+        (void)wait_until([&] { return (t = w.take()) != nullptr; });
+        return t;
+    }
+
+    struct ThemeWatcher : ::testing::TestWithParam<watch_backend> {
+        std::filesystem::path dir;
+        std::filesystem::path file;
+        std::atomic<int>      parses{0}; // parse attempts, successful or not
+
+        // parse_name() that also counts attempts (runs on the watcher thread)
+        theme_file_watcher::parse_fn counting_parser() {
+            return [this](const std::filesystem::path &p, watch_notices &notes) {
+                parses.fetch_add(1);
+                return parse_name(p, notes);
+            };
+        }
+
+        void SetUp() override {
+            dir = std::filesystem::temp_directory_path()
+                / ("imgui_util_watch_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+            std::filesystem::create_directories(dir);
+            file = dir / "theme.txt";
+            write_file(file, "initial");
+        }
+        void TearDown() override { std::filesystem::remove_all(dir); }
+    };
+} // namespace
+
+TEST_P(ThemeWatcher, OnlyChangesToTheFileReload) {
+    theme_file_watcher w{file, counting_parser(), 50ms, GetParam()};
+    w.wait_ready();
+    EXPECT_EQ(w.take(), nullptr);
+    write_file(dir / "other.txt", "sibling"); // same directory, different file
+
+    // Anything the idle period or the sibling write triggered would have been parsed first
+    write_file(file, "edited");
+    const auto t = wait_for_reload(w);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->name, "edited");
+    EXPECT_EQ(parses.load(), 1);
+    EXPECT_EQ(w.reload_count(), 1);
+}
+
+TEST_P(ThemeWatcher, PublishesParsedThemeAfterSave) {
+    theme_file_watcher w{file, parse_name, 50ms, GetParam()};
+    w.wait_ready();
+    EXPECT_TRUE(w.ready());
+    if (GetParam() == watch_backend::polling) EXPECT_FALSE(w.using_inotify());
+#ifdef __linux__
+    if (GetParam() == watch_backend::automatic) EXPECT_TRUE(w.using_inotify());
+#endif
+    write_file(file, "edited");
+    const auto t = wait_for_reload(w);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->name, "edited");
+    EXPECT_EQ(w.take(), nullptr); // consumed
+}
+
+TEST_P(ThemeWatcher, RapidSavesAreDebounced) {
+    theme_file_watcher w{file, parse_name, 400ms, GetParam()};
+    w.wait_ready();
+    for (int i = 0; i < 5; i++) {
+        write_file(file, "burst" + std::to_string(i));
+        std::this_thread::sleep_for(30ms);
+    }
+    const auto t = wait_for_reload(w);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->name, "burst4");
+    EXPECT_EQ(w.reload_count(), 1);
+}
+
+TEST_P(ThemeWatcher, AtomicRenameIsSeen) {
+    theme_file_watcher w{file, parse_name, 50ms, GetParam()};
+    w.wait_ready();
+    const auto tmp = dir / "theme.txt.tmp";
+    write_file(tmp, "renamed over"); // differs in size: polling may see the same coarse mtime
+    std::filesystem::rename(tmp, file);
+    const auto t = wait_for_reload(w);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->name, "renamed over");
+}
+
+TEST_P(ThemeWatcher, ParseFailureKeepsNothingPending) {
+    theme_file_watcher w{file, counting_parser(), 50ms, GetParam()};
+    w.wait_ready();
+    write_file(file, "bad");
+    ASSERT_TRUE(wait_until([&] { return parses.load() > 0; }));
+    EXPECT_EQ(w.take(), nullptr);
+    EXPECT_EQ(w.reload_count(), 0);
+}
+
+TEST_P(ThemeWatcher, ParseFailureIsQueuedForTheOwningThread) {
+    theme_file_watcher w{file, parse_name, 50ms, GetParam()};
+    w.wait_ready();
+    EXPECT_TRUE(w.take_notices().empty());
+    write_file(file, "bad");
+
+    // The parser's own message, then the watcher's
+    watch_notices notes;
+    ASSERT_TRUE(wait_until([&] {
+        std::ranges::move(w.take_notices(), std::back_inserter(notes));
+        return notes.size() >= 2;
+    }));
+    EXPECT_EQ(notes[0].severity, watch_notice::level::error);
+    EXPECT_EQ(notes[0].text, "unparsable");
+    EXPECT_EQ(notes[1].severity, watch_notice::level::warning);
+    EXPECT_TRUE(w.take_notices().empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, ThemeWatcher, ::testing::Values(watch_backend::automatic, watch_backend::polling));